@@ -34,11 +34,44 @@ CHANGE LOGS           :
 
 *****************************************************************************/
 
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+   /* CPU affinity of batch worker threads needs GNU extensions of sched.h */
+   #define _GNU_SOURCE
+#endif
 #include <stdio.h>
+#include <stdarg.h>
 #include <string.h>
 #include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <time.h>
 #include <math.h>
+#if defined(__unix__) || defined(__APPLE__)
+   /* caches shared by all threads are guarded by pthread mutex */
+   #include <pthread.h>
+   #include <unistd.h>
+   #define BIG_NUM_PTHREADS
+   /* operand files of --files are mapped into memory */
+   #include <sys/mman.h>
+   #include <sys/stat.h>
+   #include <sys/resource.h>
+   #include <fcntl.h>
+   #define BIG_NUM_MMAP
+   #if defined(__linux__)
+      #include <sched.h>
+      #define BIG_NUM_CPU_AFFINITY
+   #endif
+#endif
+/* scratch arena is kept per thread, so that scratch needs no lock */
+#if defined(__GNUC__)
+   #define BIG_NUM_THREAD_LOCAL                  __thread
+#elif defined(_MSC_VER)
+   #define BIG_NUM_THREAD_LOCAL                  __declspec(thread)
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+   #define BIG_NUM_THREAD_LOCAL                  _Thread_local
+#else
+   #define BIG_NUM_THREAD_LOCAL
+#endif
 
 #define NULL_DATA_PTR                            ((void *)0)
 #define NULL_CHAR                               ('\0')
@@ -57,35 +90,360 @@ CHANGE LOGS           :
 //#define TRACE_DATA                              (5U)
 //#define TRACE_FLOW                              (6U)
 
-#define MAX_OPERAND_LEN                          (20)
-#define MAX_DATA_SIZE                            (MAX_OPERAND_LEN)
+/* default max num of chars in operand str, can be overridden by -DMAX_OPERAND_LEN=<num chars> or by Set_Max_Operand_Len() */
+#ifndef MAX_OPERAND_LEN
+   #define MAX_OPERAND_LEN                       (64UL * 1024UL * 1024UL)
+#endif
+/* environment variable of max num of chars in operand str of command line modes, which is set by Env_Options() */
+#define MAX_OPERAND_LEN_ENV_NAME   "BIG_NUM_MAX_OPERAND_LEN"
+#define MAX_DATA_SIZE                            (20)
+/* initial alloc size of operand str read from input, which grows till max operand len */
+#define INIT_INPUT_STR_ALLOC_SIZE                (64)
 
 #define REQ_PRECISION_DIGITS                     (10)
 #define RESULT_BASED_PRECISION_DIGITS             (0)
 
-typedef unsigned char uint8_t;
-typedef unsigned short int uint16_t;
-typedef unsigned int uint32_t;
-typedef unsigned long uint64_t;
+/* magnitude of big num is stored in little endian order of 64 bit limbs */
+#define BIG_NUM_LIMB_BITS                        (64)
+#define BIG_NUM_LIMB_MAX                         (UINT64_MAX)
+/* max num of decimal digits, whose value always fits in a limb, and 10 ^ BIG_NUM_LIMB_DEC_DIGITS */
+#define BIG_NUM_LIMB_DEC_DIGITS                  (19)
+#define BIG_NUM_LIMB_DEC_BASE                    (10000000000000000000ULL)
 
-typedef char int8_t;
-typedef short int int16_t;
-typedef int int32_t;
-typedef long int64_t;
+/* crossovers of multiplication and division methods in num of limbs, measured on build machine by --tune and included by -DBIG_NUM_TUNE_HEADER */
+#ifdef BIG_NUM_TUNE_HEADER
+   #include "big_num_tune.h"
+#endif
+/* from this num of limbs, Karatsuba multiplication is used instead of grade-school multiplication. Must be atleast 8 */
+#ifndef KARATSUBA_THRESHOLD
+   #define KARATSUBA_THRESHOLD                   (32)
+#endif
+/* from this num of limbs, Toom-3 multiplication is used instead of Karatsuba multiplication. Must be atleast 16 */
+#ifndef TOOM3_THRESHOLD
+   #define TOOM3_THRESHOLD                      (160)
+#endif
+/* from this num of limbs, Toom-4 multiplication is used instead of Toom-3 multiplication. Must be atleast 16 */
+#ifndef TOOM4_THRESHOLD
+   #define TOOM4_THRESHOLD                      (256)
+#endif
+/* from this num of limbs of smaller operand, number theoretic transform (NTT) multiplication is used instead of Toom-4 multiplication */
+#ifndef NTT_THRESHOLD
+   #define NTT_THRESHOLD                       (2500)
+#endif
+/* from this num of limbs of divisor and quotient, Burnikel-Ziegler recursive division is used instead of Knuth division. Must be atleast 4 */
+#ifndef BZ_DIV_THRESHOLD
+   #define BZ_DIV_THRESHOLD                       (40)
+#endif
+/* from this num of limbs of divisor and quotient, division multiplies by reciprocal of divisor found by Newton iteration, instead of Burnikel-Ziegler division */
+#ifndef NEWTON_DIV_THRESHOLD
+   #define NEWTON_DIV_THRESHOLD                (16000)
+#endif
+/* reciprocal of divisor of upto this num of limbs is found by Knuth division, instead of Newton iteration. Must be atleast 8 */
+#define NEWTON_INV_BASE_LEN                      (32)
+/* from this num of chunks of BIG_NUM_LIMB_DEC_DIGITS digits, str conversion splits digits in halves, combined by cached powers of 10 */
+#ifndef STR_CONV_DC_THRESHOLD
+   #define STR_CONV_DC_THRESHOLD                 (200)
+#endif
+/* num of chars of str, that are validated and packed into chunks at a time, after which mapped pages of operand file are dropped */
+#define STR_CONV_BLOCK_CHARS                     (1024UL * 1024UL)
+/* max levels of cached 10 ^ (BIG_NUM_LIMB_DEC_DIGITS * 2 ^ level), which covers any operand, that fits in memory */
+#define POW10_CACHE_MAX_LEVELS                   (48)
+/* max num of cached 10 ^ power for any power, and default max bytes of pow10 cache, which can be changed by Set_Pow10_Cache_Limit() */
+#define POW10_CACHE_MAX_ENTRIES                  (32)
+#ifndef POW10_CACHE_MAX_BYTES
+   #define POW10_CACHE_MAX_BYTES                 (256UL * 1024UL * 1024UL)
+#endif
+/* scratch arena of a thread has atleast this num of limbs, and default max bytes of scratch arena, which can be changed by Set_Scratch_Arena_Limit() */
+#define SCRATCH_ARENA_MIN_LIMBS                  (4096)
+#ifndef SCRATCH_ARENA_MAX_BYTES
+   #define SCRATCH_ARENA_MAX_BYTES               (64UL * 1024UL * 1024UL)
+#endif
+/* from this num of limbs, scratch is mapped, so that its pages are returned to system, when it is freed */
+#define SCRATCH_MAP_MIN_LIMBS                    (128UL * 1024UL)
+/* from this num of limbs, AVX2 carry lookahead kernel is used for limbs add and sub, if CPU supports AVX2 */
+#define LIMBS_AVX2_MIN_LEN                       (16)
+/* upto this num of limbs or chunks, str conversion keeps its temporary limbs and chunks on stack, instead of heap */
+#define BIG_NUM_STACK_LIMBS                      (32)
+/* from this num of chars, Dec_Str_Scan() validates 32 chars per iteration by AVX2 */
+#define DEC_STR_SIMD_MIN_LEN                     (32)
+/* num of NTT primes, whose product bounds every coefficient of product, and max transform length supported by all NTT primes */
+#define NTT_NUM_PRIMES                           (3)
+#define NTT_MAX_TRANSFORM_LEN                    ((big_num_limb_t)1 << 55)
+/* NTT levels of blocks upto this num of coeffs are done block by block, so that block stays in cache for those levels */
+#ifndef NTT_CACHE_BLOCK_LEN
+   #define NTT_CACHE_BLOCK_LEN                   (4096)
+#endif
+/* default num of threads of a multiplication, where 0 is num of online CPUs, which can be changed by Set_Mul_Threads() */
+#ifndef MUL_NUM_THREADS
+   #define MUL_NUM_THREADS                        (0)
+#endif
+/* max num of threads, that run tasks of Par_Run() */
+#define PAR_MAX_THREADS                         (256)
+/* min num of coeffs or limbs of a task of parallel NTT stage, so that task outweighs start of its thread */
+#ifndef PAR_MIN_GRAIN
+   #define PAR_MIN_GRAIN                      (16384)
+#endif
+/* from this num of limbs, sub products of Toom multiplication, and chunk products of unbalanced multiplication of atleast
+   PAR_MUL_MIN_LIMBS x PAR_MUL_MIN_LIMBS limbs, are done in parallel */
+#ifndef PAR_MUL_MIN_LIMBS
+   #define PAR_MUL_MIN_LIMBS                   (1024)
+#endif
+/* name of header generated by --tune */
+#define BIG_NUM_TUNE_HEADER_NAME                 ("big_num_tune.h")
+
+/* max num of decimal digits of operand of small num fast path, as 10 ^ SMALL_NUM_MAX_DIGITS fits in double limb */
+#define SMALL_NUM_MAX_DIGITS                     (38)
+/* batch records are grouped by size class, which is num of bits of num of chars of longer operand, within windows of
+   BATCH_WINDOW_RECS records, so that operands and results of a window stay in cache */
+#define BATCH_NUM_SIZE_CLASSES                   (65)
+#define BATCH_WINDOW_RECS                      (1024)
+/* default num of threads of Big_Nums_Batch_Parallel(), where 0 is num of online CPUs, which can be changed by Set_Batch_Threads() */
+#ifndef BATCH_NUM_THREADS
+   #define BATCH_NUM_THREADS                        (0)
+#endif
+/* environment variables of num of threads, upto BATCH_MAX_THREADS, and of CPU affinity (0 or 1) of Big_Nums_Batch_Parallel()
+   in command line modes, which are set by Env_Options() */
+#define BATCH_THREADS_ENV_NAME   "BIG_NUM_BATCH_THREADS"
+#define BATCH_AFFINITY_ENV_NAME  "BIG_NUM_BATCH_AFFINITY"
+#define BATCH_MAX_THREADS                       (1024)
+/* records of parallel batch are split into about this num of tasks per thread, so that idle threads have tasks to steal */
+#define BATCH_TASKS_PER_THREAD                     (8)
+/* read and write buffer size of --batch, where read buffer grows for a longer line, upto 2 * max_operand_len + BATCH_CLI_LINE_SLACK chars */
+#define BATCH_CLI_IO_BUF_SIZE        (1024UL * 1024UL)
+#define BATCH_CLI_LINE_SLACK                      (64)
+/* records of --batch are done by Big_Nums_Batch_Parallel() in runs of upto this num of records */
+#define BATCH_CLI_MAX_RECS                      (4096)
+/* max nesting of parentheses and unary signs in expression of Big_Nums_Expr_Compile() */
+#define EXPR_MAX_DEPTH                           (256)
+/* register of expression, while it is compiled, is variable index, or constant or temporary index with its flag, as constants
+   and temporaries are placed after variables, once num of variables is known */
+#define EXPR_CONST_REG_FLAG                      ((size_t)1 << (sizeof(size_t) * 8 - 1))
+#define EXPR_TEMP_REG_FLAG                       ((size_t)1 << (sizeof(size_t) * 8 - 2))
+#define EXPR_INVALID_REG                         (SIZE_MAX)
+/* exit status of --batch, when all records are done, some records failed, or input, output or memory failed */
+#define BATCH_CLI_EXIT_OK                          (0)
+#define BATCH_CLI_EXIT_REC_FAILED                  (1)
+#define BATCH_CLI_EXIT_IO_FAILED                   (2)
+/* binary format of big num by Big_Num_To_Bin(), whose header has magic, version, sign flag, 2 zero bytes, precision_digits
+   and num_limbs, and is followed by limbs and checksum. Version is changed, if format is changed */
+#define BIG_NUM_BIN_MAGIC                     ("BNUM")
+#define BIG_NUM_BIN_VERSION                        (1)
+#define BIG_NUM_BIN_HEADER_SIZE                   (24)
+#define BIG_NUM_BIN_CHECKSUM_SIZE                  (8)
+#define BIG_NUM_BIN_CHECKSUM_SEED  (0xCBF29CE484222325ULL)
+/* num of chars of buffer, by which Big_Num_Write() writes digits */
+#define BIG_NUM_WRITE_BUF_SIZE           (64 * 1024)
+/* max addends of accumulator between normalisations, so that carry count of every chunk stays far below BIG_NUM_LIMB_DEC_BASE */
+#define BIG_NUM_ACC_MAX_PENDING       ((size_t)UINT32_MAX)
+/* max chars of error message kept by Trace_Error(), with null char */
+#define TRACE_ERROR_MSG_SIZE                     (256)
+/* num of operations timed for each operation by --bench */
+#define BENCH_NUM_OPERS                       (200000)
+/* max num of digits of operands of --selftest, which runs operations at 1k, 100k and 10M digits */
+#define SELF_TEST_MAX_DIGITS                (10000000)
+/* num of primes, modulo which results of --selftest are checked */
+#define SELF_TEST_NUM_PRIMES                       (3)
+/* --files operations of --selftest must not grow peak resident memory by more than these bytes per digit and base bytes */
+#define SELF_TEST_FILES_MAX_RSS_PER_DIGIT          (8)
+#define SELF_TEST_FILES_BASE_RSS_BYTES      (16UL * 1024UL * 1024UL)
+/* operand files of --selftest are written, and result files are compared, in blocks of this num of chars */
+#define SELF_TEST_FILES_BLOCK_CHARS         (64UL * 1024UL)
+
+#define BIG_NUM_SIGN_POSITIVE                    (0)
+#define BIG_NUM_SIGN_NEGATIVE                    (1)
+
+/* uint8_t .. int64_t are taken from stdint.h, as limbs need exact 64 bit width, even where long is 32 bit */
+
+typedef uint64_t big_num_limb_t;
+
+#if defined(__SIZEOF_INT128__)
+   /* double limb is used for 64 x 64 bits multiply and 128 / 64 bits division of limbs */
+   #define BIG_NUM_DLIMB_SUPPORT
+   typedef unsigned __int128 big_num_dlimb_t;
+#endif
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+   /* 8 digit chars loaded in a limb, have first char in least significant byte */
+   #define BIG_NUM_SWAR_DIGITS
+   /* limbs are stored as such in binary format of big num, which is little endian */
+   #define BIG_NUM_LITTLE_ENDIAN
+#endif
+
+#if defined(__x86_64__) && defined(__GNUC__)
+   /* add with carry and subtract with borrow intrinsics, and AVX2 kernels selected at run time by CPUID, are used for limbs add and sub */
+   #include <immintrin.h>
+   #define BIG_NUM_X86_64_KERNELS
+   /* limb as taken by _addcarry_u64() and _subborrow_u64(), which can alias big_num_limb_t */
+   typedef unsigned long long __attribute__((__may_alias__)) big_num_adc_limb_t;
+#endif
+
+typedef struct
+{
+	big_num_limb_t *limb_ptr;
+	size_t num_limbs;
+	size_t alloc_limbs;
+	//num of decimal digits after '.' char, ie value = magnitude * 10 ^ -precision_digits
+	size_t precision_digits;
+	uint8_t sign_flag;
+} big_num_t;
+
+/* NTT prime of form (k * 2 ^ m + 1), with constants of Montgomery multiplication modulo prime */
+typedef struct
+{
+	big_num_limb_t prime;
+	//primitive root of prime
+	big_num_limb_t generator;
+	//-prime ^ -1 mod 2 ^ BIG_NUM_LIMB_BITS
+	big_num_limb_t neg_inverse;
+	//2 ^ BIG_NUM_LIMB_BITS mod prime, ie 1 in Montgomery form
+	big_num_limb_t mont_one;
+	//2 ^ (2 * BIG_NUM_LIMB_BITS) mod prime, as Montgomery multiplication with it converts to Montgomery form
+	big_num_limb_t mont_r2;
+} ntt_prime_t;
+
+/* stage of NTT multiplication, which Ntt_Par_Task() does on a range of its items */
+typedef enum
+{
+	NTT_STAGE_ROOTS, NTT_STAGE_TO_MONT, NTT_STAGE_FORWARD_LEVEL, NTT_STAGE_FORWARD_BLOCKS, NTT_STAGE_POINTWISE, NTT_STAGE_INVERSE_BLOCKS,
+	NTT_STAGE_INVERSE_LEVEL, NTT_STAGE_SCALE, NTT_STAGE_CRT
+} ntt_stage_t;
+
+/* NTT multiplication, whose stages are split into tasks of Par_Run() */
+typedef struct
+{
+	const ntt_prime_t *ntt_primes_ptr;
+	const ntt_prime_t *ntt_prime_ptr;
+	//residues of product modulo each prime, each of transform_len coeffs
+	big_num_limb_t *residues_ptr;
+	//coeffs transformed by stage, and coeffs multiplied with them by NTT_STAGE_POINTWISE
+	big_num_limb_t *coeffs_ptr;
+	const big_num_limb_t *coeffs2_ptr;
+	big_num_limb_t *roots_ptr;
+	//operand converted to Montgomery form by NTT_STAGE_TO_MONT
+	const big_num_limb_t *limbs_ptr;
+	size_t num_limbs;
+	big_num_limb_t *result_ptr;
+	size_t transform_len;
+	size_t num_coeffs;
+	//block len of NTT_STAGE_FORWARD_LEVEL and NTT_STAGE_INVERSE_LEVEL, or of cache block of NTT_STAGE_FORWARD_BLOCKS and NTT_STAGE_INVERSE_BLOCKS
+	size_t block_len;
+	//root of unity in Montgomery form, and 1 / transform_len in normal form
+	big_num_limb_t root;
+	big_num_limb_t scale;
+	//constants of Garner's CRT
+	big_num_limb_t prime12_limbs[2];
+	big_num_limb_t inverse1_mod2;
+	big_num_limb_t prime1_mod3;
+	big_num_limb_t inverse12_mod3;
+	//carry limbs out of each task of NTT_STAGE_CRT, which are added to next coeffs after all tasks
+	big_num_limb_t crt_carries[3 * PAR_MAX_THREADS];
+	size_t num_items;
+	size_t num_tasks;
+	uint8_t stage;
+} ntt_par_t;
+
+/* num_limbs x num_limbs sub product of Toom multiplication, which is a task of Par_Run() */
+typedef struct
+{
+	big_num_limb_t *result_ptr;
+	const big_num_limb_t *limbs1_ptr;
+	const big_num_limb_t *limbs2_ptr;
+	size_t num_limbs;
+	big_num_limb_t *scratch_ptr;
+} limbs_mul_task_t;
+
+/* chunk products of unbalanced multiplication, where a task of Par_Run() does a run of chunks with its own scratch */
+typedef struct
+{
+	//even chunk products go to result, and odd chunk products to odd_prods, so that chunk products of a kind do not overlap
+	big_num_limb_t *result_ptr;
+	big_num_limb_t *odd_prods_ptr;
+	const big_num_limb_t *limbs1_ptr;
+	const big_num_limb_t *limbs2_ptr;
+	size_t num_limbs2;
+	size_t num_chunks;
+	size_t num_tasks;
+	big_num_limb_t *scratch_ptr;
+	size_t scratch_size;
+} limbs_mul_chunks_t;
+
+#ifdef BIG_NUM_PTHREADS
+/* tasks of Par_Run(), which threads take in order of task index */
+typedef struct
+{
+	void (*task_func)(void *const task_ctx_ptr, const size_t task_index);
+	void *task_ctx_ptr;
+	size_t num_tasks;
+	size_t next_task;
+	pthread_mutex_t task_mutex;
+} par_run_t;
+#endif
+
+/* cached 10 ^ power, where least recently used entry has least last_use */
+typedef struct
+{
+	big_num_t power_num;
+	size_t power;
+	uint64_t last_use;
+} pow10_cache_entry_t;
+
+typedef struct
+{
+	uint64_t num_hits;
+	uint64_t num_misses;
+	uint64_t num_evictions;
+	size_t num_levels;
+	size_t num_entries;
+	//bytes of limbs of levels and entries
+	size_t cache_bytes;
+	size_t peak_cache_bytes;
+	size_t max_cache_bytes;
+} pow10_cache_stats_t;
+
+/* bump arena of scratch limbs of a thread, where scratch is freed in reverse order of its alloc */
+typedef struct
+{
+	big_num_limb_t *limb_ptr;
+	size_t alloc_limbs;
+	size_t num_used_limbs;
+	//limbs of scratch in use, that did not fit in arena and were allocated from heap
+	size_t num_heap_limbs;
+	size_t peak_limbs;
+	uint64_t num_allocs;
+	uint64_t num_heap_allocs;
+} scratch_arena_t;
+
+typedef struct
+{
+	size_t arena_bytes;
+	size_t used_bytes;
+	//high water mark of scratch bytes in use, including scratch allocated from heap
+	size_t peak_bytes;
+	uint64_t num_allocs;
+	uint64_t num_heap_allocs;
+	size_t max_arena_bytes;
+} scratch_arena_stats_t;
+
+#ifdef BIG_NUM_DLIMB_SUPPORT
+/* operand of small num fast path, whose value is magnitude * 10 ^ -precision_digits */
+typedef struct
+{
+	big_num_dlimb_t magnitude;
+	size_t precision_digits;
+	//num of digits in str, which is atleast num of decimal digits of magnitude
+	size_t num_digits;
+	uint8_t sign_flag;
+} small_num_t;
+#endif
 
 typedef struct
 {
 	const char *operand_str1;
 	const char *operand_str2;
-	char *proc_str1_ptr;
-	char *proc_str2_ptr;
 	char *result_ptr;
-	uint8_t proc_str1_precision_digits;
-    uint8_t proc_str2_precision_digits;
-	uint8_t result_str_precision_digits;
-	uint8_t proc_str1_len;
-	uint8_t proc_str2_len;
-	uint8_t result_alloc_size;
+	big_num_t proc_num1;
+	big_num_t proc_num2;
+	big_num_t result_num;
 } big_num_datas_t;
 
 typedef enum
@@ -94,17 +452,448 @@ typedef enum
 	NUM_BIG_NUMS_OPER
 } oper_t;
 
-uint16_t Get_Validate_Input_Number(void *const input_num_ptr, char *const input_str_ptr, const unsigned int input_str_max_chars, const int32_t valid_min_value, const int32_t valid_max_value);
-uint16_t Get_Input_Str(char *const input_str_ptr, const unsigned int input_str_max_chars);
+/* record of Big_Nums_Batch(), where num_precision_digits is used only by BIG_NUMS_DIVISION_OPER */
+typedef struct
+{
+	uint8_t big_num_arithmetic_oper;
+	const char *operand_str1;
+	const char *operand_str2;
+	size_t num_precision_digits;
+} big_nums_batch_rec_t;
+
+typedef struct
+{
+	//result str in result block of batch, or NULL if record failed
+	char *result_ptr;
+	//num of chars of result str, without null char
+	size_t result_len;
+	uint16_t status;
+	//error message of failed record, as kept by Trace_Error() in thread, that did it, or empty str
+	char error_msg[TRACE_ERROR_MSG_SIZE];
+} big_nums_batch_result_t;
+
+/* task of Big_Nums_Batch_Parallel(), which is a run of consecutive records, with estimated cost of its records */
+typedef struct
+{
+	size_t rec_start;
+	size_t num_recs;
+	uint64_t cost;
+	char *result_block_ptr;
+	uint16_t status;
+} batch_task_t;
+
+/* records of --batch, which point into its read buffer, with input line num of each record, and its parse error or NULL */
+typedef struct
+{
+	big_nums_batch_rec_t recs[BATCH_CLI_MAX_RECS];
+	big_nums_batch_result_t results[BATCH_CLI_MAX_RECS];
+	const char *parse_error_ptrs[BATCH_CLI_MAX_RECS];
+	uint64_t line_nums[BATCH_CLI_MAX_RECS];
+	size_t num_recs;
+	uint8_t rec_failed_state;
+} batch_cli_recs_t;
+
+/* instruction of expression plan, which is regs[dest_reg] = regs[src_reg1] oper regs[src_reg2] */
+typedef struct
+{
+	uint8_t big_num_arithmetic_oper;
+	size_t dest_reg;
+	size_t src_reg1;
+	size_t src_reg2;
+} expr_instr_t;
+
+/* expression compiled by Big_Nums_Expr_Compile(), whose registers are variables, then constants, then temporaries */
+typedef struct
+{
+	expr_instr_t *instrs_ptr;
+	size_t num_instrs;
+	size_t alloc_instrs;
+	big_num_t *regs_ptr;
+	size_t num_regs;
+	//names of variables, in order of their registers
+	char **var_names_ptr;
+	size_t num_vars;
+	size_t result_reg;
+	size_t num_precision_digits;
+	//result of instruction, which is swapped into its register, so that no operand is also result
+	big_num_t oper_result_num;
+} expr_plan_t;
+
+/* state of Big_Nums_Expr_Compile(), while expression is parsed */
+typedef struct
+{
+	expr_plan_t *plan_ptr;
+	const char *expr_str;
+	size_t str_pos;
+	//constants in order of their registers, which are moved into plan, after expression is parsed
+	big_num_t *consts_ptr;
+	size_t num_consts;
+	size_t alloc_consts;
+	size_t num_used_temps;
+	size_t max_used_temps;
+	size_t zero_reg;
+	size_t depth;
+} expr_parser_t;
+
+/* operand file of --files, whose chars are mapped into memory, or read into memory, where mmap is not supported */
+typedef struct
+{
+	//chars of operand without leading and trailing spaces and newlines, which has no null char
+	const char *chars_ptr;
+	size_t num_chars;
+	void *map_ptr;
+	size_t map_size;
+} operand_file_t;
+
+/* accumulator of additions, whose sum is kept in redundant form of chunks of BIG_NUM_LIMB_DEC_DIGITS digits, in which
+   chunk = low limb + carry count * 2 ^ BIG_NUM_LIMB_BITS, so that addend is added without propagating carries */
+typedef struct
+{
+	//one block of alloc_chunks limbs for each of low limbs and carry counts of positive and of negative addends
+	big_num_limb_t *chunk_block_ptr;
+	//sums of positive addends and of negative addends, indexed by sign flag, from least significant chunk
+	big_num_limb_t *low_ptr[2];
+	big_num_limb_t *carries_ptr[2];
+	size_t num_chunks;
+	size_t alloc_chunks;
+	//chunks after '.' char, so that '.' char of every addend is at chunk boundary
+	size_t num_frac_chunks;
+	//max precision digits of addends, which is precision digits of sum
+	size_t precision_digits;
+	size_t num_pending_addends;
+	//sign of sum, after Big_Num_Acc_Normalize()
+	uint8_t sign_flag;
+} big_num_acc_t;
+
+#ifdef BIG_NUM_PTHREADS
+struct batch_worker;
+
+/* shared state of Big_Nums_Batch_Parallel() */
+typedef struct
+{
+	const big_nums_batch_rec_t *recs_ptr;
+	big_nums_batch_result_t *results_ptr;
+	batch_task_t *tasks_ptr;
+	//task indices, in which each worker has a deque of consecutive task indices
+	size_t *task_order_ptr;
+	struct batch_worker *workers_ptr;
+	size_t num_workers;
+} batch_parallel_t;
+
+/* worker of Big_Nums_Batch_Parallel(), which pops tasks at head of its deque, task_order_ptr[head_pos .. tail_pos),
+   and steals tasks at tail of deque of other workers */
+typedef struct batch_worker
+{
+	batch_parallel_t *batch_ptr;
+	size_t worker_id;
+	size_t head_pos;
+	size_t tail_pos;
+	pthread_mutex_t deque_mutex;
+	pthread_t thread;
+} batch_worker_t;
+#endif
+
+uint16_t Get_Validate_Input_Number(void *const input_num_ptr, char *const input_str_ptr, const size_t input_str_max_chars, const int32_t valid_min_value, const int32_t valid_max_value);
+uint16_t Get_Input_Str(char *const input_str_ptr, const size_t input_str_max_chars);
+uint16_t Get_Input_Big_Str(char **const input_str_ptr_ptr, const size_t input_str_max_chars);
 uint16_t Str_to_Num_Conv( void *const num_conv_from_str_ptr, const char *const num_in_str);
-uint32_t Power_Of(const uint8_t base, const uint8_t power);
-uint16_t Swap_Two_Datas(void *const data1, void *const data2, const uint8_t data_size);
-uint16_t Validate_Big_Num_Data(const uint8_t big_num_arithmetic_oper, const uint8_t num_precision_digits, big_num_datas_t *const big_num_datas_ptr);
+uint64_t Power_Of(const uint8_t base, const uint8_t power);
+uint16_t Swap_Two_Datas(void *const data1, void *const data2, const size_t data_size);
+void Set_Max_Operand_Len(const size_t max_len);
+void Set_Pow10_Cache_Limit(const size_t max_bytes);
+void Set_Scratch_Arena_Limit(const size_t max_bytes);
+uint16_t Tune_Thresholds(const char *const header_file_name);
+double Tune_Time_Mul(const size_t num_limbs);
+double Tune_Time_Div(const size_t num_limbs);
+uint16_t Validate_Big_Num_Data(const uint8_t big_num_arithmetic_oper, big_num_datas_t *const big_num_datas_ptr);
+uint16_t Validate_Operand_Str(big_num_t *const num_ptr, const char *const operand_str, const char *const operand_name);
+void Init_Big_Num_Datas(big_num_datas_t *const big_num_datas_ptr);
+void Free_Big_Num_Datas(big_num_datas_t *const big_num_datas_ptr);
+uint16_t Big_Nums_Oper_To_Buf(big_num_datas_t *const big_num_datas_ptr, const uint8_t big_num_arithmetic_oper, const char *const operand_str1,
+   const char *const operand_str2, const size_t num_precision_digits, char *const result_buf_ptr, const size_t result_buf_size, size_t *const result_len_ptr);
+uint16_t Big_Nums_Oper_Bin(big_num_datas_t *const big_num_datas_ptr, const uint8_t big_num_arithmetic_oper, const uint8_t *const operand_bin1,
+   const size_t operand_bin1_len, const uint8_t *const operand_bin2, const size_t operand_bin2_len, const size_t num_precision_digits,
+   uint8_t *const result_buf_ptr, const size_t result_buf_size, size_t *const result_len_ptr);
 char *Big_Nums_Sum(const char *const aug_str1, const char *const add_str2);
+char *Big_Nums_Sum_List(const char *const *const add_strs_ptr, const size_t num_add_strs);
 char *Big_Nums_Subtract(const char *const min_str1, const char *const subt_str2);
 char *Big_Nums_Multiply(const char *const mul_str1, const char *const mul_str2);
-char *Big_Nums_Division(const char *const dividend_str1, const char *const divisor_str2, const uint8_t num_precision_digits);
+char *Big_Nums_Division(const char *const dividend_str1, const char *const divisor_str2, const size_t num_precision_digits);
 char *Big_Nums_Modulus(const char *const dividend_str1, const char *const divisor_str2);
+uint8_t Small_Nums_Oper(big_num_t *const result_num_ptr, const uint8_t big_num_arithmetic_oper, const char *const operand_str1, const char *const operand_str2,
+   const size_t num_precision_digits);
+#ifdef BIG_NUM_DLIMB_SUPPORT
+uint8_t Small_Num_From_Str(small_num_t *const num_ptr, const char *const num_str);
+uint8_t Small_Num_Scale(small_num_t *const num_ptr, const size_t power);
+static inline big_num_dlimb_t Dlimb_Pow10(const size_t power);
+#endif
+uint16_t Bench_Small_Nums(void);
+uint16_t Self_Test(const size_t max_num_digits);
+uint16_t Self_Test_Oper(const uint8_t big_num_arithmetic_oper, const char *const operand_str1, const char *const operand_str2);
+char *Self_Test_Num_Str(char *const num_str, const size_t num_int_digits, const size_t num_frac_digits, const uint8_t sign_flag, uint64_t *const rand_state_ptr);
+uint16_t Self_Test_Check_Str(const char *const num_str, const size_t precision_digits);
+big_num_limb_t Self_Test_Residue(const char *const num_str, const size_t scale_digits, const big_num_limb_t prime);
+static inline big_num_limb_t Self_Test_Mul_Mod(const big_num_limb_t limb1, const big_num_limb_t limb2, const big_num_limb_t prime);
+int Self_Test_Cmp_Mag(const char *const num_str1, const char *const num_str2);
+uint16_t Self_Test_Bin(void);
+uint8_t Self_Test_Same_Num(const big_num_t *const num1_ptr, const big_num_t *const num2_ptr);
+uint16_t Self_Test_Format(const char *const num_str);
+uint16_t Self_Test_Files(const size_t num_digits, uint64_t *const rand_state_ptr);
+uint16_t Self_Test_Files_Cmp(const char *const file_name1, const char *const file_name2);
+uint16_t Big_Nums_Batch(const big_nums_batch_rec_t *const recs_ptr, const size_t num_recs, big_nums_batch_result_t *const results_ptr, char **const result_block_ptr_ptr);
+size_t Batch_Group_Key(const big_nums_batch_rec_t *const rec_ptr);
+void Set_Batch_Threads(const size_t num_threads, const uint8_t cpu_affinity_state);
+void Set_Mul_Threads(const size_t num_threads);
+size_t Num_Online_Cpus(void);
+void Trace_Error(const char *const format_str, ...);
+void Set_Trace_Error_Print(const uint8_t print_state);
+uint16_t Big_Nums_Batch_Parallel(const big_nums_batch_rec_t *const recs_ptr, const size_t num_recs, big_nums_batch_result_t *const results_ptr,
+   char **const result_block_ptr_ptr);
+uint64_t Batch_Rec_Cost(const big_nums_batch_rec_t *const rec_ptr);
+int Batch_Task_Cmp(const void *const task1_ptr, const void *const task2_ptr);
+#ifdef BIG_NUM_PTHREADS
+void *Batch_Worker(void *const worker_ptr);
+size_t Batch_Worker_Next_Task(batch_worker_t *const worker_ptr);
+#endif
+int Batch_Cli(const char *const input_file_name);
+uint8_t Batch_Cli_Parse_Line(char *const line_ptr, big_nums_batch_rec_t *const rec_ptr, const char **const parse_error_ptr_ptr);
+uint16_t Batch_Cli_Flush(batch_cli_recs_t *const cli_recs_ptr);
+uint8_t Big_Nums_Oper_From_Name(const char *const oper_name);
+uint16_t Precision_Digits_From_Str(const char *const num_str, size_t *const num_precision_digits_ptr);
+uint16_t Size_From_Str(const char *const num_str, const size_t max_value, size_t *const value_ptr);
+uint16_t Env_Options(void);
+uint16_t Big_Nums_Expr_Compile(expr_plan_t *const plan_ptr, const char *const expr_str, const size_t num_precision_digits);
+const big_num_t *Big_Nums_Expr_Run(expr_plan_t *const plan_ptr, const char *const *const var_strs_ptr);
+uint16_t Big_Nums_Expr_Eval(expr_plan_t *const plan_ptr, const char *const *const var_strs_ptr, char *const result_buf_ptr, const size_t result_buf_size,
+   size_t *const result_len_ptr);
+void Big_Nums_Expr_Free(expr_plan_t *const plan_ptr);
+size_t Big_Nums_Expr_Var_Index(const expr_plan_t *const plan_ptr, const char *const var_name);
+size_t Expr_Parse_Sum(expr_parser_t *const parser_ptr);
+size_t Expr_Parse_Product(expr_parser_t *const parser_ptr);
+size_t Expr_Parse_Unary(expr_parser_t *const parser_ptr);
+size_t Expr_Parse_Primary(expr_parser_t *const parser_ptr);
+size_t Expr_Add_Const(expr_parser_t *const parser_ptr, const char *const num_str, const size_t num_chars);
+size_t Expr_Emit(expr_parser_t *const parser_ptr, const uint8_t big_num_arithmetic_oper, const size_t reg1, const size_t reg2);
+static inline size_t Expr_Reg_Pos(const size_t reg, const size_t num_vars, const size_t num_consts);
+int Expr_Cli(const char *const expr_str, const size_t num_precision_digits);
+int Sum_Cli(const char *const input_file_name);
+uint16_t Operand_File_Open(operand_file_t *const operand_file_ptr, const char *const file_name);
+void Operand_File_Close(operand_file_t *const operand_file_ptr);
+void Operand_File_Drop(operand_file_t *const operand_file_ptr, const char *const end_ptr);
+uint16_t Big_Nums_Files(const uint8_t big_num_arithmetic_oper, const char *const operand_file_name1, const char *const operand_file_name2,
+   const char *const result_file_name, const size_t num_precision_digits);
+
+static inline unsigned int Limb_Count_Leading_Zeros(const big_num_limb_t limb);
+static inline big_num_limb_t Limb_Mul_Full(const big_num_limb_t limb1, const big_num_limb_t limb2, big_num_limb_t *const high_limb_ptr);
+static inline big_num_limb_t Limb_Div_2by1(const big_num_limb_t high_limb, const big_num_limb_t low_limb, const big_num_limb_t divisor, big_num_limb_t *const rem_ptr);
+big_num_limb_t Limbs_Add_N(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs1_ptr, const big_num_limb_t *const limbs2_ptr, const size_t num_limbs);
+#ifdef BIG_NUM_X86_64_KERNELS
+uint8_t Cpu_Has_Avx2(void);
+big_num_limb_t Limbs_Add_N_Avx2(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs1_ptr, const big_num_limb_t *const limbs2_ptr, const size_t num_limbs);
+big_num_limb_t Limbs_Sub_N_Avx2(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs1_ptr, const big_num_limb_t *const limbs2_ptr, const size_t num_limbs);
+#endif
+big_num_limb_t Limbs_Add(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs1_ptr, const size_t num_limbs1, const big_num_limb_t *const limbs2_ptr, const size_t num_limbs2);
+big_num_limb_t Limbs_Add_1(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs_ptr, const size_t num_limbs, const big_num_limb_t limb);
+big_num_limb_t Limbs_Sub_N(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs1_ptr, const big_num_limb_t *const limbs2_ptr, const size_t num_limbs);
+big_num_limb_t Limbs_Sub(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs1_ptr, const size_t num_limbs1, const big_num_limb_t *const limbs2_ptr, const size_t num_limbs2);
+big_num_limb_t Limbs_Sub_1(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs_ptr, const size_t num_limbs, const big_num_limb_t limb);
+big_num_limb_t Limbs_Mul_1(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs_ptr, const size_t num_limbs, const big_num_limb_t multiplier);
+big_num_limb_t Limbs_Addmul_1(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs_ptr, const size_t num_limbs, const big_num_limb_t multiplier);
+big_num_limb_t Limbs_Submul_1(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs_ptr, const size_t num_limbs, const big_num_limb_t multiplier);
+big_num_limb_t Limbs_Lshift(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs_ptr, const size_t num_limbs, const unsigned int shift_bits);
+big_num_limb_t Limbs_Rshift(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs_ptr, const size_t num_limbs, const unsigned int shift_bits);
+int Limbs_Cmp(const big_num_limb_t *const limbs1_ptr, const big_num_limb_t *const limbs2_ptr, const size_t num_limbs);
+size_t Limbs_Normalized_Len(const big_num_limb_t *const limbs_ptr, size_t num_limbs);
+void Limbs_Mul_Basecase(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs1_ptr, const size_t num_limbs1, const big_num_limb_t *const limbs2_ptr, const size_t num_limbs2);
+uint8_t Limbs_Abs_Diff(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs1_ptr, const size_t num_limbs1, const big_num_limb_t *const limbs2_ptr, const size_t num_limbs2);
+size_t Limbs_Mul_N_Scratch_Size(const size_t num_limbs);
+void Limbs_Mul_N(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs1_ptr, const big_num_limb_t *const limbs2_ptr, const size_t num_limbs, big_num_limb_t *const scratch_ptr);
+void Limbs_Mul_Karatsuba(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs1_ptr, const big_num_limb_t *const limbs2_ptr, const size_t num_limbs, big_num_limb_t *const scratch_ptr);
+void Limbs_Twos_Neg(big_num_limb_t *const limbs_ptr, const size_t num_limbs);
+void Limbs_Twos_Divexact_1(big_num_limb_t *const limbs_ptr, const size_t num_limbs, const big_num_limb_t divisor);
+void Limbs_Twos_Submul_1(big_num_limb_t *const result_ptr, const size_t num_result_limbs, const big_num_limb_t *const limbs_ptr, const size_t num_limbs, const big_num_limb_t multiplier);
+void Limbs_Toom_Eval(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs_ptr, const size_t part_len, const size_t last_part_len, const size_t num_parts,
+   const size_t first_part, const big_num_limb_t point);
+uint8_t Limbs_Toom_Eval_Pm(big_num_limb_t *const pos_ptr, big_num_limb_t *const neg_ptr, big_num_limb_t *const temp_ptr, const big_num_limb_t *const limbs_ptr, const size_t part_len,
+   const size_t last_part_len, const size_t num_parts, const big_num_limb_t point);
+void Limbs_Toom_Add_Coeff(big_num_limb_t *const result_ptr, const size_t num_result_limbs, const big_num_limb_t *const coeff_ptr, const size_t num_coeff_limbs);
+void Limbs_Mul_Toom3(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs1_ptr, const big_num_limb_t *const limbs2_ptr, const size_t num_limbs, big_num_limb_t *const scratch_ptr);
+void Limbs_Mul_Toom4(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs1_ptr, const big_num_limb_t *const limbs2_ptr, const size_t num_limbs, big_num_limb_t *const scratch_ptr);
+size_t Par_Num_Tasks(const size_t num_items, const size_t min_items);
+void Par_Run(void (*const task_func)(void *const task_ctx_ptr, const size_t task_index), void *const task_ctx_ptr, const size_t num_tasks);
+#ifdef BIG_NUM_PTHREADS
+void Par_Run_Tasks(par_run_t *const par_run_ptr);
+void *Par_Thread(void *const par_run_ptr);
+#endif
+void Limbs_Mul_N_Tasks(limbs_mul_task_t *const tasks_ptr, const size_t num_tasks, big_num_limb_t *const scratch_ptr);
+void Limbs_Mul_N_Task(void *const tasks_ptr, const size_t task_index);
+uint8_t Limbs_Mul_Chunks_Par(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs1_ptr, const size_t num_limbs1, const big_num_limb_t *const limbs2_ptr,
+   const size_t num_limbs2);
+void Limbs_Mul_Chunks_Task(void *const mul_chunks_ptr, const size_t task_index);
+static inline big_num_limb_t Limb_Mont_Mul(const big_num_limb_t limb1, const big_num_limb_t limb2, const ntt_prime_t *const ntt_prime_ptr);
+static inline big_num_limb_t Limb_Shoup_Mul(const big_num_limb_t limb, const big_num_limb_t root, const big_num_limb_t root_quot, const big_num_limb_t prime);
+static inline big_num_limb_t Limb_Mod_Add(const big_num_limb_t limb1, const big_num_limb_t limb2, const big_num_limb_t modulus);
+static inline big_num_limb_t Limb_Mod_Sub(const big_num_limb_t limb1, const big_num_limb_t limb2, const big_num_limb_t modulus);
+void Ntt_Init_Prime(ntt_prime_t *const ntt_prime_ptr, const big_num_limb_t prime, const big_num_limb_t generator);
+big_num_limb_t Ntt_Pow_Mod(const big_num_limb_t mont_base, big_num_limb_t exponent, const ntt_prime_t *const ntt_prime_ptr);
+void Ntt_Forward_Level(big_num_limb_t *const coeffs_ptr, const size_t block_len, const big_num_limb_t *const roots_ptr, const size_t root_step,
+   const big_num_limb_t prime, const size_t first_butterfly, const size_t end_butterfly);
+void Ntt_Inverse_Level(big_num_limb_t *const coeffs_ptr, const size_t block_len, const big_num_limb_t *const roots_ptr, const size_t root_step,
+   const size_t transform_len, const big_num_limb_t prime, const size_t first_butterfly, const size_t end_butterfly);
+void Ntt_Forward(ntt_par_t *const ntt_par_ptr);
+void Ntt_Inverse(ntt_par_t *const ntt_par_ptr);
+void Ntt_Par_Stage(ntt_par_t *const ntt_par_ptr, const uint8_t stage, const size_t num_items, const size_t min_items);
+void Ntt_Par_Task(void *const ntt_par_ptr, const size_t task_index);
+uint16_t Limbs_Mul_Ntt(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs1_ptr, const size_t num_limbs1, const big_num_limb_t *const limbs2_ptr, const size_t num_limbs2);
+uint16_t Limbs_Mul(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs1_ptr, const size_t num_limbs1, const big_num_limb_t *const limbs2_ptr, const size_t num_limbs2);
+big_num_limb_t Limbs_Divmod_1(big_num_limb_t *const quot_ptr, const big_num_limb_t *const limbs_ptr, const size_t num_limbs, const big_num_limb_t divisor);
+big_num_limb_t Limbs_Mod_1(const big_num_limb_t *const limbs_ptr, const size_t num_limbs, const big_num_limb_t divisor);
+uint16_t Limbs_Mod(big_num_limb_t *const rem_ptr, const size_t num_rem_limbs, const big_num_limb_t *const divisor_ptr, const size_t num_divisor_limbs);
+uint16_t Limbs_Divrem(big_num_limb_t *const quot_ptr, big_num_limb_t *const rem_ptr, const big_num_limb_t *const dividend_ptr, const size_t num_dividend_limbs, const big_num_limb_t *const divisor_ptr, const size_t num_divisor_limbs,
+   const big_num_limb_t *const divisor_inverse_ptr);
+void Limbs_Div_Knuth(big_num_limb_t *const quot_ptr, big_num_limb_t *const rem_ptr, const size_t num_rem_limbs, const big_num_limb_t *const divisor_ptr, const size_t num_divisor_limbs);
+uint16_t Limbs_Invert(big_num_limb_t *const inverse_ptr, const big_num_limb_t *const divisor_ptr, const size_t num_limbs);
+uint16_t Limbs_Div_Reciprocal(big_num_limb_t *const quot_ptr, big_num_limb_t *const rem_ptr, const size_t num_rem_limbs, const big_num_limb_t *const divisor_ptr, const size_t num_divisor_limbs,
+   const big_num_limb_t *const divisor_inverse_ptr);
+uint16_t Limbs_Div_Newton(big_num_limb_t *const quot_ptr, big_num_limb_t *const rem_ptr, const size_t num_rem_limbs, const big_num_limb_t *const divisor_ptr, const size_t num_divisor_limbs,
+   const big_num_limb_t *const divisor_inverse_ptr);
+uint16_t Limbs_Div_Bz_N(big_num_limb_t *const quot_ptr, big_num_limb_t *const quot_high_ptr, big_num_limb_t *const rem_ptr, const big_num_limb_t *const divisor_ptr, const size_t num_limbs, big_num_limb_t *const scratch_ptr);
+uint16_t Limbs_Div_Bz(big_num_limb_t *const quot_ptr, big_num_limb_t *const rem_ptr, const size_t num_rem_limbs, const big_num_limb_t *const divisor_ptr, const size_t num_divisor_limbs);
+uint16_t Scratch_Arena_Resize(const size_t num_limbs);
+big_num_limb_t *Scratch_Map(const size_t num_limbs);
+void Scratch_Unmap(big_num_limb_t *const limb_ptr, const size_t num_limbs);
+big_num_limb_t *Scratch_Alloc(const size_t num_limbs);
+void Scratch_Free(big_num_limb_t *const scratch_ptr);
+
+void Big_Num_Init(big_num_t *const num_ptr);
+void Big_Num_Free(big_num_t *const num_ptr);
+uint16_t Big_Num_Reserve(big_num_t *const num_ptr, const size_t num_limbs);
+void Big_Num_Normalize(big_num_t *const num_ptr);
+void Big_Num_Swap(big_num_t *const num1_ptr, big_num_t *const num2_ptr);
+uint16_t Big_Num_Copy(big_num_t *const dest_num_ptr, const big_num_t *const src_num_ptr);
+uint16_t Big_Num_Is_Zero(const big_num_t *const num_ptr);
+uint16_t Big_Num_From_Str(big_num_t *const num_ptr, const char *const num_str);
+uint16_t Big_Num_From_Chars(big_num_t *const num_ptr, const char *const num_str, const size_t num_str_chars);
+uint16_t Big_Num_From_Mapped_Chars(big_num_t *const num_ptr, const char *const num_str, const size_t num_str_chars, operand_file_t *const operand_file_ptr);
+const big_num_t *Big_Num_Pow10_Level(const size_t level);
+const big_num_limb_t *Big_Num_Pow10_Level_Inverse(const size_t level);
+static inline void Pow10_Cache_Lock(void);
+static inline void Pow10_Cache_Unlock(void);
+uint16_t Pow10_Cache_Evict(const size_t num_bytes, const size_t num_new_entries);
+uint16_t Big_Num_Pow10(big_num_t *const result_num_ptr, const size_t power);
+void Big_Num_Pow10_Cache_Stats(pow10_cache_stats_t *const stats_ptr);
+void Big_Num_Pow10_Cache_Clear(void);
+void Big_Num_Scratch_Stats(scratch_arena_stats_t *const stats_ptr);
+uint16_t Big_Num_Scratch_Reserve(const size_t num_bytes);
+void Big_Num_Scratch_Release(void);
+size_t Dec_Str_Scan(const char *const digits_str, const size_t num_chars, size_t *const point_pos_ptr);
+static inline uint32_t Dec_Digits8_To_Value(const char *const digits_str);
+void Dec_Digits_To_Chunks(big_num_limb_t *const chunk_ptr, const char *const digits_str, const size_t num_chunks);
+#ifdef BIG_NUM_X86_64_KERNELS
+size_t Dec_Str_Scan_Avx2(const char *const digits_str, const size_t num_chars, size_t *const point_pos_ptr);
+void Dec_Digits_To_Chunks_Avx2(big_num_limb_t *const chunk_ptr, const char *const digits_str, const size_t num_chunks);
+#endif
+uint16_t Limbs_From_Dec_Chunks(big_num_limb_t *const result_ptr, size_t *const num_result_limbs_ptr, const big_num_limb_t *const chunk_ptr, const size_t num_chunks);
+uint16_t Limbs_To_Dec_Chunks(big_num_limb_t *const chunk_ptr, const size_t num_chunks, const big_num_limb_t *const limbs_ptr, const size_t num_limbs);
+char *Big_Num_Format(const big_num_t *const num_ptr, char *const result_buf_ptr, const size_t result_buf_size, size_t *const result_len_ptr);
+char *Dec_Chunks_Format(const big_num_limb_t *const chunk_ptr, size_t num_chunks, const size_t precision_digits, const uint8_t sign_flag,
+   char *const result_buf_ptr, const size_t result_buf_size, size_t *const result_len_ptr);
+void Dec_Chunks_Shift_Right(big_num_limb_t *const result_ptr, const big_num_limb_t *const chunk_ptr, const size_t num_chunks, const size_t shift_digits);
+static inline void Dec_Chunks_Add_Lazy(big_num_limb_t *const low_ptr, big_num_limb_t *const carries_ptr, const big_num_limb_t *const chunk_ptr, const size_t num_chunks);
+big_num_limb_t Dec_Chunks_Normalize(big_num_limb_t *const low_ptr, big_num_limb_t *const carries_ptr, const size_t num_chunks);
+char *Big_Num_To_Str(const big_num_t *const num_ptr);
+uint16_t Big_Num_Write(const big_num_t *const num_ptr, FILE *const out_file_ptr);
+uint16_t Dec_Chunks_Write(const big_num_limb_t *const chunk_ptr, size_t num_chunks, const size_t precision_digits, const uint8_t sign_flag, FILE *const out_file_ptr);
+static inline void Bin_Put_Limb(uint8_t *const bin_ptr, const big_num_limb_t limb);
+static inline big_num_limb_t Bin_Get_Limb(const uint8_t *const bin_ptr);
+static inline big_num_limb_t Bin_Checksum_Mix(big_num_limb_t checksum, const big_num_limb_t word);
+size_t Big_Num_Bin_Size(const big_num_t *const num_ptr);
+uint8_t *Big_Num_To_Bin(const big_num_t *const num_ptr, uint8_t *const result_buf_ptr, const size_t result_buf_size, size_t *const result_len_ptr);
+uint16_t Big_Num_From_Bin(big_num_t *const num_ptr, const uint8_t *const bin_ptr, const size_t bin_len);
+uint16_t Big_Num_To_Buf(const big_num_t *const num_ptr, char *const result_buf_ptr, const size_t result_buf_size, size_t *const result_len_ptr);
+uint16_t Big_Num_Mul_Pow10(big_num_t *const result_num_ptr, const big_num_t *const num_ptr, const size_t power);
+int Big_Num_Cmp_Mag(const big_num_t *const num1_ptr, const big_num_t *const num2_ptr);
+uint16_t Big_Num_Add_With_Sign(big_num_t *const result_num_ptr, const big_num_t *const num1_ptr, const big_num_t *const num2_ptr, const uint8_t num2_sign_flag);
+uint16_t Big_Num_Add(big_num_t *const result_num_ptr, const big_num_t *const num1_ptr, const big_num_t *const num2_ptr);
+uint16_t Big_Num_Subtract(big_num_t *const result_num_ptr, const big_num_t *const num1_ptr, const big_num_t *const num2_ptr);
+uint16_t Big_Num_Multiply(big_num_t *const result_num_ptr, const big_num_t *const num1_ptr, const big_num_t *const num2_ptr);
+uint16_t Big_Num_Divrem_Mag(big_num_t *const quot_num_ptr, big_num_t *const rem_num_ptr, const big_num_t *const num1_ptr, const big_num_t *const num2_ptr);
+uint16_t Big_Num_Mod_Mag(big_num_t *const num_ptr, const big_num_t *const divisor_num_ptr);
+uint16_t Big_Num_Division(big_num_t *const quot_num_ptr, const big_num_t *const num1_ptr, const big_num_t *const num2_ptr, const size_t num_precision_digits);
+uint16_t Big_Num_Modulus(big_num_t *const rem_num_ptr, const big_num_t *const num1_ptr, const big_num_t *const num2_ptr);
+uint16_t Big_Num_Add_Assign(big_num_t *const num_ptr, const big_num_t *const add_num_ptr);
+uint16_t Big_Num_Subtract_Assign(big_num_t *const num_ptr, const big_num_t *const subt_num_ptr);
+uint16_t Big_Num_Multiply_Assign(big_num_t *const num_ptr, const big_num_t *const mul_num_ptr);
+uint16_t Big_Num_Modulus_Assign(big_num_t *const num_ptr, const big_num_t *const divisor_num_ptr);
+uint16_t Big_Num_Oper(big_num_t *const result_num_ptr, const uint8_t big_num_arithmetic_oper, const big_num_t *const num1_ptr, const big_num_t *const num2_ptr,
+   const size_t num_precision_digits);
+void Big_Num_Acc_Init(big_num_acc_t *const acc_ptr);
+void Big_Num_Acc_Free(big_num_acc_t *const acc_ptr);
+uint16_t Big_Num_Acc_Reserve(big_num_acc_t *const acc_ptr, const size_t num_int_chunks, const size_t num_frac_chunks);
+uint16_t Big_Num_Acc_Add_Chars(big_num_acc_t *const acc_ptr, const char *const num_str, const size_t num_str_chars);
+uint16_t Big_Num_Acc_Add_Signed_Chars(big_num_acc_t *const acc_ptr, const char *const num_str, const size_t num_str_chars, const uint8_t negate_flag);
+uint16_t Big_Num_Acc_Add_Str(big_num_acc_t *const acc_ptr, const char *const num_str);
+uint16_t Big_Num_Acc_Normalize(big_num_acc_t *const acc_ptr);
+uint16_t Big_Num_Acc_Dec_Chunks(big_num_acc_t *const acc_ptr, big_num_limb_t **const chunk_ptr_ptr);
+uint16_t Big_Num_Acc_Value(big_num_acc_t *const acc_ptr, big_num_t *const num_ptr);
+char *Big_Num_Acc_Format(big_num_acc_t *const acc_ptr, char *const result_buf_ptr, const size_t result_buf_size, size_t *const result_len_ptr);
+uint16_t Big_Num_Acc_Write(big_num_acc_t *const acc_ptr, FILE *const out_file_ptr);
+
+/* 10 ^ power, for power = 0 to BIG_NUM_LIMB_DEC_DIGITS */
+const big_num_limb_t limb_power_of_10[BIG_NUM_LIMB_DEC_DIGITS + 1] =
+{
+	1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL, 1000000000ULL,
+	10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL, 100000000000000ULL, 1000000000000000ULL,
+	10000000000000000ULL, 100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL
+};
+
+/* operand str with more than max_operand_len chars is rejected */
+size_t max_operand_len = MAX_OPERAND_LEN;
+/* multiplication crossovers in num of limbs, which --tune varies to measure them */
+size_t karatsuba_threshold = KARATSUBA_THRESHOLD;
+size_t toom3_threshold = TOOM3_THRESHOLD;
+size_t toom4_threshold = TOOM4_THRESHOLD;
+size_t ntt_threshold = NTT_THRESHOLD;
+size_t bz_div_threshold = BZ_DIV_THRESHOLD;
+size_t newton_div_threshold = NEWTON_DIV_THRESHOLD;
+/* STATE_NO disables small num fast path, which --bench does to time big num path */
+uint8_t small_nums_fast_path_state = STATE_YES;
+/* num of threads of Big_Nums_Batch_Parallel(), where 0 is num of online CPUs, and STATE_YES pins its worker threads to CPUs */
+size_t batch_num_threads = BATCH_NUM_THREADS;
+uint8_t batch_cpu_affinity_state = STATE_NO;
+/* num of threads of a multiplication, where 0 is num of online CPUs, and STATE_YES in thread, that runs tasks of Par_Run()
+   or Big_Nums_Batch_Parallel(), so that its tasks are not split further */
+size_t mul_num_threads = MUL_NUM_THREADS;
+BIG_NUM_THREAD_LOCAL uint8_t par_nested_state = STATE_NO;
+/* STATE_NO keeps error message of Trace_Error() in trace_error_msg of thread, instead of printing it, which --batch does to
+   report error per record */
+uint8_t trace_error_print_state = STATE_YES;
+BIG_NUM_THREAD_LOCAL char trace_error_msg[TRACE_ERROR_MSG_SIZE];
+/* stdout buffer of --batch, which must last till exit */
+char batch_cli_out_buf[BATCH_CLI_IO_BUF_SIZE];
+/* STATE_NA till CPUID is checked by Cpu_Has_Avx2() */
+uint8_t cpu_avx2_state = STATE_NA;
+/* pow10_cache[level] is 10 ^ (BIG_NUM_LIMB_DEC_DIGITS * 2 ^ level), for level < pow10_cache_num_levels */
+big_num_t pow10_cache[POW10_CACHE_MAX_LEVELS];
+size_t pow10_cache_num_levels = 0;
+/* pow10_cache_inverses[level] is NULL, or Limbs_Invert() of normalized pow10_cache[level], as of Big_Num_Pow10_Level_Inverse() */
+big_num_limb_t *pow10_cache_inverses[POW10_CACHE_MAX_LEVELS];
+/* 10 ^ power entries of pow10 cache, and statistics of pow10 cache, which are guarded by pow10_cache_mutex with levels */
+pow10_cache_entry_t pow10_cache_entries[POW10_CACHE_MAX_ENTRIES];
+size_t pow10_cache_num_entries = 0;
+uint64_t pow10_cache_use_count = 0;
+pow10_cache_stats_t pow10_cache_stats = {0, 0, 0, 0, 0, 0, 0, POW10_CACHE_MAX_BYTES};
+#ifdef BIG_NUM_PTHREADS
+pthread_mutex_t pow10_cache_mutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+/* scratch arena of each thread, and max bytes of scratch arena of a thread */
+BIG_NUM_THREAD_LOCAL scratch_arena_t scratch_arena = {NULL_DATA_PTR, 0, 0, 0, 0, 0, 0};
+size_t scratch_arena_max_bytes = SCRATCH_ARENA_MAX_BYTES;
+/* NTT primes and their primitive roots. Product of primes is more than 2 ^ 183, so that coefficient of product upto 2 ^ 55 limbs is exact */
+const big_num_limb_t ntt_prime_datas[NTT_NUM_PRIMES][2] =
+{
+	{4179340454199820289ULL, 3}, {2485986994308513793ULL, 5}, {1945555039024054273ULL, 5}
+};
 /*------------------------------------------------------------*
 FUNCTION NAME  : main
 
@@ -114,35 +903,112 @@ INPUT          :
 
 OUTPUT         :
 
-NOTE           :
+NOTE           : with --tune [header file name], measures crossovers of multiplication and division methods and writes them as header.
+                 With --bench, times small num operations by small num fast path and by big num path.
+                 With --selftest [max num digits], checks every operation at 1k, 100k and 10M digits by Self_Test().
+                 With --batch [input file name], does records of input file or of stdin by Batch_Cli(), without menu.
+                 With --files oper operand_file1 operand_file2 result_file [num_precision_digits], does oper of big nums in
+                 operand files by Big_Nums_Files().
+                 With --expr expression [num_precision_digits], evaluates expression for values of its variables in each
+                 line of stdin by Expr_Cli().
+                 With --sum [input file name], adds big num of each line of input file or of stdin by Sum_Cli().
+                 Options of environment variables are set by Env_Options() in every mode.
 
 Func ID        : 01.01
 
 BUGS           :
 -*------------------------------------------------------------*/
-int main()
+int main(int argc, char *argv[])
 {
-    char *result_ptr, read1_ptr[MAX_OPERAND_LEN], read2_ptr[MAX_OPERAND_LEN], choice_str[MAX_DATA_SIZE];
+    char *result_ptr, *read1_ptr = NULL_DATA_PTR, *read2_ptr = NULL_DATA_PTR, choice_str[MAX_DATA_SIZE];
 	double power, base, exponient;
    	int32_t int32_choice;
+	char *end_ptr;
+	unsigned long long selftest_max_digits;
+	size_t num_precision_digits = REQ_PRECISION_DIGITS;
+	uint8_t files_oper;
 
+	if((Env_Options()) != SUCCESS)
+	{
+		return FAILURE;
+	}
+	if(argc > 1 && strcmp(argv[1], "--tune") == 0)
+	{
+		// crossovers are of methods in one thread
+		Set_Mul_Threads(1);
+		return Tune_Thresholds((argc > 2) ? argv[2] : BIG_NUM_TUNE_HEADER_NAME);
+	}
+	if(argc > 1 && strcmp(argv[1], "--bench") == 0)
+	{
+		return Bench_Small_Nums();
+	}
+	if(argc > 1 && strcmp(argv[1], "--selftest") == 0)
+	{
+		selftest_max_digits = (argc > 2) ? strtoull(argv[2], &end_ptr, 10) : SELF_TEST_MAX_DIGITS;
+		if(argc > 2 && (argv[2][0] < '0' || argv[2][0] > '9' || *end_ptr != NULL_CHAR))
+		{
+			printf("usage : --selftest [max_num_digits] \n");
+			return FAILURE;
+		}
+		return Self_Test((selftest_max_digits < SIZE_MAX) ? (size_t)selftest_max_digits : SIZE_MAX);
+	}
+	if(argc > 1 && strcmp(argv[1], "--batch") == 0)
+	{
+		return Batch_Cli((argc > 2) ? argv[2] : NULL_DATA_PTR);
+	}
+	if(argc > 1 && strcmp(argv[1], "--files") == 0)
+	{
+		if(argc < 6 || (files_oper = Big_Nums_Oper_From_Name(argv[2])) == 0)
+		{
+			printf("usage : --files oper operand_file1 operand_file2 result_file [num_precision_digits] \n");
+			return FAILURE;
+		}
+		if(argc > 6 && (Precision_Digits_From_Str(argv[6], &num_precision_digits)) != SUCCESS)
+		{
+			fprintf(stderr, "files - num_precision_digits : %s is invalid or exceeds max operand len \n", argv[6]);
+			return FAILURE;
+		}
+		return Big_Nums_Files(files_oper, argv[3], argv[4], argv[5], num_precision_digits);
+	}
+	if(argc > 2 && strcmp(argv[1], "--expr") == 0)
+	{
+		if(argc > 3 && (Precision_Digits_From_Str(argv[3], &num_precision_digits)) != SUCCESS)
+		{
+			fprintf(stderr, "expr - num_precision_digits : %s is invalid or exceeds max operand len \n", argv[3]);
+			return BATCH_CLI_EXIT_IO_FAILED;
+		}
+		return Expr_Cli(argv[2], num_precision_digits);
+	}
+	if(argc > 1 && strcmp(argv[1], "--sum") == 0)
+	{
+		return Sum_Cli((argc > 2) ? argv[2] : NULL_DATA_PTR);
+	}
 	while(1)
 	{
+		// operands are allocated by Get_Input_Big_Str(), as per its length
+		free(read1_ptr);
+		free(read2_ptr);
+		read1_ptr = NULL_DATA_PTR;
+		read2_ptr = NULL_DATA_PTR;
+		if(feof(stdin))
+		{
+			return SUCCESS;
+		}
 		printf("\n 1 - Sum , 2 - Subtract, 3 - Multiply, 4 - Division, 5 - Modulus, 6 - Exit\n");
 		printf("Enter choice : ");
 		if((Get_Validate_Input_Number(&int32_choice, choice_str, MAX_DATA_SIZE, BIG_NUMS_SUM_OPER, EXIT_OPER)) != SUCCESS)
 		{
-			printf("ERR: Invalid big num operation \n");
+			Trace_Error("Invalid big num operation \n");
 			continue;
 		}
 		switch(int32_choice)
 		{
 			case BIG_NUMS_SUM_OPER:
 			   printf("Enter Augend in str = ");
-			   if((Get_Input_Str(read1_ptr, MAX_OPERAND_LEN)) != SUCCESS)
+			   if((Get_Input_Big_Str(&read1_ptr, max_operand_len)) != SUCCESS)
 		           continue;
 			   printf("Enter Addend in str = ");
-			   if((Get_Input_Str(read2_ptr, MAX_OPERAND_LEN)) != SUCCESS)
+			   if((Get_Input_Big_Str(&read2_ptr, max_operand_len)) != SUCCESS)
 		           continue;
 			   result_ptr = Big_Nums_Sum(read1_ptr, read2_ptr);
 	           if(result_ptr != NULL_DATA_PTR)
@@ -153,10 +1019,10 @@ int main()
 			break;
 			case BIG_NUMS_SUBTRACT_OPER:
 			   printf("Enter Minuend in str = ");
-			   if((Get_Input_Str(read1_ptr, MAX_OPERAND_LEN)) != SUCCESS)
+			   if((Get_Input_Big_Str(&read1_ptr, max_operand_len)) != SUCCESS)
 		           continue;
 			   printf("Enter Subtrahend in str = ");
-			    if((Get_Input_Str(read2_ptr, MAX_OPERAND_LEN)) != SUCCESS)
+			    if((Get_Input_Big_Str(&read2_ptr, max_operand_len)) != SUCCESS)
 		           continue;
 			   result_ptr = Big_Nums_Subtract(read1_ptr, read2_ptr);
 	           if(result_ptr != NULL_DATA_PTR)
@@ -167,10 +1033,10 @@ int main()
 			break;
 			case BIG_NUMS_MULTIPLY_OPER:
 			   printf("Enter Multiplicand in str = ");
-			   if((Get_Input_Str(read1_ptr, MAX_OPERAND_LEN)) != SUCCESS)
+			   if((Get_Input_Big_Str(&read1_ptr, max_operand_len)) != SUCCESS)
 		           continue;
 			   printf("Enter Multiplier in str = ");
-			   if((Get_Input_Str(read2_ptr, MAX_OPERAND_LEN)) != SUCCESS)
+			   if((Get_Input_Big_Str(&read2_ptr, max_operand_len)) != SUCCESS)
 		           continue;
 			   result_ptr = Big_Nums_Multiply(read1_ptr, read2_ptr);
 	           if(result_ptr != NULL_DATA_PTR)
@@ -181,10 +1047,10 @@ int main()
 			break;
 			case BIG_NUMS_DIVISION_OPER:
 			   printf("Enter Dividend in str = ");
-               if((Get_Input_Str(read1_ptr, MAX_OPERAND_LEN)) != SUCCESS)
+               if((Get_Input_Big_Str(&read1_ptr, max_operand_len)) != SUCCESS)
 		           continue;
 			   printf("Enter Divisor in str = ");
-			   if((Get_Input_Str(read2_ptr, MAX_OPERAND_LEN)) != SUCCESS)
+			   if((Get_Input_Big_Str(&read2_ptr, max_operand_len)) != SUCCESS)
 		           continue;
 			   result_ptr = Big_Nums_Division(read1_ptr, read2_ptr, REQ_PRECISION_DIGITS);
 	           if(result_ptr != NULL_DATA_PTR)
@@ -195,10 +1061,10 @@ int main()
 			break;
 			case BIG_NUMS_MODULUS_OPER:
 			   printf("Enter Dividend in str = ");
-			   if((Get_Input_Str(read1_ptr, MAX_OPERAND_LEN)) != SUCCESS)
+			   if((Get_Input_Big_Str(&read1_ptr, max_operand_len)) != SUCCESS)
 		           continue;
 			   printf("Enter Divisor in str = ");
-			   if((Get_Input_Str(read2_ptr, MAX_OPERAND_LEN)) != SUCCESS)
+			   if((Get_Input_Big_Str(&read2_ptr, max_operand_len)) != SUCCESS)
 		           continue;
 			   result_ptr = Big_Nums_Modulus(read1_ptr, read2_ptr);
 	           if(result_ptr != NULL_DATA_PTR)
@@ -234,15 +1100,17 @@ BUGS           :
 -*------------------------------------------------------------*/
 uint16_t Str_to_Num_Conv( void *const num_conv_from_str_ptr, const char *const num_in_str)
 {
-	 int32_t num = 0, *num_conv_from_str;
-	 uint32_t place;
+	 int64_t num = 0;
+	 int32_t *num_conv_from_str;
+	 uint64_t place;
 	 int16_t cur_unit;
-	 uint8_t num_chars = 0, base = 10, pos = 0, start_num_pos = 0 ;
+	 size_t num_chars = 0, pos = 0, start_num_pos = 0;
+	 uint8_t base = 10;
 
 	 if(num_conv_from_str_ptr == NULL_DATA_PTR || num_in_str == NULL_DATA_PTR )
 	 {
 		 #ifdef TRACE_ERROR
-		   printf("ERR: data are null ptr \n");
+		   Trace_Error("data are null ptr \n");
 		#endif
 		return FAILURE;
 	 }
@@ -259,7 +1127,7 @@ uint16_t Str_to_Num_Conv( void *const num_conv_from_str_ptr, const char *const n
 	 else
 	 {
     	 #ifdef TRACE_ERROR
-		    printf("ERR: invalid char: %c \n", num_in_str[0]);
+		    Trace_Error("invalid char: %c \n", num_in_str[0]);
 		 #endif
          return FAILURE;
 	 }
@@ -267,30 +1135,45 @@ uint16_t Str_to_Num_Conv( void *const num_conv_from_str_ptr, const char *const n
 	 if(num_chars == 0)
 	 {
 		 #ifdef TRACE_ERROR
-		    printf("ERR: data empty \n");
+		    Trace_Error("data empty \n");
+		 #endif
+         return FAILURE;
+	 }
+	 // more than 10 digits exceeds int32_t range, and also Power_Of() range
+	 if(num_chars > 10)
+	 {
+		 #ifdef TRACE_ERROR
+		    Trace_Error("data exceeds range \n");
 		 #endif
          return FAILURE;
 	 }
 	 pos = start_num_pos;
-     for( place = Power_Of(base, num_chars - 1); place >= 1; place /= base, ++pos )
+     for( place = Power_Of(base, (uint8_t)(num_chars - 1)); place >= 1; place /= base, ++pos )
      {
      	 cur_unit = num_in_str[pos] - '0';
     	 if(cur_unit < 0 ||  cur_unit > 9 )
     	 {
 	    	 #ifdef TRACE_ERROR
-		       printf("ERR: invalid char at data[%d] = %c \n", pos, num_in_str[pos]);
+		       Trace_Error("invalid char at data[%lu] = %c \n", (unsigned long)pos, num_in_str[pos]);
 		     #endif
              return FAILURE;
 	     }
-         num += (cur_unit * place);
+         num += (int64_t)(cur_unit * place);
      }
+	 if(num > INT32_MAX)
+	 {
+		 #ifdef TRACE_ERROR
+		    Trace_Error("data exceeds range \n");
+		 #endif
+         return FAILURE;
+	 }
 	 if(num_in_str[0] == '-')
 	 {
-		 *num_conv_from_str = -num;
+		 *num_conv_from_str = (int32_t)-num;
 	 }
 	 else
 	 {
-	     *num_conv_from_str = num;
+	     *num_conv_from_str = (int32_t)num;
 	 }
 	 return SUCCESS;
 }
@@ -302,17 +1185,17 @@ DESCRIPTION    :
 
 INPUT          :
 
-OUTPUT         :
+OUTPUT         : returns base ^ power, or 0 if it exceeds uint64_t
 
-NOTE           :
+NOTE           : powers of 10 beyond uint64_t are given as big num by Big_Num_Pow10()
 
 Func ID        : 02.10
 
 Bugs           :
 -*------------------------------------------------------------*/
-uint32_t Power_Of(const uint8_t base, const uint8_t power )
+uint64_t Power_Of(const uint8_t base, const uint8_t power )
 {
-    uint32_t power_val = 1;
+    uint64_t power_val = 1;
     uint8_t i = 0;
 
     if(power == 0)
@@ -321,6 +1204,13 @@ uint32_t Power_Of(const uint8_t base, const uint8_t power )
     }
     for(i = 1; i <= power; ++i)
     {
+      if(base != 0 && power_val > UINT64_MAX / base)
+      {
+         #ifdef TRACE_ERROR
+		    Trace_Error("power of %u ^ %u exceeds range \n", (unsigned int)base, (unsigned int)power);
+		 #endif
+         return 0;
+      }
       power_val *= base;
     }
     return power_val;
@@ -341,11 +1231,11 @@ Func ID        : 01.02
 
 BUGS           :
 -*------------------------------------------------------------*/
-uint16_t Get_Validate_Input_Number(void *const input_num_ptr, char *const input_str_ptr, const unsigned int input_str_max_chars, const int32_t valid_min_value, const int32_t valid_max_value)
+uint16_t Get_Validate_Input_Number(void *const input_num_ptr, char *const input_str_ptr, const size_t input_str_max_chars, const int32_t valid_min_value, const int32_t valid_max_value)
 {
 	int32_t temp_int, *int32_input_num_ptr;
 
-	if(int32_input_num_ptr == NULL_DATA_PTR)
+	if(input_num_ptr == NULL_DATA_PTR)
 	{
 		return FAILURE;
 	}
@@ -366,7 +1256,7 @@ uint16_t Get_Validate_Input_Number(void *const input_num_ptr, char *const input_
 	if(temp_int < valid_min_value || temp_int > valid_max_value)
 	{
 		 #ifdef TRACE_ERROR
-		      printf("ERR: input data - %d, out of range [%d,%d] \n", temp_int, valid_min_value, valid_max_value);
+		      Trace_Error("input data - %d, out of range [%d,%d] \n", temp_int, valid_min_value, valid_max_value);
 		 #endif
 		 return FAILURE;
 	}
@@ -388,10 +1278,10 @@ Func ID        : 01.02
 
 BUGS           :
 -*------------------------------------------------------------*/
-uint16_t Get_Input_Str(char *const input_str_ptr, const unsigned int input_str_max_chars)
+uint16_t Get_Input_Str(char *const input_str_ptr, const size_t input_str_max_chars)
 {
-    unsigned int input_str_num_chars = 0;
-	char rcvd_char;
+    size_t input_str_num_chars = 0;
+	int rcvd_char;
 
     if(input_str_ptr == NULL_DATA_PTR || input_str_max_chars <= 1)
 	{
@@ -400,10 +1290,13 @@ uint16_t Get_Input_Str(char *const input_str_ptr, const unsigned int input_str_m
     memset(input_str_ptr, NULL_CHAR, input_str_max_chars);
 	while (1)
 	{
-		rcvd_char = (char) getchar();
+		rcvd_char = getchar();
 		//scanf("%c", &rcvd_char);
 		switch(rcvd_char)
         {
+			case EOF:
+			   memset(input_str_ptr, NULL_CHAR, input_str_max_chars);
+			   return FAILURE;
 			case '\b':
               if(input_str_num_chars > 0)
 			  {
@@ -421,12 +1314,12 @@ uint16_t Get_Input_Str(char *const input_str_ptr, const unsigned int input_str_m
             default:
      			if(input_str_num_chars + 1 < input_str_max_chars )
     		    {
-		    	   input_str_ptr[input_str_num_chars] = rcvd_char;
+		    	   input_str_ptr[input_str_num_chars] = (char)rcvd_char;
                    ++input_str_num_chars;
 	    		}
 		    	else
 			    {
-			       printf("ERR: Input data num chars exceeds max chars : %u \n", input_str_max_chars - 1);
+			       Trace_Error("Input data num chars exceeds max chars : %lu \n", (unsigned long)(input_str_max_chars - 1));
 			       memset(input_str_ptr, NULL_CHAR, input_str_max_chars);
 				   fflush(stdin);
 				   return FAILURE;
@@ -436,2138 +1329,10679 @@ uint16_t Get_Input_Str(char *const input_str_ptr, const unsigned int input_str_m
 	return SUCCESS;
 }
 /*------------------------------------------------------------*
-FUNCTION NAME  : Swap_Two_Datas
+FUNCTION NAME  : Get_Input_Big_Str
 
-DESCRIPTION    :
+DESCRIPTION    : reads a line of input str, whose memory grows as per num of chars read, till input_str_max_chars chars
 
 INPUT          :
 
 OUTPUT         :
 
-NOTE           :
+NOTE           : On success, caller is responsible for freeing *input_str_ptr_ptr.
 
-Func ID        : 01.02
+Func ID        : 01.06
 
 BUGS           :
 -*------------------------------------------------------------*/
-uint16_t Swap_Two_Datas(void *const data1, void *const data2, const uint8_t data_size)
+uint16_t Get_Input_Big_Str(char **const input_str_ptr_ptr, const size_t input_str_max_chars)
 {
-	char temp[MAX_DATA_SIZE];
+	char *input_str_ptr, *temp_str_ptr;
+	size_t input_str_num_chars = 0, input_str_alloc_size = INIT_INPUT_STR_ALLOC_SIZE;
+	int rcvd_char;
 
-	if(data1 == NULL_DATA_PTR || data2 == NULL_DATA_PTR)
+	if(input_str_ptr_ptr == NULL_DATA_PTR || input_str_max_chars == 0)
 	{
 		return FAILURE;
 	}
-	if(data_size == 0)
+	*input_str_ptr_ptr = NULL_DATA_PTR;
+	input_str_ptr = malloc(input_str_alloc_size);
+	if(input_str_ptr == NULL_DATA_PTR)
 	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("input str - memory alloc failed \n");
+		#endif
 		return FAILURE;
 	}
-    memcpy(temp, data1, data_size);
-    memcpy(data1, data2, data_size);
-    memcpy(data2, temp, data_size);
+	while (1)
+	{
+		rcvd_char = getchar();
+		switch(rcvd_char)
+        {
+			case EOF:
+			   free(input_str_ptr);
+			   return FAILURE;
+			case '\b':
+              if(input_str_num_chars > 0)
+			  {
+				  --input_str_num_chars;
+			  }
+			break;
+            case '\n':
+			   if(input_str_num_chars != 0)
+			   {
+			      input_str_ptr[input_str_num_chars] = NULL_CHAR;
+				  *input_str_ptr_ptr = input_str_ptr;
+			      return SUCCESS;
+			   }
+            break;
+            default:
+			   if(input_str_num_chars >= input_str_max_chars)
+			   {
+			       Trace_Error("Input data num chars exceeds max chars : %lu \n", (unsigned long)input_str_max_chars);
+				   free(input_str_ptr);
+				   // discard rest of line
+				   while(rcvd_char != '\n' && rcvd_char != EOF)
+				   {
+					   rcvd_char = getchar();
+				   }
+				   return FAILURE;
+			   }
+			   if(input_str_num_chars + 1 >= input_str_alloc_size)
+			   {
+				   input_str_alloc_size *= 2;
+				   if(input_str_alloc_size > input_str_max_chars + 1)
+				   {
+					   input_str_alloc_size = input_str_max_chars + 1;
+				   }
+				   temp_str_ptr = realloc(input_str_ptr, input_str_alloc_size);
+				   if(temp_str_ptr == NULL_DATA_PTR)
+				   {
+					   #ifdef TRACE_ERROR
+		                  Trace_Error("input str - memory alloc failed \n");
+		               #endif
+					   free(input_str_ptr);
+					   return FAILURE;
+				   }
+				   input_str_ptr = temp_str_ptr;
+			   }
+			   input_str_ptr[input_str_num_chars] = (char)rcvd_char;
+			   ++input_str_num_chars;
+		}
+	}
 	return SUCCESS;
 }
+
 /*------------------------------------------------------------*
-FUNCTION NAME  :  Validate_Big_Num_Data
+FUNCTION NAME  : Set_Max_Operand_Len
 
-DESCRIPTION    :
+DESCRIPTION    : sets max num of chars in operand str, that is accepted by Big_Nums_* operations
 
 INPUT          :
 
 OUTPUT         :
 
-NOTE           :  Caller is responsible for freeing memory.
+NOTE           : command line modes set it from MAX_OPERAND_LEN_ENV_NAME by Env_Options().
 
-Func ID        : 01.03
+Func ID        : 01.07
 
 BUGS           :
 -*------------------------------------------------------------*/
-uint16_t Validate_Big_Num_Data(const uint8_t big_num_arithmetic_oper, const uint8_t num_precision_digits, big_num_datas_t *const big_num_datas_ptr)
+void Set_Max_Operand_Len(const size_t max_len)
 {
-	const char *str1_ptr, *str2_ptr;
-	int16_t proc_str1_ptr_pos, proc_str2_ptr_pos, result_ptr_pos;
-	uint8_t proc_bit_field = 0, req_num_0_char_digits = 0;
+	max_operand_len = max_len;
+}
 
-	if((big_num_datas_ptr == NULL_DATA_PTR) || (big_num_datas_ptr->operand_str1 == NULL_DATA_PTR || big_num_datas_ptr->operand_str2 == NULL_DATA_PTR))
+/*------------------------------------------------------------*
+FUNCTION NAME  : Set_Pow10_Cache_Limit
+
+DESCRIPTION    : sets max bytes of pow10 cache, and evicts cached 10 ^ power entries to fit it
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           : levels needed by str conversion are kept, even if they exceed max bytes.
+
+Func ID        : 01.12
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Set_Pow10_Cache_Limit(const size_t max_bytes)
+{
+	Pow10_Cache_Lock();
+	pow10_cache_stats.max_cache_bytes = max_bytes;
+	Pow10_Cache_Evict(0, 0);
+	Pow10_Cache_Unlock();
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Set_Scratch_Arena_Limit
+
+DESCRIPTION    : sets max bytes, upto which scratch arena of a thread grows
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           : must not be called, while other threads use big nums. Arena already larger than max bytes is kept, till
+                 Big_Num_Scratch_Release(). Scratch, that does not fit in arena, is allocated from heap.
+
+Func ID        : 01.15
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Set_Scratch_Arena_Limit(const size_t max_bytes)
+{
+	scratch_arena_max_bytes = max_bytes;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Set_Batch_Threads
+
+DESCRIPTION    : sets num of threads of Big_Nums_Batch_Parallel(), and whether its worker threads are pinned to CPUs
+
+INPUT          : num_threads of 0 is num of online CPUs. cpu_affinity_state is STATE_YES or STATE_NO
+
+OUTPUT         :
+
+NOTE           : must not be called, while Big_Nums_Batch_Parallel() runs. Worker thread n is pinned to nth CPU, that
+                 calling thread may run on. CPU affinity is supported only on Linux, and is ignored elsewhere.
+
+Func ID        : 01.23
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Set_Batch_Threads(const size_t num_threads, const uint8_t cpu_affinity_state)
+{
+	batch_num_threads = num_threads;
+	batch_cpu_affinity_state = (cpu_affinity_state == STATE_YES) ? STATE_YES : STATE_NO;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Set_Mul_Threads
+
+DESCRIPTION    : sets num of threads, by which a large multiplication is done
+
+INPUT          : num_threads of 0 is num of online CPUs
+
+OUTPUT         :
+
+NOTE           : must not be called, while other threads use big nums. Product is same for any num of threads.
+                 Atmost PAR_MAX_THREADS threads are used, and only for stages of atleast PAR_MIN_GRAIN coeffs per thread.
+
+Func ID        : 01.29
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Set_Mul_Threads(const size_t num_threads)
+{
+	mul_num_threads = num_threads;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Num_Online_Cpus
+
+DESCRIPTION    : num of online CPUs
+
+INPUT          :
+
+OUTPUT         : returns atleast 1
+
+NOTE           : without pthreads, returns 1, as big nums are used by one thread.
+
+Func ID        : 01.30
+
+BUGS           :
+-*------------------------------------------------------------*/
+size_t Num_Online_Cpus(void)
+{
+	#ifdef BIG_NUM_PTHREADS
+	long num_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+	return (num_cpus > 0) ? (size_t)num_cpus : 1;
+	#else
+	return 1;
+	#endif
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Trace_Error
+
+DESCRIPTION    : reports error as "ERR: " followed by message of format_str and its args, as by printf()
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           : with trace_error_print_state of STATE_NO, message is not printed, but is kept in trace_error_msg of calling
+                 thread, without its trailing spaces and newline, and truncated to TRACE_ERROR_MSG_SIZE - 1 chars.
+
+Func ID        : 01.31
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Trace_Error(const char *const format_str, ...)
+{
+	va_list arg_list;
+	size_t msg_len;
+
+	va_start(arg_list, format_str);
+	if(trace_error_print_state == STATE_YES)
 	{
-		#ifdef TRACE_ERROR
-	      printf("ERR: operand_str1 or operand_str2 is null \n");
-		#endif
-		return FAILURE;
+		printf("ERR: ");
+		vprintf(format_str, arg_list);
 	}
-	big_num_datas_ptr->proc_str1_len = strlen(big_num_datas_ptr->operand_str1);
-	big_num_datas_ptr->proc_str2_len = strlen(big_num_datas_ptr->operand_str2);
-	big_num_datas_ptr->proc_str1_precision_digits = 0;
-	big_num_datas_ptr->proc_str2_precision_digits = 0;
-	big_num_datas_ptr->result_str_precision_digits = 0;
-	big_num_datas_ptr->result_ptr = NULL_DATA_PTR;
-	big_num_datas_ptr->proc_str1_ptr = NULL_DATA_PTR;
-	big_num_datas_ptr->proc_str2_ptr = NULL_DATA_PTR;
-	big_num_datas_ptr->result_alloc_size = 0;
-    if(big_num_datas_ptr->proc_str1_len == 0 || big_num_datas_ptr->proc_str2_len == 0)
+	else
 	{
-		#ifdef TRACE_ERROR
-		   printf("ERR: operand_str1 or operand_str2 is empty \n");
+		vsnprintf(trace_error_msg, TRACE_ERROR_MSG_SIZE, format_str, arg_list);
+		for(msg_len = strlen(trace_error_msg); msg_len > 0 && (trace_error_msg[msg_len - 1] == ' ' || trace_error_msg[msg_len - 1] == '\n'); --msg_len)
+		{
+			trace_error_msg[msg_len - 1] = NULL_CHAR;
+		}
+	}
+	va_end(arg_list);
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Set_Trace_Error_Print
+
+DESCRIPTION    : sets whether Trace_Error() prints error message, or keeps it in trace_error_msg of calling thread
+
+INPUT          : print_state is STATE_YES or STATE_NO
+
+OUTPUT         :
+
+NOTE           : must not be called, while other threads use big nums.
+
+Func ID        : 01.32
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Set_Trace_Error_Print(const uint8_t print_state)
+{
+	trace_error_print_state = (print_state == STATE_NO) ? STATE_NO : STATE_YES;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Tune_Thresholds
+
+DESCRIPTION    : measures crossovers of Karatsuba, Toom-3, Toom-4 and NTT multiplication, and of Burnikel-Ziegler and Newton division
+                 on this machine, and writes them as header
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           : each method is tuned after its lower method. A method's crossover is the first num of limbs, from which
+                 enabling it is faster than its lower method for two consecutive sizes. Division methods are tuned after
+                 multiplication methods, as they are built on multiplication.
+				 Compile with -DBIG_NUM_TUNE_HEADER to use generated header.
+
+Func ID        : 01.08
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Tune_Thresholds(const char *const header_file_name)
+{
+	size_t *const threshold_ptrs[] = {&karatsuba_threshold, &toom3_threshold, &toom4_threshold, &ntt_threshold, &bz_div_threshold, &newton_div_threshold};
+	const size_t min_thresholds[] = {8, 16, 16, 16, 4, 64}, max_thresholds[] = {256, 2048, 8192, 65536, 1024, 65536};
+	const char *const threshold_names[] = {"KARATSUBA_THRESHOLD", "TOOM3_THRESHOLD", "TOOM4_THRESHOLD", "NTT_THRESHOLD", "BZ_DIV_THRESHOLD",
+	   "NEWTON_DIV_THRESHOLD"};
+	/* index of first division method in threshold_ptrs */
+	const size_t div_method_index = 4;
+	FILE *header_file_ptr;
+	size_t num_limbs, method_index, crossover = 0;
+	double lower_time, method_time;
+	uint8_t num_faster;
+
+	karatsuba_threshold = SIZE_MAX;
+	toom3_threshold = SIZE_MAX;
+	toom4_threshold = SIZE_MAX;
+	ntt_threshold = SIZE_MAX;
+	bz_div_threshold = SIZE_MAX;
+	newton_div_threshold = SIZE_MAX;
+	for(method_index = 0; method_index < sizeof(threshold_ptrs) / sizeof(threshold_ptrs[0]); ++method_index)
+	{
+		num_faster = 0;
+		num_limbs = (method_index == 0 || method_index == div_method_index) ? min_thresholds[method_index] : *threshold_ptrs[method_index - 1];
+		if(num_limbs < min_thresholds[method_index])
+		{
+			num_limbs = min_thresholds[method_index];
+		}
+		for(; num_limbs < max_thresholds[method_index] && num_faster < 2; num_limbs += (num_limbs / 8 > 0) ? num_limbs / 8 : 1)
+		{
+			*threshold_ptrs[method_index] = SIZE_MAX;
+			lower_time = (method_index < div_method_index) ? Tune_Time_Mul(num_limbs) : Tune_Time_Div(num_limbs);
+			*threshold_ptrs[method_index] = num_limbs;
+			method_time = (method_index < div_method_index) ? Tune_Time_Mul(num_limbs) : Tune_Time_Div(num_limbs);
+			if(lower_time < 0 || method_time < 0)
+			{
+				return FAILURE;
+			}
+			num_faster = (method_time < lower_time) ? num_faster + 1 : 0;
+			if(num_faster == 1)
+			{
+				crossover = num_limbs;
+			}
+		}
+		*threshold_ptrs[method_index] = (num_faster < 2) ? max_thresholds[method_index] : crossover;
+		/* lower method is tuned with higher methods disabled, so crossovers are kept in increasing order */
+		if(method_index > 0 && method_index != div_method_index && *threshold_ptrs[method_index] < *threshold_ptrs[method_index - 1])
+		{
+			*threshold_ptrs[method_index] = *threshold_ptrs[method_index - 1];
+		}
+		printf("%s = %lu limbs\n", threshold_names[method_index], (unsigned long)*threshold_ptrs[method_index]);
+	}
+	if((header_file_ptr = fopen(header_file_name, "w")) == NULL_DATA_PTR)
+	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("unable to create tune header: %s \n", header_file_name);
 		#endif
 		return FAILURE;
 	}
-	if(big_num_datas_ptr->proc_str1_len == 1 && (big_num_datas_ptr->operand_str1[0] < '0' || big_num_datas_ptr->operand_str1[0] > '9'))
+	fprintf(header_file_ptr, "/* generated by --tune of big_num_arith.c. Crossovers of multiplication and division methods in num of limbs, measured on build machine */\n\n");
+	for(method_index = 0; method_index < sizeof(threshold_ptrs) / sizeof(threshold_ptrs[0]); ++method_index)
+	{
+		fprintf(header_file_ptr, "#ifndef %s\n   #define %s (%lu)\n#endif\n", threshold_names[method_index], threshold_names[method_index],
+		   (unsigned long)*threshold_ptrs[method_index]);
+	}
+	fclose(header_file_ptr);
+	return SUCCESS;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Tune_Time_Mul
+
+DESCRIPTION    : time taken by one num_limbs x num_limbs multiplication, with current crossovers
+
+INPUT          :
+
+OUTPUT         : returns time in seconds, or negative value on failure
+
+NOTE           : multiplication is repeated for atleast 20 ms of processor time
+
+Func ID        : 01.09
+
+BUGS           :
+-*------------------------------------------------------------*/
+double Tune_Time_Mul(const size_t num_limbs)
+{
+	big_num_limb_t *limbs_ptr;
+	size_t limb_pos, num_repeats = 0;
+	clock_t start_clock, elapsed_clock;
+
+	if((limbs_ptr = malloc(4 * num_limbs * sizeof(big_num_limb_t))) == NULL_DATA_PTR)
 	{
 		#ifdef TRACE_ERROR
-		   printf("ERR: operand_str1 has only non numeric char \n");
+		   Trace_Error("tune - memory alloc failed \n");
 		#endif
-		return FAILURE;
+		return -1.0;
+	}
+	for(limb_pos = 0; limb_pos < 2 * num_limbs; ++limb_pos)
+	{
+		limbs_ptr[limb_pos] = ((big_num_limb_t)rand() << 40) ^ ((big_num_limb_t)rand() << 20) ^ (big_num_limb_t)rand();
 	}
-	if(big_num_datas_ptr->proc_str2_len == 1 && (big_num_datas_ptr->operand_str2[0] < '0' || big_num_datas_ptr->operand_str2[0] > '9'))
+	start_clock = clock();
+	do
+	{
+		if(Limbs_Mul(limbs_ptr + 2 * num_limbs, limbs_ptr, num_limbs, limbs_ptr + num_limbs, num_limbs) != SUCCESS)
+		{
+			free(limbs_ptr);
+			return -1.0;
+		}
+		++num_repeats;
+		elapsed_clock = clock() - start_clock;
+	} while(elapsed_clock < CLOCKS_PER_SEC / 50);
+	free(limbs_ptr);
+	return (double)elapsed_clock / CLOCKS_PER_SEC / num_repeats;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Tune_Time_Div
+
+DESCRIPTION    : time taken by one (2 * num_limbs) / num_limbs division, with current crossovers
+
+INPUT          :
+
+OUTPUT         : returns time in seconds, or negative value on failure
+
+NOTE           : division is repeated for atleast 20 ms of processor time
+
+Func ID        : 01.10
+
+BUGS           :
+-*------------------------------------------------------------*/
+double Tune_Time_Div(const size_t num_limbs)
+{
+	big_num_limb_t *limbs_ptr;
+	size_t limb_pos, num_repeats = 0;
+	clock_t start_clock, elapsed_clock;
+
+	if((limbs_ptr = malloc((5 * num_limbs + 1) * sizeof(big_num_limb_t))) == NULL_DATA_PTR)
 	{
 		#ifdef TRACE_ERROR
-		   printf("ERR: operand_str2 has only non numeric char \n");
+		   Trace_Error("tune - memory alloc failed \n");
 		#endif
+		return -1.0;
+	}
+	for(limb_pos = 0; limb_pos < 3 * num_limbs; ++limb_pos)
+	{
+		limbs_ptr[limb_pos] = ((big_num_limb_t)rand() << 40) ^ ((big_num_limb_t)rand() << 20) ^ (big_num_limb_t)rand();
+	}
+	limbs_ptr[3 * num_limbs - 1] |= 1;
+	start_clock = clock();
+	do
+	{
+		if(Limbs_Divrem(limbs_ptr + 3 * num_limbs, limbs_ptr + 4 * num_limbs + 1, limbs_ptr, 2 * num_limbs, limbs_ptr + 2 * num_limbs, num_limbs, NULL_DATA_PTR) != SUCCESS)
+		{
+			free(limbs_ptr);
+			return -1.0;
+		}
+		++num_repeats;
+		elapsed_clock = clock() - start_clock;
+	} while(elapsed_clock < CLOCKS_PER_SEC / 50);
+	free(limbs_ptr);
+	return (double)elapsed_clock / CLOCKS_PER_SEC / num_repeats;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Swap_Two_Datas
+
+DESCRIPTION    :
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           :
+
+Func ID        : 01.02
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Swap_Two_Datas(void *const data1, void *const data2, const size_t data_size)
+{
+	char temp, *data1_ptr = (char *)data1, *data2_ptr = (char *)data2;
+	size_t data_pos;
+
+	if(data1 == NULL_DATA_PTR || data2 == NULL_DATA_PTR)
+	{
 		return FAILURE;
 	}
-    if(big_num_datas_ptr->operand_str1[0] == '-' || big_num_datas_ptr->operand_str1[0] == '+')
-    {
-        str1_ptr = big_num_datas_ptr->operand_str1 + 1;
-		--big_num_datas_ptr->proc_str1_len;
-    }
-    else
+	if(data_size == 0)
 	{
-		str1_ptr = big_num_datas_ptr->operand_str1;
+		return FAILURE;
 	}
-    if(big_num_datas_ptr->operand_str2[0] == '-' || big_num_datas_ptr->operand_str2[0] == '+')
-    {
-        str2_ptr = big_num_datas_ptr->operand_str2 + 1;
-        --big_num_datas_ptr->proc_str2_len;
-    }
-	else
+	// swapped byte by byte, as data_size is not limited to size of temp buffer
+	for(data_pos = 0; data_pos < data_size; ++data_pos)
+	{
+		temp = data1_ptr[data_pos];
+		data1_ptr[data_pos] = data2_ptr[data_pos];
+		data2_ptr[data_pos] = temp;
+	}
+	return SUCCESS;
+}
+/*------------------------------------------------------------*
+FUNCTION NAME  :  Validate_Big_Num_Data
+
+DESCRIPTION    :  validates operand_str1 and operand_str2, and converts them into limbs based proc_num1 and proc_num2
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           :  big num datas must be initialized by Init_Big_Num_Datas(), and limbs of proc_num1 and proc_num2 from earlier
+                  call are reused. On success, caller is responsible for freeing memory by Free_Big_Num_Datas().
+
+Func ID        : 01.03
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Validate_Big_Num_Data(const uint8_t big_num_arithmetic_oper, big_num_datas_t *const big_num_datas_ptr)
+{
+	if((big_num_datas_ptr == NULL_DATA_PTR) || (big_num_datas_ptr->operand_str1 == NULL_DATA_PTR || big_num_datas_ptr->operand_str2 == NULL_DATA_PTR))
 	{
-		str2_ptr = big_num_datas_ptr->operand_str2;
+		#ifdef TRACE_ERROR
+	      Trace_Error("operand_str1 or operand_str2 is null \n");
+		#endif
+		return FAILURE;
 	}
-    switch(big_num_arithmetic_oper)
+	big_num_datas_ptr->result_ptr = NULL_DATA_PTR;
+	if((Validate_Operand_Str(&big_num_datas_ptr->proc_num1, big_num_datas_ptr->operand_str1, "operand_str1")) != SUCCESS ||
+	   (Validate_Operand_Str(&big_num_datas_ptr->proc_num2, big_num_datas_ptr->operand_str2, "operand_str2")) != SUCCESS)
 	{
-		case BIG_NUMS_SUM_OPER:
-		case BIG_NUMS_SUBTRACT_OPER:
-		   for(proc_str1_ptr_pos = 0; proc_str1_ptr_pos < big_num_datas_ptr->proc_str1_len; ++proc_str1_ptr_pos)
-	       {
-	    	  if(str1_ptr[proc_str1_ptr_pos] != '0')
-		      {
-			      break;
-		      }
-	       }
-		   for(proc_str2_ptr_pos = 0; proc_str2_ptr_pos < big_num_datas_ptr->proc_str2_len; ++proc_str2_ptr_pos)
-	       {
-	    	  if(str2_ptr[proc_str2_ptr_pos] != '0')
-		      {
-			     break;
-		      }
-	       }
-		   if(proc_str1_ptr_pos == big_num_datas_ptr->proc_str1_len && proc_str2_ptr_pos == big_num_datas_ptr->proc_str2_len)
+		Free_Big_Num_Datas(big_num_datas_ptr);
+		return FAILURE;
+	}
+	switch(big_num_arithmetic_oper)
+	{
+		case BIG_NUMS_DIVISION_OPER:
+		case BIG_NUMS_MODULUS_OPER:
+		   if(big_num_arithmetic_oper == BIG_NUMS_MODULUS_OPER)
 		   {
-			   big_num_datas_ptr->result_alloc_size = 2;
-			   big_num_datas_ptr->result_ptr = calloc(big_num_datas_ptr->result_alloc_size, sizeof(char));
-			   if(big_num_datas_ptr->result_ptr == NULL_DATA_PTR)
+			   if(big_num_datas_ptr->proc_num1.precision_digits != 0 || big_num_datas_ptr->proc_num2.precision_digits != 0)
 			   {
 				   #ifdef TRACE_ERROR
-				       printf("ERR: memory allocation failed \n");
-				   #endif
+			         Trace_Error("%s or %s are non integer \n", big_num_datas_ptr->operand_str1, big_num_datas_ptr->operand_str2);
+			       #endif
+				   Free_Big_Num_Datas(big_num_datas_ptr);
 				   return FAILURE;
 			   }
-		       big_num_datas_ptr->result_ptr[0] = '0';
-		       big_num_datas_ptr->result_ptr[1] = NULL_CHAR;
-		       return SUCCESS;
-		   }
-		   if(proc_str1_ptr_pos != big_num_datas_ptr->proc_str1_len)
-		   {
-			   str1_ptr += proc_str1_ptr_pos;
-		   }
-		   else
-		   {
-			   str1_ptr += (big_num_datas_ptr->proc_str1_len - 1);
-		   }
-		   big_num_datas_ptr->proc_str1_len = strlen(str1_ptr);
-		   if(proc_str2_ptr_pos != big_num_datas_ptr->proc_str2_len)
-		   {
-			    str2_ptr += proc_str2_ptr_pos;
 		   }
-           else
+		   if(Big_Num_Is_Zero(&big_num_datas_ptr->proc_num2) == STATE_YES)
 		   {
-			   str2_ptr += (big_num_datas_ptr->proc_str2_len - 1);
-		   }
-           big_num_datas_ptr->proc_str2_len = strlen(str2_ptr);
-		break;
-		case BIG_NUMS_MULTIPLY_OPER:
-		   for(proc_str1_ptr_pos = 0; proc_str1_ptr_pos < big_num_datas_ptr->proc_str1_len; ++proc_str1_ptr_pos)
-	       {
-	    	  if(str1_ptr[proc_str1_ptr_pos] != '0')
-		      {
-			     break;
-		      }
-	       }
-	       if(proc_str1_ptr_pos == big_num_datas_ptr->proc_str1_len)
-	       {
-			   big_num_datas_ptr->result_alloc_size = 2;
-			   big_num_datas_ptr->result_ptr = calloc(big_num_datas_ptr->result_alloc_size, sizeof(char));
-			   if(big_num_datas_ptr->result_ptr == NULL_DATA_PTR)
+			   if(Big_Num_Is_Zero(&big_num_datas_ptr->proc_num1) == STATE_YES)
 			   {
-				   #ifdef TRACE_ERROR
-				       printf("ERR: memory allocation failed \n");
-				   #endif
-				   return FAILURE;
+				   Trace_Error("0 / 0 = indetermined \n");
 			   }
-		       big_num_datas_ptr->result_ptr[0] = '0';
-		       big_num_datas_ptr->result_ptr[1] = NULL_CHAR;
-		       return SUCCESS;
-	       }
-	       str1_ptr += proc_str1_ptr_pos;
-	       big_num_datas_ptr->proc_str1_len -= proc_str1_ptr_pos;
-	       for(proc_str2_ptr_pos = 0; proc_str2_ptr_pos < big_num_datas_ptr->proc_str2_len; ++proc_str2_ptr_pos)
-	       {
-	    	  if(str2_ptr[proc_str2_ptr_pos] != '0')
-		      {
-			     break;
-		      }
-	       }
-	       if(proc_str2_ptr_pos == big_num_datas_ptr->proc_str2_len)
-	       {
-		      big_num_datas_ptr->result_alloc_size = 2;
-			  big_num_datas_ptr->result_ptr = calloc(big_num_datas_ptr->result_alloc_size, sizeof(char));
-			  big_num_datas_ptr->result_ptr[0] = '0';
-			  big_num_datas_ptr->result_ptr[1] = NULL_CHAR;
-		      return SUCCESS;
-	      }
-	      big_num_datas_ptr->proc_str2_len -= proc_str2_ptr_pos;
-	      str2_ptr += proc_str2_ptr_pos;
-		break;
-        case BIG_NUMS_DIVISION_OPER:
-		case BIG_NUMS_MODULUS_OPER:
-		   for(proc_str2_ptr_pos = 0; proc_str2_ptr_pos < big_num_datas_ptr->proc_str2_len; ++proc_str2_ptr_pos)
-	       {
-	    	  if(str2_ptr[proc_str2_ptr_pos] != '0')
-		      {
-			     break;
-		      }
-	       }
-	       if(proc_str2_ptr_pos == big_num_datas_ptr->proc_str2_len)
-	       {
-		       proc_bit_field |= (1 << 0);
-	       }
-		   else
-		   {
-	           big_num_datas_ptr->proc_str2_len -= proc_str2_ptr_pos;
-	           str2_ptr += proc_str2_ptr_pos;
-		   }
-		   for(proc_str1_ptr_pos = 0; proc_str1_ptr_pos < big_num_datas_ptr->proc_str1_len; ++proc_str1_ptr_pos)
-	       {
-	    	   if(str1_ptr[proc_str1_ptr_pos] != '0')
-		       {
-			       break;
-		       }
-	       }
-	       if(proc_str1_ptr_pos == big_num_datas_ptr->proc_str1_len)
-	       {
-			   if((proc_bit_field & (1 << 0)))
+			   else
 			   {
-				   // 0/0
-				   printf("ERR: 0 / 0 = indetermined \n");
-				  return FAILURE;
+			       Trace_Error("%s / 0 = %s Infinity \n", big_num_datas_ptr->operand_str1,
+				      (big_num_datas_ptr->proc_num1.sign_flag == BIG_NUM_SIGN_NEGATIVE) ? "negative" : "positive");
 			   }
-			   big_num_datas_ptr->result_alloc_size = num_precision_digits + 1 + 1 + 1;
-	           big_num_datas_ptr->result_ptr = calloc(big_num_datas_ptr->result_alloc_size, sizeof(char));
-		       if(big_num_datas_ptr->result_ptr == NULL_DATA_PTR)
-		       {
-		        	#ifdef TRACE_ERROR
-		               printf("ERR: div - memory alloc failed \n");
-		            #endif
-			        return FAILURE;
-		        }
-		        for(result_ptr_pos = 0; result_ptr_pos < num_precision_digits + 1 + 1; ++result_ptr_pos)
-		        {
-			       if(result_ptr_pos == 1)
-			       {
-			        	big_num_datas_ptr->result_ptr[result_ptr_pos] = '.';
-				        continue;
-			       }
-			       big_num_datas_ptr->result_ptr[result_ptr_pos] = '0';
-		        }
-		        big_num_datas_ptr->result_ptr[result_ptr_pos] = NULL_CHAR;
-				return SUCCESS;
-	       }
-        break;
-    }
-	/* convert from ASCII string numbers, into numeric */
-	big_num_datas_ptr->proc_str1_ptr = malloc(big_num_datas_ptr->proc_str1_len + 1);
-	if(big_num_datas_ptr->proc_str1_ptr == NULL_DATA_PTR)
+			   Free_Big_Num_Datas(big_num_datas_ptr);
+			   return FAILURE;
+		   }
+		break;
+	}
+	#ifdef TRACE_DATA
+	   printf("TRA: proc_num1 limbs = %lu, proc_num2 limbs = %lu \n", (unsigned long)big_num_datas_ptr->proc_num1.num_limbs, (unsigned long)big_num_datas_ptr->proc_num2.num_limbs);
+	#endif
+	return SUCCESS;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  :  Validate_Operand_Str
+
+DESCRIPTION    :  validates operand str, and converts it into limbs based num
+
+INPUT          :  operand_name names operand in error message
+
+OUTPUT         :
+
+NOTE           :  operand str must not be empty, and must have atmost max_operand_len chars, as for every operand of
+                  Big_Nums_* operations, Validate_Big_Num_Data() and Big_Nums_Expr_Run(). Limbs of num are reused.
+
+Func ID        : 01.66
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Validate_Operand_Str(big_num_t *const num_ptr, const char *const operand_str, const char *const operand_name)
+{
+	if(operand_str == NULL_DATA_PTR || operand_str[0] == NULL_CHAR)
+	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("%s is null or empty \n", operand_name);
+		#endif
+		return FAILURE;
+	}
+	if(strlen(operand_str) > max_operand_len)
+	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("%s num chars exceeds max chars : %lu \n", operand_name, (unsigned long)max_operand_len);
+		#endif
+		return FAILURE;
+	}
+	if((Big_Num_From_Str(num_ptr, operand_str)) != SUCCESS)
+	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("%s : %s is invalid \n", operand_name, operand_str);
+		#endif
+		return FAILURE;
+	}
+	return SUCCESS;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  :  Init_Big_Num_Datas
+
+DESCRIPTION    :  initializes big num datas, with no limbs
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           :  big num datas can be reused by Big_Nums_Oper_To_Buf(), till Free_Big_Num_Datas().
+
+Func ID        : 01.13
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Init_Big_Num_Datas(big_num_datas_t *const big_num_datas_ptr)
+{
+	big_num_datas_ptr->operand_str1 = NULL_DATA_PTR;
+	big_num_datas_ptr->operand_str2 = NULL_DATA_PTR;
+	big_num_datas_ptr->result_ptr = NULL_DATA_PTR;
+	Big_Num_Init(&big_num_datas_ptr->proc_num1);
+	Big_Num_Init(&big_num_datas_ptr->proc_num2);
+	Big_Num_Init(&big_num_datas_ptr->result_num);
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  :  Free_Big_Num_Datas
+
+DESCRIPTION    :  frees proc_num1, proc_num2 and result_num of big num datas
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           :  result_ptr is not freed, as it is returned to caller.
+
+Func ID        : 01.05
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Free_Big_Num_Datas(big_num_datas_t *const big_num_datas_ptr)
+{
+	if(big_num_datas_ptr == NULL_DATA_PTR)
+	{
+		return;
+	}
+	Big_Num_Free(&big_num_datas_ptr->proc_num1);
+	Big_Num_Free(&big_num_datas_ptr->proc_num2);
+	Big_Num_Free(&big_num_datas_ptr->result_num);
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Nums_Multiply
+
+DESCRIPTION    :  Multiplies str1 and str2, and find result
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           :  Caller is responsible for freeing result memory. Small operands are found by Small_Nums_Oper().
+
+Func ID        : 01.03
+
+BUGS           :
+-*------------------------------------------------------------*/
+char *Big_Nums_Multiply(const char *const mul_str1, const char *const mul_str2)
+{
+    big_num_datas_t multiply_big_num_datas;
+	big_num_limb_t small_result_limbs[2];
+	big_num_t small_result_num = {small_result_limbs, 0, 2, 0, BIG_NUM_SIGN_POSITIVE};
+
+	#ifdef TRACE_FLOW
+	   printf("TRA: In Big num, %s * %s \n", mul_str1, mul_str2);
+	#endif
+	if((Small_Nums_Oper(&small_result_num, BIG_NUMS_MULTIPLY_OPER, mul_str1, mul_str2, 0)) == STATE_YES)
+	{
+		return Big_Num_To_Str(&small_result_num);
+	}
+	Init_Big_Num_Datas(&multiply_big_num_datas);
+	multiply_big_num_datas.operand_str1 = mul_str1;
+	multiply_big_num_datas.operand_str2 = mul_str2;
+	if((Validate_Big_Num_Data(BIG_NUMS_MULTIPLY_OPER, &multiply_big_num_datas)) != SUCCESS)
+    {
+		return NULL_DATA_PTR;
+	}
+	if((Big_Num_Multiply(&multiply_big_num_datas.result_num, &multiply_big_num_datas.proc_num1, &multiply_big_num_datas.proc_num2)) == SUCCESS)
+	{
+		multiply_big_num_datas.result_ptr = Big_Num_To_Str(&multiply_big_num_datas.result_num);
+	}
+	Free_Big_Num_Datas(&multiply_big_num_datas);
+	#ifdef TRACE_INFO
+	   printf("TRA: In Big num, %s * %s = %s \n", mul_str1, mul_str2, multiply_big_num_datas.result_ptr);
+	#endif
+	return multiply_big_num_datas.result_ptr;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Nums_Division
+
+DESCRIPTION    :  Divides str1 by str2, and result is truncated to num_precision_digits after '.' char
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           :  Caller is responsible for freeing result memory. Small operands are found by Small_Nums_Oper().
+
+Func ID        : 01.04
+
+BUGS           :
+-*------------------------------------------------------------*/
+char *Big_Nums_Division(const char *const dividend_str1, const char *const divisor_str2, const size_t num_precision_digits)
+{
+	big_num_datas_t division_big_num_datas;
+	big_num_limb_t small_result_limbs[2];
+	big_num_t small_result_num = {small_result_limbs, 0, 2, 0, BIG_NUM_SIGN_POSITIVE};
+
+	#ifdef TRACE_FLOW
+	   printf("TRA: In Big num, %s / %s \n", dividend_str1, divisor_str2);
+	#endif
+	if((Small_Nums_Oper(&small_result_num, BIG_NUMS_DIVISION_OPER, dividend_str1, divisor_str2, num_precision_digits)) == STATE_YES)
+	{
+		return Big_Num_To_Str(&small_result_num);
+	}
+	Init_Big_Num_Datas(&division_big_num_datas);
+	division_big_num_datas.operand_str1 = dividend_str1;
+	division_big_num_datas.operand_str2 = divisor_str2;
+	if((Validate_Big_Num_Data(BIG_NUMS_DIVISION_OPER, &division_big_num_datas)) != SUCCESS)
+    {
+		return NULL_DATA_PTR;
+	}
+	if((Big_Num_Division(&division_big_num_datas.result_num, &division_big_num_datas.proc_num1, &division_big_num_datas.proc_num2, num_precision_digits)) == SUCCESS)
+	{
+		division_big_num_datas.result_ptr = Big_Num_To_Str(&division_big_num_datas.result_num);
+	}
+	Free_Big_Num_Datas(&division_big_num_datas);
+	#ifdef TRACE_INFO
+	   printf("TRA: In Big num, %s / %s = %s \n", dividend_str1, divisor_str2, division_big_num_datas.result_ptr);
+	#endif
+    return division_big_num_datas.result_ptr;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Nums_Modulus
+
+DESCRIPTION    :  find remainder of str1 divided by str2. Sign of remainder is same as sign of str1.
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           :  Caller is responsible for freeing result memory. Small operands are found by Small_Nums_Oper().
+
+Func ID        : 01.04
+
+BUGS           :
+-*------------------------------------------------------------*/
+char *Big_Nums_Modulus(const char *const dividend_str1, const char *const divisor_str2)
+{
+	big_num_datas_t modulus_big_num_datas;
+	big_num_limb_t small_result_limbs[2];
+	big_num_t small_result_num = {small_result_limbs, 0, 2, 0, BIG_NUM_SIGN_POSITIVE};
+
+	#ifdef TRACE_FLOW
+	   printf("TRA: In Big num, %s %% %s \n", dividend_str1, divisor_str2);
+	#endif
+	if((Small_Nums_Oper(&small_result_num, BIG_NUMS_MODULUS_OPER, dividend_str1, divisor_str2, 0)) == STATE_YES)
+	{
+		return Big_Num_To_Str(&small_result_num);
+	}
+	Init_Big_Num_Datas(&modulus_big_num_datas);
+	modulus_big_num_datas.operand_str1 = dividend_str1;
+	modulus_big_num_datas.operand_str2 = divisor_str2;
+	if((Validate_Big_Num_Data(BIG_NUMS_MODULUS_OPER, &modulus_big_num_datas)) != SUCCESS)
+    {
+		return NULL_DATA_PTR;
+	}
+	if((Big_Num_Modulus(&modulus_big_num_datas.result_num, &modulus_big_num_datas.proc_num1, &modulus_big_num_datas.proc_num2)) == SUCCESS)
+	{
+		modulus_big_num_datas.result_ptr = Big_Num_To_Str(&modulus_big_num_datas.result_num);
+	}
+	Free_Big_Num_Datas(&modulus_big_num_datas);
+	#ifdef TRACE_INFO
+	   printf("TRA: In Big num, %s %% %s = %s \n", dividend_str1, divisor_str2, modulus_big_num_datas.result_ptr);
+	#endif
+    return modulus_big_num_datas.result_ptr;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Nums_Sum
+
+DESCRIPTION    :  find sum of two large numbers.
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           : Caller is responsible for freeing result memory. Small operands are found by Small_Nums_Oper().
+
+Func ID        : 01.04
+
+BUGS           :
+-*------------------------------------------------------------*/
+char *Big_Nums_Sum(const char *const aug_str1, const char *const add_str2)
+{
+    big_num_datas_t add_big_num_datas;
+	big_num_limb_t small_result_limbs[2];
+	big_num_t small_result_num = {small_result_limbs, 0, 2, 0, BIG_NUM_SIGN_POSITIVE};
+
+	#ifdef TRACE_FLOW
+	   printf("TRA: In Big num, %s + %s \n", aug_str1, add_str2);
+	#endif
+	if((Small_Nums_Oper(&small_result_num, BIG_NUMS_SUM_OPER, aug_str1, add_str2, 0)) == STATE_YES)
+	{
+		return Big_Num_To_Str(&small_result_num);
+	}
+	Init_Big_Num_Datas(&add_big_num_datas);
+	add_big_num_datas.operand_str1 = aug_str1;
+	add_big_num_datas.operand_str2 = add_str2;
+	if((Validate_Big_Num_Data(BIG_NUMS_SUM_OPER, &add_big_num_datas)) != SUCCESS)
+    {
+		return NULL_DATA_PTR;
+	}
+	if((Big_Num_Add(&add_big_num_datas.result_num, &add_big_num_datas.proc_num1, &add_big_num_datas.proc_num2)) == SUCCESS)
+	{
+		add_big_num_datas.result_ptr = Big_Num_To_Str(&add_big_num_datas.result_num);
+	}
+	Free_Big_Num_Datas(&add_big_num_datas);
+	#ifdef TRACE_INFO
+	   printf("TRA: In Big num, %s + %s = %s\n", aug_str1, add_str2, add_big_num_datas.result_ptr);
+	#endif
+	return  add_big_num_datas.result_ptr;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Nums_Sum_List
+
+DESCRIPTION    :  find sum of num_add_strs large numbers.
+
+INPUT          :
+
+OUTPUT         :  returns sum in allocated str, or NULL on failure
+
+NOTE           : Caller is responsible for freeing result memory. Numbers are added by accumulator of Big_Num_Acc_Add_Str(),
+                 whose carries are propagated and sum is formatted only once, so that sum is same as of Big_Nums_Sum() of
+                 each number, without converting every partial sum.
+
+Func ID        : 01.54
+
+BUGS           :
+-*------------------------------------------------------------*/
+char *Big_Nums_Sum_List(const char *const *const add_strs_ptr, const size_t num_add_strs)
+{
+	big_num_acc_t sum_acc;
+	char *result_ptr = NULL_DATA_PTR;
+	size_t str_pos, result_len;
+
+	if(add_strs_ptr == NULL_DATA_PTR)
+	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("sum list is null \n");
+		#endif
+		return NULL_DATA_PTR;
+	}
+	Big_Num_Acc_Init(&sum_acc);
+	for(str_pos = 0; str_pos < num_add_strs; ++str_pos)
+	{
+		if((Big_Num_Acc_Add_Str(&sum_acc, add_strs_ptr[str_pos])) != SUCCESS)
+		{
+			break;
+		}
+	}
+	if(str_pos == num_add_strs)
+	{
+		result_ptr = Big_Num_Acc_Format(&sum_acc, NULL_DATA_PTR, 0, &result_len);
+	}
+	Big_Num_Acc_Free(&sum_acc);
+	return result_ptr;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Nums_Subtract
+
+DESCRIPTION    :  find difference of two large numbers.
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           : Caller is responsible for freeing result memory. Small operands are found by Small_Nums_Oper().
+
+Func ID        : 01.04
+
+BUGS           :
+-*------------------------------------------------------------*/
+char *Big_Nums_Subtract(const char *const min_str1, const char *const subt_str2)
+{
+    big_num_datas_t subtract_big_num_datas;
+	big_num_limb_t small_result_limbs[2];
+	big_num_t small_result_num = {small_result_limbs, 0, 2, 0, BIG_NUM_SIGN_POSITIVE};
+
+    #ifdef TRACE_FLOW
+	    printf("TRA: In Big num, %s - %s \n", min_str1, subt_str2);
+    #endif
+	if((Small_Nums_Oper(&small_result_num, BIG_NUMS_SUBTRACT_OPER, min_str1, subt_str2, 0)) == STATE_YES)
+	{
+		return Big_Num_To_Str(&small_result_num);
+	}
+	Init_Big_Num_Datas(&subtract_big_num_datas);
+	subtract_big_num_datas.operand_str1 = min_str1;
+	subtract_big_num_datas.operand_str2 = subt_str2;
+	if((Validate_Big_Num_Data(BIG_NUMS_SUBTRACT_OPER, &subtract_big_num_datas)) != SUCCESS)
+    {
+		return NULL_DATA_PTR;
+	}
+	if((Big_Num_Subtract(&subtract_big_num_datas.result_num, &subtract_big_num_datas.proc_num1, &subtract_big_num_datas.proc_num2)) == SUCCESS)
+	{
+		subtract_big_num_datas.result_ptr = Big_Num_To_Str(&subtract_big_num_datas.result_num);
+	}
+	Free_Big_Num_Datas(&subtract_big_num_datas);
+	#ifdef TRACE_INFO
+	   printf("TRA: In Big num, %s - %s = %s\n", min_str1, subt_str2, subtract_big_num_datas.result_ptr);
+	#endif
+	return  subtract_big_num_datas.result_ptr;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Nums_Oper_To_Buf
+
+DESCRIPTION    :  finds operand_str1 oper operand_str2, into caller's result buf of result_buf_size chars
+
+INPUT          :  big_num_datas_ptr is initialized by Init_Big_Num_Datas(), and is used for every call, till Free_Big_Num_Datas().
+                  num_precision_digits is used only by BIG_NUMS_DIVISION_OPER
+
+OUTPUT         :  result_len_ptr has num of chars of result, without null char. If result buf is small, result_len_ptr still
+                  has num of chars of result.
+
+NOTE           :  limbs of operands and result in big num datas are reused from earlier calls, so that no memory is allocated,
+                  once limbs are enough, for nums upto BIG_NUM_STACK_LIMBS limbs. Small operands are found by Small_Nums_Oper(),
+                  without big num datas.
+
+Func ID        : 01.14
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Big_Nums_Oper_To_Buf(big_num_datas_t *const big_num_datas_ptr, const uint8_t big_num_arithmetic_oper, const char *const operand_str1,
+   const char *const operand_str2, const size_t num_precision_digits, char *const result_buf_ptr, const size_t result_buf_size, size_t *const result_len_ptr)
+{
+	big_num_limb_t small_result_limbs[2];
+	big_num_t small_result_num = {small_result_limbs, 0, 2, 0, BIG_NUM_SIGN_POSITIVE};
+
+	if(big_num_datas_ptr == NULL_DATA_PTR || result_len_ptr == NULL_DATA_PTR)
+	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("big num datas or result len is null \n");
+		#endif
+		return FAILURE;
+	}
+	if((Small_Nums_Oper(&small_result_num, big_num_arithmetic_oper, operand_str1, operand_str2, num_precision_digits)) == STATE_YES)
+	{
+		return Big_Num_To_Buf(&small_result_num, result_buf_ptr, result_buf_size, result_len_ptr);
+	}
+	big_num_datas_ptr->operand_str1 = operand_str1;
+	big_num_datas_ptr->operand_str2 = operand_str2;
+	if((Validate_Big_Num_Data(big_num_arithmetic_oper, big_num_datas_ptr)) != SUCCESS)
+	{
+		return FAILURE;
+	}
+	if((Big_Num_Oper(&big_num_datas_ptr->result_num, big_num_arithmetic_oper, &big_num_datas_ptr->proc_num1, &big_num_datas_ptr->proc_num2, num_precision_digits)) != SUCCESS)
+	{
+		return FAILURE;
+	}
+	return Big_Num_To_Buf(&big_num_datas_ptr->result_num, result_buf_ptr, result_buf_size, result_len_ptr);
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Nums_Oper_Bin
+
+DESCRIPTION    :  finds operand_bin1 oper operand_bin2 of big nums in binary format, into caller's result buf of result_buf_size
+                  bytes in binary format
+
+INPUT          :  big_num_datas_ptr is initialized by Init_Big_Num_Datas(), and is used for every call, till Free_Big_Num_Datas().
+                  Operand bins are as of Big_Num_To_Bin(). num_precision_digits is used only by BIG_NUMS_DIVISION_OPER
+
+OUTPUT         :  result_len_ptr has num of bytes of result bin. If result buf is small, result_len_ptr still has num of bytes
+                  of result bin.
+
+NOTE           :  operands are loaded by Big_Num_From_Bin() and result is stored by Big_Num_To_Bin(), so that stages of a pipeline
+                  pass big nums without str parse and format. Limbs in big num datas are reused from earlier calls, as of
+                  Big_Nums_Oper_To_Buf().
+
+Func ID        : 01.40
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Big_Nums_Oper_Bin(big_num_datas_t *const big_num_datas_ptr, const uint8_t big_num_arithmetic_oper, const uint8_t *const operand_bin1,
+   const size_t operand_bin1_len, const uint8_t *const operand_bin2, const size_t operand_bin2_len, const size_t num_precision_digits,
+   uint8_t *const result_buf_ptr, const size_t result_buf_size, size_t *const result_len_ptr)
+{
+	if(big_num_datas_ptr == NULL_DATA_PTR || result_buf_ptr == NULL_DATA_PTR || result_len_ptr == NULL_DATA_PTR)
+	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("big num datas, result buf or result len is null \n");
+		#endif
+		return FAILURE;
+	}
+	if((Big_Num_From_Bin(&big_num_datas_ptr->proc_num1, operand_bin1, operand_bin1_len)) != SUCCESS ||
+	   (Big_Num_From_Bin(&big_num_datas_ptr->proc_num2, operand_bin2, operand_bin2_len)) != SUCCESS)
+	{
+		return FAILURE;
+	}
+	if(big_num_arithmetic_oper == BIG_NUMS_MODULUS_OPER && (big_num_datas_ptr->proc_num1.precision_digits != 0 || big_num_datas_ptr->proc_num2.precision_digits != 0))
+	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("operand bins of modulus are non integer \n");
+		#endif
+		return FAILURE;
+	}
+	if((Big_Num_Oper(&big_num_datas_ptr->result_num, big_num_arithmetic_oper, &big_num_datas_ptr->proc_num1, &big_num_datas_ptr->proc_num2, num_precision_digits)) != SUCCESS)
+	{
+		return FAILURE;
+	}
+	return (Big_Num_To_Bin(&big_num_datas_ptr->result_num, result_buf_ptr, result_buf_size, result_len_ptr) != NULL_DATA_PTR) ? SUCCESS : FAILURE;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Small_Nums_Oper
+
+DESCRIPTION    : finds operand_str1 oper operand_str2 by double limb arithmetic, if operands and result fit in double limb
+
+INPUT          : result_num_ptr has atleast 2 limbs. num_precision_digits is used only by BIG_NUMS_DIVISION_OPER
+
+OUTPUT         : returns STATE_YES, if result is found in result_num_ptr. Returns STATE_NO, if operation must be done by
+                 big num path, which also reports invalid operands, division by 0 and non integer modulus.
+
+NOTE           : no memory is allocated. Operands of upto SMALL_NUM_MAX_DIGITS digits are converted by Small_Num_From_Str(),
+                 and aligned to result precision by Small_Num_Scale(), which fails if scaled operand may not fit.
+                 Result is same as of big num path, as it is formatted by same Big_Num_Format().
+
+Func ID        : 01.16
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint8_t Small_Nums_Oper(big_num_t *const result_num_ptr, const uint8_t big_num_arithmetic_oper, const char *const operand_str1, const char *const operand_str2,
+   const size_t num_precision_digits)
+{
+	#ifdef BIG_NUM_DLIMB_SUPPORT
+	   small_num_t num1, num2;
+	   big_num_dlimb_t result_magnitude;
+	   size_t result_precision_digits;
+	   uint8_t result_sign_flag;
+
+	   if(small_nums_fast_path_state != STATE_YES || operand_str1 == NULL_DATA_PTR || operand_str2 == NULL_DATA_PTR)
+	   {
+		   return STATE_NO;
+	   }
+	   if(Small_Num_From_Str(&num1, operand_str1) != STATE_YES || Small_Num_From_Str(&num2, operand_str2) != STATE_YES)
+	   {
+		   return STATE_NO;
+	   }
+	   switch(big_num_arithmetic_oper)
+	   {
+		   case BIG_NUMS_SUM_OPER:
+		   case BIG_NUMS_SUBTRACT_OPER:
+		      if(big_num_arithmetic_oper == BIG_NUMS_SUBTRACT_OPER)
+		      {
+			      num2.sign_flag ^= 1;
+		      }
+		      result_precision_digits = (num1.precision_digits > num2.precision_digits) ? num1.precision_digits : num2.precision_digits;
+		      if(Small_Num_Scale(&num1, result_precision_digits - num1.precision_digits) != STATE_YES ||
+		         Small_Num_Scale(&num2, result_precision_digits - num2.precision_digits) != STATE_YES)
+		      {
+			      return STATE_NO;
+		      }
+		      // sum of magnitudes less than 10 ^ SMALL_NUM_MAX_DIGITS fits in double limb
+		      if(num1.sign_flag == num2.sign_flag)
+		      {
+			      result_magnitude = num1.magnitude + num2.magnitude;
+			      result_sign_flag = num1.sign_flag;
+		      }
+		      else if(num1.magnitude >= num2.magnitude)
+		      {
+			      result_magnitude = num1.magnitude - num2.magnitude;
+			      result_sign_flag = num1.sign_flag;
+		      }
+		      else
+		      {
+			      result_magnitude = num2.magnitude - num1.magnitude;
+			      result_sign_flag = num2.sign_flag;
+		      }
+		   break;
+		   case BIG_NUMS_MULTIPLY_OPER:
+		      #if defined(__GNUC__)
+		         if(__builtin_mul_overflow(num1.magnitude, num2.magnitude, &result_magnitude))
+		         {
+			         return STATE_NO;
+		         }
+		      #else
+		         if(num2.magnitude != 0 && num1.magnitude > ~(big_num_dlimb_t)0 / num2.magnitude)
+		         {
+			         return STATE_NO;
+		         }
+		         result_magnitude = num1.magnitude * num2.magnitude;
+		      #endif
+		      // zero product has no precision digits, as of Big_Num_Multiply()
+		      result_precision_digits = (result_magnitude != 0) ? num1.precision_digits + num2.precision_digits : 0;
+		      result_sign_flag = num1.sign_flag ^ num2.sign_flag;
+		   break;
+		   case BIG_NUMS_DIVISION_OPER:
+		      if(num2.magnitude == 0 || num_precision_digits > SMALL_NUM_MAX_DIGITS || Small_Num_Scale(&num1, num_precision_digits + num2.precision_digits) != STATE_YES ||
+		         Small_Num_Scale(&num2, num1.precision_digits) != STATE_YES)
+		      {
+			      return STATE_NO;
+		      }
+		      result_magnitude = num1.magnitude / num2.magnitude;
+		      result_precision_digits = num_precision_digits;
+		      result_sign_flag = num1.sign_flag ^ num2.sign_flag;
+		   break;
+		   case BIG_NUMS_MODULUS_OPER:
+		      if(num2.magnitude == 0 || num1.precision_digits != 0 || num2.precision_digits != 0)
+		      {
+			      return STATE_NO;
+		      }
+		      result_magnitude = num1.magnitude % num2.magnitude;
+		      result_precision_digits = 0;
+		      result_sign_flag = num1.sign_flag;
+		   break;
+		   default:
+		      return STATE_NO;
+	   }
+	   result_num_ptr->limb_ptr[0] = (big_num_limb_t)result_magnitude;
+	   result_num_ptr->limb_ptr[1] = (big_num_limb_t)(result_magnitude >> BIG_NUM_LIMB_BITS);
+	   result_num_ptr->num_limbs = 2;
+	   result_num_ptr->precision_digits = result_precision_digits;
+	   result_num_ptr->sign_flag = result_sign_flag;
+	   Big_Num_Normalize(result_num_ptr);
+	   return STATE_YES;
+	#else
+	   return STATE_NO;
+	#endif
+}
+
+#ifdef BIG_NUM_DLIMB_SUPPORT
+/*------------------------------------------------------------*
+FUNCTION NAME  : Small_Num_From_Str
+
+DESCRIPTION    : converts num in str of upto SMALL_NUM_MAX_DIGITS digits, into small num
+
+INPUT          : num_str is not NULL
+
+OUTPUT         : returns STATE_NO, if num_str is not valid as of Big_Num_From_Str(), or has more than SMALL_NUM_MAX_DIGITS digits
+                 or max_operand_len chars
+
+NOTE           :
+
+Func ID        : 01.17
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint8_t Small_Num_From_Str(small_num_t *const num_ptr, const char *const num_str)
+{
+	big_num_dlimb_t magnitude = 0;
+	big_num_limb_t chunk_value = 0;
+	size_t str_pos = 0, num_digits = 0, chunk_digits = 0, point_pos = 0;
+	uint8_t sign_flag = BIG_NUM_SIGN_POSITIVE;
+
+	if(num_str[0] == '-' || num_str[0] == '+')
+	{
+		if(num_str[0] == '-')
+		{
+			sign_flag = BIG_NUM_SIGN_NEGATIVE;
+		}
+		str_pos = 1;
+	}
+	// digits are accumulated in a limb, and a chunk of BIG_NUM_LIMB_DEC_DIGITS digits is added to magnitude
+	for(; num_str[str_pos] != NULL_CHAR; ++str_pos)
+	{
+		if((unsigned char)(num_str[str_pos] - '0') <= 9)
+		{
+			if(chunk_digits == BIG_NUM_LIMB_DEC_DIGITS)
+			{
+				if(num_digits == SMALL_NUM_MAX_DIGITS)
+				{
+					return STATE_NO;
+				}
+				magnitude = (magnitude * BIG_NUM_LIMB_DEC_BASE) + chunk_value;
+				chunk_value = 0;
+				chunk_digits = 0;
+			}
+			chunk_value = (chunk_value * 10) + (big_num_limb_t)(num_str[str_pos] - '0');
+			++chunk_digits;
+			++num_digits;
+			continue;
+		}
+		if(num_str[str_pos] == '.' && point_pos == 0)
+		{
+			// point_pos is num of digits before '.' char + 1
+			point_pos = num_digits + 1;
+			continue;
+		}
+		return STATE_NO;
+	}
+	if(num_digits == 0 || str_pos > max_operand_len)
+	{
+		return STATE_NO;
+	}
+	magnitude = (magnitude * limb_power_of_10[chunk_digits]) + chunk_value;
+	num_ptr->magnitude = magnitude;
+	num_ptr->precision_digits = (point_pos == 0) ? 0 : num_digits - (point_pos - 1);
+	num_ptr->num_digits = num_digits;
+	num_ptr->sign_flag = (magnitude == 0) ? BIG_NUM_SIGN_POSITIVE : sign_flag;
+	return STATE_YES;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Small_Num_Scale
+
+DESCRIPTION    : small num magnitude = magnitude * 10 ^ power
+
+INPUT          :
+
+OUTPUT         : returns STATE_NO, if scaled magnitude may have more than SMALL_NUM_MAX_DIGITS digits
+
+NOTE           : precision digits of num is not changed, as caller aligns num to precision digits of result.
+
+Func ID        : 01.18
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint8_t Small_Num_Scale(small_num_t *const num_ptr, const size_t power)
+{
+	if(power == 0)
+	{
+		return STATE_YES;
+	}
+	if(power > SMALL_NUM_MAX_DIGITS || num_ptr->num_digits + power > SMALL_NUM_MAX_DIGITS)
+	{
+		return STATE_NO;
+	}
+	num_ptr->magnitude *= Dlimb_Pow10(power);
+	num_ptr->num_digits += power;
+	return STATE_YES;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Dlimb_Pow10
+
+DESCRIPTION    : 10 ^ power in double limb
+
+INPUT          : power <= SMALL_NUM_MAX_DIGITS
+
+OUTPUT         :
+
+NOTE           :
+
+Func ID        : 01.19
+
+BUGS           :
+-*------------------------------------------------------------*/
+static inline big_num_dlimb_t Dlimb_Pow10(const size_t power)
+{
+	if(power <= BIG_NUM_LIMB_DEC_DIGITS)
+	{
+		return limb_power_of_10[power];
+	}
+	return (big_num_dlimb_t)BIG_NUM_LIMB_DEC_BASE * limb_power_of_10[power - BIG_NUM_LIMB_DEC_DIGITS];
+}
+#endif
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Bench_Small_Nums
+
+DESCRIPTION    : times +, -, *, / and % of small operands by big num path and by small num fast path, and prints them
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           : each operation is repeated BENCH_NUM_OPERS times by Big_Nums_* operations, including alloc and free of result
+                 str. Results of both paths are compared, before they are timed.
+
+Func ID        : 01.20
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Bench_Small_Nums(void)
+{
+	const char *const operand_strs[][2] = {{"123456789012345678.0123456789", "-98765432109876.54321"}, {"-4567890123456789.75", "-1234567890123.000001"},
+	   {"12345678901234.56789", "-9876543210.12345"}, {"98765432109876543210.125", "12345.678"}, {"123456789012345678901234567", "-98765432109"}};
+	const char *const oper_names[] = {"sum", "subtract", "multiply", "division", "modulus"};
+	char *result_ptr, *result_ptrs[2] = {NULL_DATA_PTR, NULL_DATA_PTR};
+	double oper_times[2];
+	size_t oper_count;
+	clock_t start_clock;
+	uint8_t oper, path;
+
+	for(oper = BIG_NUMS_SUM_OPER; oper <= BIG_NUMS_MODULUS_OPER; ++oper)
+	{
+		for(path = 0; path < 2; ++path)
+		{
+			// path 0 is big num path, and path 1 is small num fast path
+			small_nums_fast_path_state = (path == 0) ? STATE_NO : STATE_YES;
+			start_clock = clock();
+			for(oper_count = 0; oper_count <= BENCH_NUM_OPERS; ++oper_count)
+			{
+				switch(oper)
+				{
+					case BIG_NUMS_SUM_OPER:
+					   result_ptr = Big_Nums_Sum(operand_strs[oper - 1][0], operand_strs[oper - 1][1]);
+					break;
+					case BIG_NUMS_SUBTRACT_OPER:
+					   result_ptr = Big_Nums_Subtract(operand_strs[oper - 1][0], operand_strs[oper - 1][1]);
+					break;
+					case BIG_NUMS_MULTIPLY_OPER:
+					   result_ptr = Big_Nums_Multiply(operand_strs[oper - 1][0], operand_strs[oper - 1][1]);
+					break;
+					case BIG_NUMS_DIVISION_OPER:
+					   result_ptr = Big_Nums_Division(operand_strs[oper - 1][0], operand_strs[oper - 1][1], REQ_PRECISION_DIGITS);
+					break;
+					default:
+					   result_ptr = Big_Nums_Modulus(operand_strs[oper - 1][0], operand_strs[oper - 1][1]);
+				}
+				if(result_ptr == NULL_DATA_PTR)
+				{
+					small_nums_fast_path_state = STATE_YES;
+					free(result_ptrs[0]);
+					return FAILURE;
+				}
+				// first result is kept for comparison, and is not timed
+				if(oper_count == 0)
+				{
+					result_ptrs[path] = result_ptr;
+					start_clock = clock();
+					continue;
+				}
+				free(result_ptr);
+			}
+			oper_times[path] = (double)(clock() - start_clock) / CLOCKS_PER_SEC / BENCH_NUM_OPERS;
+		}
+		small_nums_fast_path_state = STATE_YES;
+		if(strcmp(result_ptrs[0], result_ptrs[1]) != 0)
+		{
+			#ifdef TRACE_ERROR
+			   Trace_Error("bench - %s results differ : %s and %s \n", oper_names[oper - 1], result_ptrs[0], result_ptrs[1]);
+			#endif
+			free(result_ptrs[0]);
+			free(result_ptrs[1]);
+			return FAILURE;
+		}
+		printf("%-8s : big num path %8.1f ns, small num fast path %8.1f ns, %5.1f times faster\n", oper_names[oper - 1], oper_times[0] * 1e9,
+		   oper_times[1] * 1e9, (oper_times[1] > 0) ? oper_times[0] / oper_times[1] : 0.0);
+		free(result_ptrs[0]);
+		free(result_ptrs[1]);
+		result_ptrs[0] = NULL_DATA_PTR;
+	}
+	return SUCCESS;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Self_Test
+
+DESCRIPTION    : runs +, -, *, / and % of random operands of 1k, 100k and 10M digits, checks their results, and prints them
+
+INPUT          : sizes of more than max_num_digits digits are skipped
+
+OUTPUT         : returns FAILURE, at first operation whose result is wrong
+
+NOTE           : operands of +, - and * have fraction digits and different signs, and operands of / and % are integers, whose
+                 divisor has half num of digits of dividend. Results are checked by Self_Test_Oper(). Binary format is checked
+                 first by Self_Test_Bin(), and --files operations at largest size by Self_Test_Files(), before other tests
+                 raise peak resident memory. Time of str conversion of dividend is compared with multiply by Self_Test_Format().
+
+Func ID        : 01.56
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Self_Test(const size_t max_num_digits)
+{
+	const size_t test_num_digits[] = {1000, 100000, 10000000};
+	const char *const oper_names[] = {"sum", "subtract", "multiply", "division", "modulus"};
+	char *operand_strs[2] = {NULL_DATA_PTR, NULL_DATA_PTR};
+	size_t size_pos, num_digits;
+	uint64_t rand_state = 0x9E3779B97F4A7C15ULL;
+	clock_t start_clock;
+	uint16_t ret_status;
+	uint8_t oper;
+
+	ret_status = Self_Test_Bin();
+	printf("selftest bin format : %s\n", (ret_status == SUCCESS) ? "ok" : "FAILED");
+	for(size_pos = sizeof(test_num_digits) / sizeof(test_num_digits[0]); size_pos > 0 && ret_status == SUCCESS; --size_pos)
+	{
+		if(test_num_digits[size_pos - 1] <= max_num_digits)
+		{
+			ret_status = Self_Test_Files(test_num_digits[size_pos - 1], &rand_state);
+			break;
+		}
+	}
+	for(size_pos = 0; size_pos < sizeof(test_num_digits) / sizeof(test_num_digits[0]) && ret_status == SUCCESS; ++size_pos)
+	{
+		if((num_digits = test_num_digits[size_pos]) > max_num_digits)
+		{
+			break;
+		}
+		// operand has sign, '.' char and null char
+		if((operand_strs[0] = malloc(num_digits + 3)) == NULL_DATA_PTR || (operand_strs[1] = malloc(num_digits + 3)) == NULL_DATA_PTR)
+		{
+			#ifdef TRACE_ERROR
+			   Trace_Error("selftest - memory alloc failed \n");
+			#endif
+			free(operand_strs[0]);
+			return FAILURE;
+		}
+		for(oper = BIG_NUMS_SUM_OPER; oper <= BIG_NUMS_MODULUS_OPER && ret_status == SUCCESS; ++oper)
+		{
+			if(oper <= BIG_NUMS_MULTIPLY_OPER)
+			{
+				Self_Test_Num_Str(operand_strs[0], num_digits - 5, 5, BIG_NUM_SIGN_POSITIVE, &rand_state);
+				Self_Test_Num_Str(operand_strs[1], num_digits - 3, 3, BIG_NUM_SIGN_NEGATIVE, &rand_state);
+			}
+			else
+			{
+				Self_Test_Num_Str(operand_strs[0], num_digits, 0, BIG_NUM_SIGN_POSITIVE, &rand_state);
+				Self_Test_Num_Str(operand_strs[1], num_digits / 2, 0, BIG_NUM_SIGN_NEGATIVE, &rand_state);
+			}
+			start_clock = clock();
+			ret_status = Self_Test_Oper(oper, operand_strs[0], operand_strs[1]);
+			printf("selftest %-8s %8lu digits : %s, %.2f s\n", oper_names[oper - 1], (unsigned long)num_digits, (ret_status == SUCCESS) ? "ok" : "FAILED",
+			   (double)(clock() - start_clock) / CLOCKS_PER_SEC);
+			fflush(stdout);
+		}
+		if(ret_status == SUCCESS)
+		{
+			ret_status = Self_Test_Format(operand_strs[0]);
+		}
+		free(operand_strs[0]);
+		free(operand_strs[1]);
+		operand_strs[0] = NULL_DATA_PTR;
+		operand_strs[1] = NULL_DATA_PTR;
+	}
+	return ret_status;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Self_Test_Oper
+
+DESCRIPTION    : finds operand_str1 oper operand_str2 by Big_Nums_* operation, and checks its result
+
+INPUT          : operands of / and % are integers
+
+OUTPUT         : returns FAILURE, if result is wrong or not found
+
+NOTE           : result str is checked for its form and precision digits, and its value is checked modulo SELF_TEST_NUM_PRIMES
+                 primes by Self_Test_Residue(), which reads digits directly, without limbs. Quotient q of / with
+                 REQ_PRECISION_DIGITS digits is checked by remainder r = |operand1| * 10 ^ REQ_PRECISION_DIGITS - |q| * |operand2|,
+                 for which 0 <= r < |operand2|, and remainder r of % is checked with quotient q of / with 0 precision digits,
+                 as operand1 = q * operand2 + r, with |r| < |operand2|, and r has sign of operand1.
+
+Func ID        : 01.57
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Self_Test_Oper(const uint8_t big_num_arithmetic_oper, const char *const operand_str1, const char *const operand_str2)
+{
+	const big_num_limb_t primes[SELF_TEST_NUM_PRIMES] = {2305843009213693951ULL, 4611686018427387847ULL, 18446744073709551557ULL};
+	const char *point_ptr, *mag_str;
+	char *result_ptr, *quot_ptr = NULL_DATA_PTR, *quot_mag_ptr = NULL_DATA_PTR, *scaled_ptr = NULL_DATA_PTR, *prod_ptr = NULL_DATA_PTR;
+	big_num_limb_t prime, residue1, residue2, expect_residue;
+	size_t precision_digits1, precision_digits2, result_precision_digits, prime_pos, str_pos, mag_pos;
+	uint16_t ret_status = SUCCESS;
+
+	precision_digits1 = ((point_ptr = strchr(operand_str1, '.')) == NULL_DATA_PTR) ? 0 : strlen(point_ptr + 1);
+	precision_digits2 = ((point_ptr = strchr(operand_str2, '.')) == NULL_DATA_PTR) ? 0 : strlen(point_ptr + 1);
+	switch(big_num_arithmetic_oper)
+	{
+		case BIG_NUMS_SUM_OPER:
+		   result_ptr = Big_Nums_Sum(operand_str1, operand_str2);
+		break;
+		case BIG_NUMS_SUBTRACT_OPER:
+		   result_ptr = Big_Nums_Subtract(operand_str1, operand_str2);
+		break;
+		case BIG_NUMS_MULTIPLY_OPER:
+		   result_ptr = Big_Nums_Multiply(operand_str1, operand_str2);
+		break;
+		case BIG_NUMS_DIVISION_OPER:
+		   result_ptr = Big_Nums_Division(operand_str1, operand_str2, REQ_PRECISION_DIGITS);
+		break;
+		default:
+		   result_ptr = Big_Nums_Modulus(operand_str1, operand_str2);
+		   quot_ptr = Big_Nums_Division(operand_str1, operand_str2, 0);
+	}
+	if(result_ptr == NULL_DATA_PTR || (big_num_arithmetic_oper == BIG_NUMS_MODULUS_OPER && quot_ptr == NULL_DATA_PTR))
+	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("selftest - result is not found \n");
+		#endif
+		free(result_ptr);
+		free(quot_ptr);
+		return FAILURE;
+	}
+	if(big_num_arithmetic_oper == BIG_NUMS_DIVISION_OPER)
+	{
+		// remainder of |operand1| * 10 ^ REQ_PRECISION_DIGITS by |quot| is found from integer magnitudes in str
+		quot_ptr = result_ptr;
+		result_ptr = NULL_DATA_PTR;
+		mag_str = operand_str1 + ((operand_str1[0] == '-') ? 1 : 0);
+		if((quot_mag_ptr = malloc(strlen(quot_ptr) + 1)) != NULL_DATA_PTR && (scaled_ptr = malloc(strlen(mag_str) + REQ_PRECISION_DIGITS + 1)) != NULL_DATA_PTR)
+		{
+			for(str_pos = 0, mag_pos = 0; quot_ptr[str_pos] != NULL_CHAR; ++str_pos)
+			{
+				if(quot_ptr[str_pos] >= '0' && quot_ptr[str_pos] <= '9' && (mag_pos != 0 || quot_ptr[str_pos] != '0' || quot_ptr[str_pos + 1] == NULL_CHAR))
+				{
+					quot_mag_ptr[mag_pos++] = quot_ptr[str_pos];
+				}
+			}
+			quot_mag_ptr[mag_pos] = NULL_CHAR;
+			memcpy(scaled_ptr, mag_str, strlen(mag_str));
+			memset(scaled_ptr + strlen(mag_str), '0', REQ_PRECISION_DIGITS);
+			scaled_ptr[strlen(mag_str) + REQ_PRECISION_DIGITS] = NULL_CHAR;
+			if((prod_ptr = Big_Nums_Multiply(quot_mag_ptr, operand_str2 + ((operand_str2[0] == '-') ? 1 : 0))) != NULL_DATA_PTR)
+			{
+				result_ptr = Big_Nums_Subtract(scaled_ptr, prod_ptr);
+			}
+		}
+		if(result_ptr == NULL_DATA_PTR || Self_Test_Check_Str(quot_ptr, REQ_PRECISION_DIGITS) != SUCCESS ||
+		   (quot_ptr[0] == '-') != ((operand_str1[0] == '-') != (operand_str2[0] == '-')) || Self_Test_Check_Str(prod_ptr, 0) != SUCCESS ||
+		   result_ptr[0] == '-' || Self_Test_Cmp_Mag(result_ptr, operand_str2) >= 0)
+		{
+			ret_status = FAILURE;
+		}
+	}
+	result_precision_digits = (precision_digits1 > precision_digits2) ? precision_digits1 : precision_digits2;
+	if(big_num_arithmetic_oper == BIG_NUMS_MULTIPLY_OPER)
+	{
+		result_precision_digits = precision_digits1 + precision_digits2;
+	}
+	if(big_num_arithmetic_oper == BIG_NUMS_MODULUS_OPER && (Self_Test_Check_Str(quot_ptr, 0) != SUCCESS || Self_Test_Cmp_Mag(result_ptr, operand_str2) >= 0 ||
+	   (result_ptr[0] == '-' && operand_str1[0] != '-')))
+	{
+		ret_status = FAILURE;
+	}
+	if(ret_status == SUCCESS && Self_Test_Check_Str(result_ptr, result_precision_digits) != SUCCESS)
+	{
+		ret_status = FAILURE;
+	}
+	for(prime_pos = 0; prime_pos < SELF_TEST_NUM_PRIMES && ret_status == SUCCESS; ++prime_pos)
+	{
+		prime = primes[prime_pos];
+		residue1 = Self_Test_Residue(operand_str1, result_precision_digits - precision_digits1, prime);
+		residue2 = Self_Test_Residue(operand_str2, result_precision_digits - precision_digits2, prime);
+		switch(big_num_arithmetic_oper)
+		{
+			case BIG_NUMS_SUM_OPER:
+			   expect_residue = (residue1 >= prime - residue2) ? residue1 - (prime - residue2) : residue1 + residue2;
+			break;
+			case BIG_NUMS_SUBTRACT_OPER:
+			   expect_residue = (residue1 >= residue2) ? residue1 - residue2 : residue1 + (prime - residue2);
+			break;
+			case BIG_NUMS_MULTIPLY_OPER:
+			   residue1 = Self_Test_Residue(operand_str1, 0, prime);
+			   residue2 = Self_Test_Residue(operand_str2, 0, prime);
+			   expect_residue = Self_Test_Mul_Mod(residue1, residue2, prime);
+			break;
+			case BIG_NUMS_DIVISION_OPER:
+			   // product is |quot| * |operand2|, and result is scaled - product
+			   residue1 = Self_Test_Residue(quot_mag_ptr, 0, prime);
+			   residue2 = Self_Test_Residue(operand_str2 + ((operand_str2[0] == '-') ? 1 : 0), 0, prime);
+			   if(Self_Test_Residue(prod_ptr, 0, prime) != Self_Test_Mul_Mod(residue1, residue2, prime))
+			   {
+				   ret_status = FAILURE;
+			   }
+			   residue1 = Self_Test_Residue(scaled_ptr, 0, prime);
+			   residue2 = Self_Test_Residue(prod_ptr, 0, prime);
+			   expect_residue = (residue1 >= residue2) ? residue1 - residue2 : residue1 + (prime - residue2);
+			break;
+			default:
+			   // operand1 - quot * operand2 = remainder
+			   residue2 = Self_Test_Mul_Mod(Self_Test_Residue(quot_ptr, 0, prime), residue2, prime);
+			   expect_residue = (residue1 >= residue2) ? residue1 - residue2 : residue1 + (prime - residue2);
+		}
+		if(Self_Test_Residue(result_ptr, 0, prime) != expect_residue)
+		{
+			ret_status = FAILURE;
+		}
+	}
+	#ifdef TRACE_ERROR
+	   if(ret_status != SUCCESS)
+	   {
+		   Trace_Error("selftest - result of oper : %u is wrong \n", (unsigned int)big_num_arithmetic_oper);
+	   }
+	#endif
+	free(result_ptr);
+	free(quot_ptr);
+	free(quot_mag_ptr);
+	free(scaled_ptr);
+	free(prod_ptr);
+	return ret_status;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Self_Test_Format
+
+DESCRIPTION    : times conversion of integer num_str into str by Big_Num_Format(), with and without cached pow10 levels, and
+                 multiply of num by itself, and prints them
+
+INPUT          : num_str is integer of form of Big_Num_Format()
+
+OUTPUT         : returns FAILURE, if converted str differs from num_str
+
+NOTE           : pow10 cache is cleared first, so that first conversion also finds levels and their inverses, which later
+                 conversions of same num of digits reuse.
+
+Func ID        : 01.69
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Self_Test_Format(const char *const num_str)
+{
+	big_num_t nums[2];
+	char *result_ptr;
+	double format_times[2], multiply_time;
+	size_t result_len, num_digits = strlen(num_str), pos;
+	clock_t start_clock;
+	uint16_t ret_status;
+
+	Big_Num_Init(&nums[0]);
+	Big_Num_Init(&nums[1]);
+	if((result_ptr = malloc(num_digits + 1)) == NULL_DATA_PTR)
+	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("selftest - memory alloc failed \n");
+		#endif
+		return FAILURE;
+	}
+	ret_status = Big_Num_From_Str(&nums[0], num_str);
+	if(ret_status == SUCCESS)
+	{
+		start_clock = clock();
+		ret_status = Big_Num_Multiply(&nums[1], &nums[0], &nums[0]);
+		multiply_time = (double)(clock() - start_clock) / CLOCKS_PER_SEC;
+	}
+	Big_Num_Pow10_Cache_Clear();
+	for(pos = 0; pos < 2 && ret_status == SUCCESS; ++pos)
+	{
+		start_clock = clock();
+		if(Big_Num_Format(&nums[0], result_ptr, num_digits + 1, &result_len) == NULL_DATA_PTR || strcmp(result_ptr, num_str) != 0)
+		{
+			#ifdef TRACE_ERROR
+			   Trace_Error("selftest - format of %lu digits differs \n", (unsigned long)num_digits);
+			#endif
+			ret_status = FAILURE;
+		}
+		format_times[pos] = (double)(clock() - start_clock) / CLOCKS_PER_SEC;
+	}
+	if(ret_status == SUCCESS)
+	{
+		printf("selftest format   %8lu digits : ok, %.2f s, cached %.2f s, multiply %.2f s, cached format is %.1f times of multiply\n",
+		   (unsigned long)num_digits, format_times[0], format_times[1], multiply_time, (multiply_time > 0) ? format_times[1] / multiply_time : 0.0);
+	}
+	else
+	{
+		printf("selftest format   %8lu digits : FAILED\n", (unsigned long)num_digits);
+	}
+	fflush(stdout);
+	free(result_ptr);
+	Big_Num_Free(&nums[0]);
+	Big_Num_Free(&nums[1]);
+	return ret_status;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Self_Test_Files
+
+DESCRIPTION    : runs +, - and * of Big_Nums_Files() on temp operand files of num_digits digits, checks their results, and
+                 prints their time and growth of peak resident memory
+
+INPUT          :
+
+OUTPUT         : returns FAILURE, if result is wrong, or peak resident memory grew by more than SELF_TEST_FILES_MAX_RSS_PER_DIGIT
+                 bytes per digit and SELF_TEST_FILES_BASE_RSS_BYTES
+
+NOTE           : operand a is random, and b has 9 - digit of a for each digit of a, so that a + b and a - (-b) have only 9
+                 digits, and a * 1 is a. Files are written and compared in blocks, so that no operand str is in memory, and
+                 growth of peak is from Big_Nums_Files() only. As only peak of process is known, growth of each oper is from
+                 peak before first oper, and includes opers before it. Test is skipped without BIG_NUM_MMAP.
+
+Func ID        : 01.70
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Self_Test_Files(const size_t num_digits, uint64_t *const rand_state_ptr)
+{
+	#ifdef BIG_NUM_MMAP
+	   /* files of a, b, -b, 1, expected sum and result */
+	   enum {FILE_A, FILE_B, FILE_NEG_B, FILE_ONE, FILE_SUM, FILE_RESULT, NUM_FILES};
+	   const uint8_t opers[] = {BIG_NUMS_SUM_OPER, BIG_NUMS_SUBTRACT_OPER, BIG_NUMS_MULTIPLY_OPER};
+	   const char *const oper_names[] = {"add", "sub", "mul"};
+	   const uint8_t operand_files[][3] = {{FILE_A, FILE_B, FILE_SUM}, {FILE_A, FILE_NEG_B, FILE_SUM}, {FILE_A, FILE_ONE, FILE_A}};
+	   char file_names[NUM_FILES][32];
+	   FILE *file_ptrs[NUM_FILES];
+	   char *block_ptr;
+	   struct rusage usage;
+	   double oper_time, rss_bytes;
+	   long start_peak;
+	   size_t file_pos, oper_pos, char_pos, block_pos;
+	   clock_t start_clock;
+	   uint16_t ret_status = SUCCESS;
+	   int fd;
+
+	   for(file_pos = 0; file_pos < NUM_FILES; ++file_pos)
+	   {
+		   strcpy(file_names[file_pos], "/tmp/big_num_selftest_XXXXXX");
+		   file_ptrs[file_pos] = NULL_DATA_PTR;
+		   if(ret_status == SUCCESS && ((fd = mkstemp(file_names[file_pos])) < 0 || (file_ptrs[file_pos] = fdopen(fd, "wb")) == NULL_DATA_PTR))
+		   {
+			   #ifdef TRACE_ERROR
+			      Trace_Error("selftest - temp file is not created \n");
+			   #endif
+			   if(fd >= 0)
+			   {
+				   close(fd);
+				   unlink(file_names[file_pos]);
+			   }
+			   ret_status = FAILURE;
+		   }
+		   if(ret_status != SUCCESS)
+		   {
+			   file_names[file_pos][0] = NULL_CHAR;
+		   }
+	   }
+	   if(ret_status == SUCCESS && (block_ptr = malloc(3 * SELF_TEST_FILES_BLOCK_CHARS)) == NULL_DATA_PTR)
+	   {
+		   #ifdef TRACE_ERROR
+		      Trace_Error("selftest - memory alloc failed \n");
+		   #endif
+		   ret_status = FAILURE;
+	   }
+	   if(ret_status == SUCCESS)
+	   {
+		   // blocks of a, b and sum, whose '.' char is before last 5 digits, and last char is newline
+		   fputc('-', file_ptrs[FILE_NEG_B]);
+		   fputc('1', file_ptrs[FILE_ONE]);
+		   for(char_pos = 0, block_pos = 0; char_pos < num_digits + 2; ++char_pos)
+		   {
+			   if(char_pos == num_digits - 5 || char_pos == num_digits + 1)
+			   {
+				   block_ptr[block_pos] = (char)((char_pos == num_digits + 1) ? '\n' : '.');
+				   block_ptr[SELF_TEST_FILES_BLOCK_CHARS + block_pos] = block_ptr[block_pos];
+				   block_ptr[2 * SELF_TEST_FILES_BLOCK_CHARS + block_pos] = block_ptr[block_pos];
+			   }
+			   else
+			   {
+				   *rand_state_ptr ^= *rand_state_ptr << 13;
+				   *rand_state_ptr ^= *rand_state_ptr >> 7;
+				   *rand_state_ptr ^= *rand_state_ptr << 17;
+				   // first digit of a and b is not 0
+				   block_ptr[block_pos] = (char)((char_pos == 0) ? '1' + (*rand_state_ptr >> 32) % 8 : '0' + (*rand_state_ptr >> 32) % 10);
+				   block_ptr[SELF_TEST_FILES_BLOCK_CHARS + block_pos] = (char)('9' - (block_ptr[block_pos] - '0'));
+				   block_ptr[2 * SELF_TEST_FILES_BLOCK_CHARS + block_pos] = '9';
+			   }
+			   if(++block_pos == SELF_TEST_FILES_BLOCK_CHARS || char_pos == num_digits + 1)
+			   {
+				   fwrite(block_ptr, 1, block_pos, file_ptrs[FILE_A]);
+				   fwrite(block_ptr + SELF_TEST_FILES_BLOCK_CHARS, 1, block_pos, file_ptrs[FILE_B]);
+				   fwrite(block_ptr + SELF_TEST_FILES_BLOCK_CHARS, 1, block_pos, file_ptrs[FILE_NEG_B]);
+				   fwrite(block_ptr + 2 * SELF_TEST_FILES_BLOCK_CHARS, 1, block_pos, file_ptrs[FILE_SUM]);
+				   block_pos = 0;
+			   }
+		   }
+		   free(block_ptr);
+	   }
+	   for(file_pos = 0; file_pos < NUM_FILES; ++file_pos)
+	   {
+		   if(file_ptrs[file_pos] != NULL_DATA_PTR && (ferror(file_ptrs[file_pos]) || fclose(file_ptrs[file_pos]) != 0) && ret_status == SUCCESS)
+		   {
+			   #ifdef TRACE_ERROR
+			      Trace_Error("selftest - temp file : %s is not written \n", file_names[file_pos]);
+			   #endif
+			   ret_status = FAILURE;
+		   }
+	   }
+	   getrusage(RUSAGE_SELF, &usage);
+	   start_peak = usage.ru_maxrss;
+	   for(oper_pos = 0; oper_pos < sizeof(opers) / sizeof(opers[0]) && ret_status == SUCCESS; ++oper_pos)
+	   {
+		   start_clock = clock();
+		   if((ret_status = Big_Nums_Files(opers[oper_pos], file_names[operand_files[oper_pos][0]], file_names[operand_files[oper_pos][1]],
+		      file_names[FILE_RESULT], 0)) == SUCCESS)
+		   {
+			   ret_status = Self_Test_Files_Cmp(file_names[FILE_RESULT], file_names[operand_files[oper_pos][2]]);
+		   }
+		   oper_time = (double)(clock() - start_clock) / CLOCKS_PER_SEC;
+		   getrusage(RUSAGE_SELF, &usage);
+		   // ru_maxrss is in bytes on macOS, and in KB on others
+		   #if defined(__APPLE__)
+		      rss_bytes = (double)(usage.ru_maxrss - start_peak);
+		   #else
+		      rss_bytes = (double)(usage.ru_maxrss - start_peak) * 1024.0;
+		   #endif
+		   if(ret_status == SUCCESS && rss_bytes > (double)SELF_TEST_FILES_MAX_RSS_PER_DIGIT * (double)num_digits + (double)SELF_TEST_FILES_BASE_RSS_BYTES)
+		   {
+			   #ifdef TRACE_ERROR
+			      Trace_Error("selftest - --files %s of %lu digits grew peak resident memory by %.1f MB \n", oper_names[oper_pos], (unsigned long)num_digits,
+			         rss_bytes / (1024.0 * 1024.0));
+			   #endif
+			   ret_status = FAILURE;
+		   }
+		   printf("selftest files %-3s %8lu digits : %s, %.2f s, peak resident memory grew by %.1f MB, %.1f bytes per digit\n", oper_names[oper_pos],
+		      (unsigned long)num_digits, (ret_status == SUCCESS) ? "ok" : "FAILED", oper_time, rss_bytes / (1024.0 * 1024.0), rss_bytes / (double)num_digits);
+		   fflush(stdout);
+	   }
+	   for(file_pos = 0; file_pos < NUM_FILES; ++file_pos)
+	   {
+		   if(file_names[file_pos][0] != NULL_CHAR)
+		   {
+			   unlink(file_names[file_pos]);
+		   }
+	   }
+	   return ret_status;
+	#else
+	   (void)num_digits;
+	   (void)rand_state_ptr;
+	   printf("selftest files : skipped, operand files are not mapped\n");
+	   return SUCCESS;
+	#endif
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Self_Test_Files_Cmp
+
+DESCRIPTION    : checks that files have same chars
+
+INPUT          :
+
+OUTPUT         : returns FAILURE, if a file is not read, or files differ
+
+NOTE           : files are read in blocks of SELF_TEST_FILES_BLOCK_CHARS chars.
+
+Func ID        : 01.72
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Self_Test_Files_Cmp(const char *const file_name1, const char *const file_name2)
+{
+	FILE *file_ptrs[2];
+	char *block_ptr;
+	size_t num_chars1, num_chars2;
+	uint16_t ret_status = SUCCESS;
+
+	file_ptrs[0] = fopen(file_name1, "rb");
+	file_ptrs[1] = fopen(file_name2, "rb");
+	if(file_ptrs[0] == NULL_DATA_PTR || file_ptrs[1] == NULL_DATA_PTR || (block_ptr = malloc(2 * SELF_TEST_FILES_BLOCK_CHARS)) == NULL_DATA_PTR)
+	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("selftest - file : %s or %s is not read \n", file_name1, file_name2);
+		#endif
+		ret_status = FAILURE;
+	}
+	else
+	{
+		do
+		{
+			num_chars1 = fread(block_ptr, 1, SELF_TEST_FILES_BLOCK_CHARS, file_ptrs[0]);
+			num_chars2 = fread(block_ptr + SELF_TEST_FILES_BLOCK_CHARS, 1, SELF_TEST_FILES_BLOCK_CHARS, file_ptrs[1]);
+			if(num_chars1 != num_chars2 || memcmp(block_ptr, block_ptr + SELF_TEST_FILES_BLOCK_CHARS, num_chars1) != 0)
+			{
+				#ifdef TRACE_ERROR
+				   Trace_Error("selftest - file : %s differs from %s \n", file_name1, file_name2);
+				#endif
+				ret_status = FAILURE;
+			}
+		}
+		while(num_chars1 == SELF_TEST_FILES_BLOCK_CHARS && ret_status == SUCCESS);
+		free(block_ptr);
+	}
+	if(file_ptrs[0] != NULL_DATA_PTR)
+	{
+		fclose(file_ptrs[0]);
+	}
+	if(file_ptrs[1] != NULL_DATA_PTR)
+	{
+		fclose(file_ptrs[1]);
+	}
+	return ret_status;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Self_Test_Num_Str
+
+DESCRIPTION    : makes random big num str of num_int_digits digits before '.' char, and num_frac_digits digits after it
+
+INPUT          : num_str has atleast num_int_digits + num_frac_digits + 3 chars. num_int_digits is atleast 1.
+
+OUTPUT         : returns num_str, whose first digit is not 0
+
+NOTE           : digits are from xorshift generator of rand_state_ptr, so that operands are same in every run.
+
+Func ID        : 01.58
+
+BUGS           :
+-*------------------------------------------------------------*/
+char *Self_Test_Num_Str(char *const num_str, const size_t num_int_digits, const size_t num_frac_digits, const uint8_t sign_flag, uint64_t *const rand_state_ptr)
+{
+	size_t str_pos = 0, digit_pos;
+
+	if(sign_flag == BIG_NUM_SIGN_NEGATIVE)
+	{
+		num_str[str_pos++] = '-';
+	}
+	for(digit_pos = 0; digit_pos < num_int_digits + num_frac_digits; ++digit_pos)
+	{
+		if(digit_pos == num_int_digits)
+		{
+			num_str[str_pos++] = '.';
+		}
+		*rand_state_ptr ^= *rand_state_ptr << 13;
+		*rand_state_ptr ^= *rand_state_ptr >> 7;
+		*rand_state_ptr ^= *rand_state_ptr << 17;
+		num_str[str_pos++] = (char)((digit_pos == 0) ? '1' + (*rand_state_ptr >> 32) % 9 : '0' + (*rand_state_ptr >> 32) % 10);
+	}
+	num_str[str_pos] = NULL_CHAR;
+	return num_str;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Self_Test_Check_Str
+
+DESCRIPTION    : checks that num_str is big num result with precision_digits digits after '.' char
+
+INPUT          :
+
+OUTPUT         : returns FAILURE, if num_str is NULL or not of form of Big_Num_Format()
+
+NOTE           : integer part has no leading 0, other than single 0, and zero has no '-' char.
+
+Func ID        : 01.59
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Self_Test_Check_Str(const char *const num_str, const size_t precision_digits)
+{
+	size_t str_pos, num_int_digits = 0, num_frac_digits = 0;
+	uint8_t non_zero_state = STATE_NO;
+
+	if(num_str == NULL_DATA_PTR)
+	{
+		return FAILURE;
+	}
+	str_pos = (num_str[0] == '-') ? 1 : 0;
+	for(; num_str[str_pos] >= '0' && num_str[str_pos] <= '9'; ++str_pos, ++num_int_digits)
+	{
+		non_zero_state = (num_str[str_pos] != '0') ? STATE_YES : non_zero_state;
+	}
+	if(num_str[str_pos] == '.')
+	{
+		for(++str_pos; num_str[str_pos] >= '0' && num_str[str_pos] <= '9'; ++str_pos, ++num_frac_digits)
+		{
+			non_zero_state = (num_str[str_pos] != '0') ? STATE_YES : non_zero_state;
+		}
+		if(num_frac_digits == 0)
+		{
+			return FAILURE;
+		}
+	}
+	if(num_str[str_pos] != NULL_CHAR || num_int_digits == 0 || num_frac_digits != precision_digits ||
+	   (num_int_digits > 1 && num_str[(num_str[0] == '-') ? 1 : 0] == '0') || (num_str[0] == '-' && non_zero_state == STATE_NO))
+	{
+		return FAILURE;
+	}
+	return SUCCESS;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Self_Test_Residue
+
+DESCRIPTION    : finds (num_str without '.' char) * 10 ^ scale_digits modulo prime
+
+INPUT          : num_str has optional '-' char, digits and atmost one '.' char. scale_digits is atmost BIG_NUM_LIMB_DEC_DIGITS.
+
+OUTPUT         : returns residue less than prime, which is of negative value, if num_str has '-' char
+
+NOTE           : digits are read in groups of 18 digits by Horner's rule, independent of limbs conversion of big num.
+
+Func ID        : 01.60
+
+BUGS           :
+-*------------------------------------------------------------*/
+big_num_limb_t Self_Test_Residue(const char *const num_str, const size_t scale_digits, const big_num_limb_t prime)
+{
+	big_num_limb_t residue = 0, group_value = 0;
+	size_t str_pos, num_group_digits = 0;
+
+	for(str_pos = (num_str[0] == '-') ? 1 : 0; num_str[str_pos] != NULL_CHAR; ++str_pos)
+	{
+		if(num_str[str_pos] == '.')
+		{
+			continue;
+		}
+		group_value = (group_value * 10) + (big_num_limb_t)(num_str[str_pos] - '0');
+		if(++num_group_digits == 18)
+		{
+			residue = Self_Test_Mul_Mod(residue, limb_power_of_10[18], prime);
+			residue = (residue >= prime - (group_value % prime)) ? residue - (prime - (group_value % prime)) : residue + (group_value % prime);
+			group_value = 0;
+			num_group_digits = 0;
+		}
+	}
+	residue = Self_Test_Mul_Mod(residue, limb_power_of_10[num_group_digits], prime);
+	residue = (residue >= prime - (group_value % prime)) ? residue - (prime - (group_value % prime)) : residue + (group_value % prime);
+	residue = Self_Test_Mul_Mod(residue, limb_power_of_10[scale_digits] % prime, prime);
+	return (num_str[0] == '-' && residue != 0) ? prime - residue : residue;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Self_Test_Mul_Mod
+
+DESCRIPTION    : limb1 * limb2 modulo prime
+
+INPUT          : limb1 and limb2 are less than prime
+
+OUTPUT         :
+
+NOTE           :
+
+Func ID        : 01.61
+
+BUGS           :
+-*------------------------------------------------------------*/
+static inline big_num_limb_t Self_Test_Mul_Mod(const big_num_limb_t limb1, const big_num_limb_t limb2, const big_num_limb_t prime)
+{
+	big_num_limb_t low_limb, high_limb, rem;
+
+	low_limb = Limb_Mul_Full(limb1, limb2, &high_limb);
+	Limb_Div_2by1(high_limb, low_limb, prime, &rem);
+	return rem;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Self_Test_Cmp_Mag
+
+DESCRIPTION    : compares magnitudes of integers in str
+
+INPUT          : num_str1 and num_str2 have optional '-' char and digits without leading 0
+
+OUTPUT         : returns 1, 0 or -1, if |num_str1| is greater than, equal to or less than |num_str2|
+
+NOTE           :
+
+Func ID        : 01.62
+
+BUGS           :
+-*------------------------------------------------------------*/
+int Self_Test_Cmp_Mag(const char *const num_str1, const char *const num_str2)
+{
+	const char *mag_str1 = num_str1 + ((num_str1[0] == '-') ? 1 : 0), *mag_str2 = num_str2 + ((num_str2[0] == '-') ? 1 : 0);
+	size_t num_chars1 = strlen(mag_str1), num_chars2 = strlen(mag_str2);
+	int cmp_result;
+
+	if(num_chars1 != num_chars2)
+	{
+		return (num_chars1 > num_chars2) ? 1 : -1;
+	}
+	cmp_result = strcmp(mag_str1, mag_str2);
+	return (cmp_result > 0) - (cmp_result < 0);
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Self_Test_Bin
+
+DESCRIPTION    : checks round trip of big nums through binary format, and that corrupt bins are rejected
+
+INPUT          :
+
+OUTPUT         : returns FAILURE, if a big num changes by round trip, or a corrupt bin is accepted
+
+NOTE           : every bit of each bin is flipped in turn, and bins of wrong length, bad version, precision digits of more than
+                 max_operand_len with valid checksum, and limbs of more than max_operand_len digits are given. Big num, into
+                 which a bin is rejected, must keep its value. Error messages of rejected bins are not printed.
+
+Func ID        : 01.63
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Self_Test_Bin(void)
+{
+	const char *const num_strs[] = {"0", "7", "-1.5", "18446744073709551616", "-0.000000000000000000000000000001",
+	   "123456789012345678901234567890123456789012345678901234567890.0987654321"};
+	big_num_datas_t big_num_datas;
+	big_num_t num, load_num;
+	uint8_t *bin_ptr = NULL_DATA_PTR, *temp_bin_ptr, result_bin[BIG_NUM_BIN_HEADER_SIZE + BIG_NUM_BIN_CHECKSUM_SIZE + 8];
+	char *num_str;
+	big_num_limb_t checksum;
+	size_t str_pos, bin_len, bit_pos, word_pos, result_len, saved_max_operand_len = max_operand_len;
+	uint16_t ret_status = SUCCESS;
+
+	Big_Num_Init(&num);
+	Big_Num_Init(&load_num);
+	Set_Trace_Error_Print(STATE_NO);
+	for(str_pos = 0; str_pos < sizeof(num_strs) / sizeof(num_strs[0]) && ret_status == SUCCESS; ++str_pos)
+	{
+		free(bin_ptr);
+		if((Big_Num_From_Str(&num, num_strs[str_pos])) != SUCCESS || (bin_ptr = Big_Num_To_Bin(&num, NULL_DATA_PTR, 0, &bin_len)) == NULL_DATA_PTR ||
+		   (Big_Num_From_Bin(&load_num, bin_ptr, bin_len)) != SUCCESS)
+		{
+			ret_status = FAILURE;
+			break;
+		}
+		num_str = Big_Num_To_Str(&load_num);
+		if(num_str == NULL_DATA_PTR || strcmp(num_str, num_strs[str_pos]) != 0)
+		{
+			ret_status = FAILURE;
+		}
+		free(num_str);
+		for(bit_pos = 0; bit_pos < bin_len * 8 && ret_status == SUCCESS; ++bit_pos)
+		{
+			bin_ptr[bit_pos / 8] ^= (uint8_t)(1U << (bit_pos % 8));
+			if((Big_Num_From_Bin(&load_num, bin_ptr, bin_len)) == SUCCESS || Self_Test_Same_Num(&load_num, &num) != STATE_YES)
+			{
+				ret_status = FAILURE;
+			}
+			bin_ptr[bit_pos / 8] ^= (uint8_t)(1U << (bit_pos % 8));
+		}
+		// bin of one byte less, and of one limb more with 0 limb, have wrong length
+		if(ret_status != SUCCESS || (Big_Num_From_Bin(&load_num, bin_ptr, bin_len - 1)) == SUCCESS)
+		{
+			ret_status = FAILURE;
+			break;
+		}
+		if((temp_bin_ptr = realloc(bin_ptr, bin_len + sizeof(big_num_limb_t))) == NULL_DATA_PTR)
+		{
+			ret_status = FAILURE;
+			break;
+		}
+		bin_ptr = temp_bin_ptr;
+		memset(bin_ptr + bin_len, 0, sizeof(big_num_limb_t));
+		if((Big_Num_From_Bin(&load_num, bin_ptr, bin_len + sizeof(big_num_limb_t))) == SUCCESS)
+		{
+			ret_status = FAILURE;
+		}
+		bin_ptr[4] = BIG_NUM_BIN_VERSION + 1;
+		if((Big_Num_From_Bin(&load_num, bin_ptr, bin_len)) == SUCCESS || Self_Test_Same_Num(&load_num, &num) != STATE_YES)
+		{
+			ret_status = FAILURE;
+		}
+		bin_ptr[4] = BIG_NUM_BIN_VERSION;
+	}
+	// bin of 7 with precision digits of 200000000 and its checksum, as an operand of sum with bin of 5, is rejected at once
+	if(ret_status == SUCCESS && bin_ptr != NULL_DATA_PTR && (Big_Num_From_Str(&num, "7")) == SUCCESS &&
+	   (temp_bin_ptr = Big_Num_To_Bin(&num, NULL_DATA_PTR, 0, &bin_len)) != NULL_DATA_PTR)
+	{
+		free(bin_ptr);
+		bin_ptr = temp_bin_ptr;
+		Bin_Put_Limb(bin_ptr + 8, (big_num_limb_t)max_operand_len + 200000000);
+		for(checksum = BIG_NUM_BIN_CHECKSUM_SEED, word_pos = 0; word_pos < bin_len - BIG_NUM_BIN_CHECKSUM_SIZE; word_pos += sizeof(big_num_limb_t))
+		{
+			checksum = Bin_Checksum_Mix(checksum, Bin_Get_Limb(bin_ptr + word_pos));
+		}
+		Bin_Put_Limb(bin_ptr + bin_len - BIG_NUM_BIN_CHECKSUM_SIZE, checksum);
+		Init_Big_Num_Datas(&big_num_datas);
+		if((Big_Num_From_Str(&num, "5")) != SUCCESS || (temp_bin_ptr = Big_Num_To_Bin(&num, NULL_DATA_PTR, 0, &result_len)) == NULL_DATA_PTR ||
+		   (Big_Num_From_Bin(&load_num, bin_ptr, bin_len)) == SUCCESS || (Big_Nums_Oper_Bin(&big_num_datas, BIG_NUMS_SUM_OPER, temp_bin_ptr, result_len,
+		   bin_ptr, bin_len, 0, result_bin, sizeof(result_bin), &result_len)) == SUCCESS)
+		{
+			ret_status = FAILURE;
+		}
+		free(temp_bin_ptr);
+		Free_Big_Num_Datas(&big_num_datas);
+		// num of 60 digits has more limbs than num of 19 digits
+		Set_Max_Operand_Len(BIG_NUM_LIMB_DEC_DIGITS);
+		if((Big_Num_From_Str(&num, num_strs[5])) != SUCCESS || (temp_bin_ptr = Big_Num_To_Bin(&num, NULL_DATA_PTR, 0, &bin_len)) == NULL_DATA_PTR ||
+		   (Big_Num_From_Bin(&load_num, temp_bin_ptr, bin_len)) == SUCCESS || Self_Test_Same_Num(&load_num, &num) != STATE_YES)
+		{
+			ret_status = FAILURE;
+		}
+		free(temp_bin_ptr);
+		Set_Max_Operand_Len(saved_max_operand_len);
+	}
+	else
+	{
+		ret_status = FAILURE;
+	}
+	Set_Trace_Error_Print(STATE_YES);
+	free(bin_ptr);
+	Big_Num_Free(&num);
+	Big_Num_Free(&load_num);
+	return ret_status;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Self_Test_Same_Num
+
+DESCRIPTION    : whether num1 and num2 have same sign, precision digits and magnitude
+
+INPUT          :
+
+OUTPUT         : returns STATE_YES, if they are same
+
+NOTE           :
+
+Func ID        : 01.65
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint8_t Self_Test_Same_Num(const big_num_t *const num1_ptr, const big_num_t *const num2_ptr)
+{
+	if(num1_ptr->sign_flag != num2_ptr->sign_flag || num1_ptr->precision_digits != num2_ptr->precision_digits || Big_Num_Cmp_Mag(num1_ptr, num2_ptr) != 0)
+	{
+		return STATE_NO;
+	}
+	return STATE_YES;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Nums_Batch
+
+DESCRIPTION    : finds result of num_recs records of (oper, operand_str1, operand_str2, num_precision_digits) into results
+
+INPUT          :
+
+OUTPUT         : results_ptr[rec_pos] is result of recs_ptr[rec_pos]. Result strs are in one result block, which is returned in
+                 result_block_ptr_ptr, and caller is responsible for freeing it. status of failed record is FAILURE, and
+                 its error is reported as by Big_Nums_* operations, and with trace_error_print_state of STATE_NO, is kept
+                 in its error_msg. Returns FAILURE, only if memory of batch is not allocated.
+
+NOTE           : records of a window of BATCH_WINDOW_RECS records are done in order of Batch_Group_Key(), so that records of
+                 same oper and size class are done together, and then results are in their record order. Small operands are
+                 found by Small_Nums_Oper(), and others share one big num datas, whose limbs are reused from record to record, and the pow10 cache. Result strs are formatted
+                 directly into result block, which grows by doubling, so that allocation is amortised over records.
+
+Func ID        : 01.21
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Big_Nums_Batch(const big_nums_batch_rec_t *const recs_ptr, const size_t num_recs, big_nums_batch_result_t *const results_ptr, char **const result_block_ptr_ptr)
+{
+	big_num_datas_t batch_big_num_datas;
+	big_num_limb_t small_result_limbs[2];
+	big_num_t small_result_num = {small_result_limbs, 0, 2, 0, BIG_NUM_SIGN_POSITIVE};
+	const big_num_t *result_num_ptr;
+	const big_nums_batch_rec_t *rec_ptr;
+	char *result_block_ptr = NULL_DATA_PTR, *temp_block_ptr;
+	size_t group_counts[BATCH_NUM_SIZE_CLASSES * NUM_BIG_NUMS_OPER], rec_order[BATCH_WINDOW_RECS], *result_offset_ptr;
+	size_t rec_pos, order_pos, group_key, group_start, window_start, num_window_recs, block_size = 0, block_alloc_size = 0, max_result_chars;
+	uint16_t ret_status = SUCCESS;
+
+	if(recs_ptr == NULL_DATA_PTR || results_ptr == NULL_DATA_PTR || result_block_ptr_ptr == NULL_DATA_PTR)
+	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("batch - records, results or result block is null \n");
+		#endif
+		return FAILURE;
+	}
+	*result_block_ptr_ptr = NULL_DATA_PTR;
+	if(num_recs == 0)
+	{
+		return SUCCESS;
+	}
+	if((result_offset_ptr = malloc(num_recs * sizeof(size_t))) == NULL_DATA_PTR)
+	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("batch - memory alloc failed \n");
+		#endif
+		return FAILURE;
+	}
+	for(rec_pos = 0; rec_pos < num_recs; ++rec_pos)
+	{
+		results_ptr[rec_pos].result_ptr = NULL_DATA_PTR;
+		results_ptr[rec_pos].result_len = 0;
+		results_ptr[rec_pos].status = FAILURE;
+		results_ptr[rec_pos].error_msg[0] = NULL_CHAR;
+	}
+	Init_Big_Num_Datas(&batch_big_num_datas);
+	for(window_start = 0; window_start < num_recs && ret_status == SUCCESS; window_start += num_window_recs)
+	{
+		num_window_recs = (num_recs - window_start < BATCH_WINDOW_RECS) ? num_recs - window_start : BATCH_WINDOW_RECS;
+		/* records of window are ordered by counting sort of group key, which keeps record order within a group. Group key of
+		   record is kept in its result offset, till record is done */
+		memset(group_counts, 0, sizeof(group_counts));
+		for(rec_pos = window_start; rec_pos < window_start + num_window_recs; ++rec_pos)
+		{
+			result_offset_ptr[rec_pos] = Batch_Group_Key(&recs_ptr[rec_pos]);
+			++group_counts[result_offset_ptr[rec_pos]];
+		}
+		for(group_key = 0, group_start = 0; group_key < BATCH_NUM_SIZE_CLASSES * NUM_BIG_NUMS_OPER; ++group_key)
+		{
+			order_pos = group_counts[group_key];
+			group_counts[group_key] = group_start;
+			group_start += order_pos;
+		}
+		for(rec_pos = window_start; rec_pos < window_start + num_window_recs; ++rec_pos)
+		{
+			rec_order[group_counts[result_offset_ptr[rec_pos]]++] = rec_pos;
+		}
+		for(order_pos = 0; order_pos < num_window_recs; ++order_pos)
+		{
+			rec_pos = rec_order[order_pos];
+			rec_ptr = &recs_ptr[rec_pos];
+			trace_error_msg[0] = NULL_CHAR;
+			if((Small_Nums_Oper(&small_result_num, rec_ptr->big_num_arithmetic_oper, rec_ptr->operand_str1, rec_ptr->operand_str2, rec_ptr->num_precision_digits)) == STATE_YES)
+			{
+				result_num_ptr = &small_result_num;
+			}
+			else
+			{
+				batch_big_num_datas.operand_str1 = rec_ptr->operand_str1;
+				batch_big_num_datas.operand_str2 = rec_ptr->operand_str2;
+				if((Validate_Big_Num_Data(rec_ptr->big_num_arithmetic_oper, &batch_big_num_datas)) != SUCCESS ||
+				   (Big_Num_Oper(&batch_big_num_datas.result_num, rec_ptr->big_num_arithmetic_oper, &batch_big_num_datas.proc_num1, &batch_big_num_datas.proc_num2,
+				   rec_ptr->num_precision_digits)) != SUCCESS)
+				{
+					memcpy(results_ptr[rec_pos].error_msg, trace_error_msg, TRACE_ERROR_MSG_SIZE);
+					continue;
+				}
+				result_num_ptr = &batch_big_num_datas.result_num;
+			}
+			// a limb has less than 20 decimal digits, and str has atmost '-', '.' and null chars more than its digits
+			max_result_chars = (result_num_ptr->num_limbs * 20 > result_num_ptr->precision_digits) ? result_num_ptr->num_limbs * 20 : result_num_ptr->precision_digits + 1;
+			max_result_chars += 3;
+			if(block_alloc_size - block_size < max_result_chars)
+			{
+				block_alloc_size = (2 * block_alloc_size > block_size + max_result_chars) ? 2 * block_alloc_size : block_size + max_result_chars;
+				if((temp_block_ptr = realloc(result_block_ptr, block_alloc_size)) == NULL_DATA_PTR)
+				{
+					#ifdef TRACE_ERROR
+					   Trace_Error("batch - memory alloc failed \n");
+					#endif
+					ret_status = FAILURE;
+					break;
+				}
+				result_block_ptr = temp_block_ptr;
+			}
+			if((Big_Num_Format(result_num_ptr, result_block_ptr + block_size, block_alloc_size - block_size, &results_ptr[rec_pos].result_len)) == NULL_DATA_PTR)
+			{
+				memcpy(results_ptr[rec_pos].error_msg, trace_error_msg, TRACE_ERROR_MSG_SIZE);
+				continue;
+			}
+			result_offset_ptr[rec_pos] = block_size;
+			block_size += results_ptr[rec_pos].result_len + 1;
+			results_ptr[rec_pos].status = SUCCESS;
+		}
+	}
+	Free_Big_Num_Datas(&batch_big_num_datas);
+	/* result block is not moved any more, so that offsets of results are made into pointers */
+	for(rec_pos = 0; rec_pos < num_recs; ++rec_pos)
+	{
+		if(results_ptr[rec_pos].status == SUCCESS)
+		{
+			results_ptr[rec_pos].result_ptr = result_block_ptr + result_offset_ptr[rec_pos];
+		}
+	}
+	free(result_offset_ptr);
+	*result_block_ptr_ptr = result_block_ptr;
+	return ret_status;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Batch_Group_Key
+
+DESCRIPTION    : group key of batch record from its size class and oper
+
+INPUT          :
+
+OUTPUT         : returns key less than (BATCH_NUM_SIZE_CLASSES * NUM_BIG_NUMS_OPER)
+
+NOTE           : size class is num of bits of num of chars of longer operand, so that a size class has operands of upto
+                 twice the chars of its shortest operand. Invalid oper and null operand are grouped with oper 0 and 0 chars.
+
+Func ID        : 01.22
+
+BUGS           :
+-*------------------------------------------------------------*/
+size_t Batch_Group_Key(const big_nums_batch_rec_t *const rec_ptr)
+{
+	size_t num_chars1 = 0, num_chars2 = 0, size_class = 0;
+
+	if(rec_ptr->operand_str1 != NULL_DATA_PTR)
+	{
+		num_chars1 = strlen(rec_ptr->operand_str1);
+	}
+	if(rec_ptr->operand_str2 != NULL_DATA_PTR)
+	{
+		num_chars2 = strlen(rec_ptr->operand_str2);
+	}
+	for(num_chars1 = (num_chars1 > num_chars2) ? num_chars1 : num_chars2; num_chars1 != 0; num_chars1 >>= 1)
+	{
+		++size_class;
+	}
+	return (size_class * NUM_BIG_NUMS_OPER) + ((rec_ptr->big_num_arithmetic_oper < NUM_BIG_NUMS_OPER) ? rec_ptr->big_num_arithmetic_oper : 0);
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Nums_Batch_Parallel
+
+DESCRIPTION    : finds result of num_recs records of (oper, operand_str1, operand_str2, num_precision_digits) into results,
+                 by batch_num_threads threads
+
+INPUT          :
+
+OUTPUT         : as Big_Nums_Batch(). Result strs are in record order in result block, so that results are same for any num
+                 of threads.
+
+NOTE           : records are split into tasks of consecutive records of about equal cost by Batch_Rec_Cost(), and a record,
+                 whose cost is more than a task's, is a task by itself. Tasks are dealt to deques of workers in decreasing
+                 order of cost, so that costly tasks, like divisions of huge operands, start first, and a worker, whose deque
+                 is empty, steals cheapest task of another worker. Each task is done by Big_Nums_Batch() into its own
+                 result block, and calling thread works as first worker. Without pthreads, Big_Nums_Batch() is used.
+
+Func ID        : 01.24
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Big_Nums_Batch_Parallel(const big_nums_batch_rec_t *const recs_ptr, const size_t num_recs, big_nums_batch_result_t *const results_ptr,
+   char **const result_block_ptr_ptr)
+{
+	#ifdef BIG_NUM_PTHREADS
+	batch_parallel_t batch;
+	batch_task_t *task_ptr;
+	uint64_t *rec_costs_ptr, total_cost = 0, task_cost = 0, max_task_cost;
+	char *result_block_ptr;
+	size_t num_workers = batch_num_threads, num_tasks = 0, num_threads, rec_pos, task_pos, worker_id, order_pos, block_size = 0;
+	uint16_t ret_status = SUCCESS;
+	uint8_t prev_par_nested_state;
+
+	if(recs_ptr == NULL_DATA_PTR || results_ptr == NULL_DATA_PTR || result_block_ptr_ptr == NULL_DATA_PTR)
+	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("batch - records, results or result block is null \n");
+		#endif
+		return FAILURE;
+	}
+	if(num_workers == 0)
+	{
+		num_workers = Num_Online_Cpus();
+	}
+	if(num_workers > num_recs)
+	{
+		num_workers = num_recs;
+	}
+	if(num_workers <= 1)
+	{
+		return Big_Nums_Batch(recs_ptr, num_recs, results_ptr, result_block_ptr_ptr);
+	}
+	*result_block_ptr_ptr = NULL_DATA_PTR;
+	if((rec_costs_ptr = malloc(num_recs * sizeof(uint64_t))) == NULL_DATA_PTR)
+	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("batch - memory alloc failed \n");
+		#endif
+		return FAILURE;
+	}
+	for(rec_pos = 0; rec_pos < num_recs; ++rec_pos)
+	{
+		rec_costs_ptr[rec_pos] = Batch_Rec_Cost(&recs_ptr[rec_pos]);
+		total_cost += rec_costs_ptr[rec_pos];
+	}
+	/* a task ends before record, that makes its cost more than max task cost, or at end of window of Big_Nums_Batch() */
+	max_task_cost = total_cost / (num_workers * BATCH_TASKS_PER_THREAD) + 1;
+	for(rec_pos = 0, task_pos = 0; rec_pos < num_recs; ++rec_pos, ++task_pos)
+	{
+		if(task_pos == BATCH_WINDOW_RECS || (task_pos != 0 && task_cost + rec_costs_ptr[rec_pos] > max_task_cost))
+		{
+			++num_tasks;
+			task_cost = 0;
+			task_pos = 0;
+		}
+		task_cost += rec_costs_ptr[rec_pos];
+	}
+	++num_tasks;
+	batch.recs_ptr = recs_ptr;
+	batch.results_ptr = results_ptr;
+	batch.tasks_ptr = malloc(num_tasks * sizeof(batch_task_t));
+	batch.task_order_ptr = malloc(num_tasks * sizeof(size_t));
+	batch.workers_ptr = malloc(num_workers * sizeof(batch_worker_t));
+	if(batch.tasks_ptr == NULL_DATA_PTR || batch.task_order_ptr == NULL_DATA_PTR || batch.workers_ptr == NULL_DATA_PTR)
+	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("batch - memory alloc failed \n");
+		#endif
+		free(batch.tasks_ptr);
+		free(batch.task_order_ptr);
+		free(batch.workers_ptr);
+		free(rec_costs_ptr);
+		return FAILURE;
+	}
+	task_ptr = batch.tasks_ptr;
+	task_ptr->rec_start = 0;
+	task_ptr->num_recs = 0;
+	task_ptr->cost = 0;
+	for(rec_pos = 0; rec_pos < num_recs; ++rec_pos)
+	{
+		if(task_ptr->num_recs == BATCH_WINDOW_RECS || (task_ptr->num_recs != 0 && task_ptr->cost + rec_costs_ptr[rec_pos] > max_task_cost))
+		{
+			++task_ptr;
+			task_ptr->rec_start = rec_pos;
+			task_ptr->num_recs = 0;
+			task_ptr->cost = 0;
+		}
+		++task_ptr->num_recs;
+		task_ptr->cost += rec_costs_ptr[rec_pos];
+	}
+	free(rec_costs_ptr);
+	for(task_pos = 0; task_pos < num_tasks; ++task_pos)
+	{
+		batch.tasks_ptr[task_pos].result_block_ptr = NULL_DATA_PTR;
+		batch.tasks_ptr[task_pos].status = FAILURE;
+	}
+	qsort(batch.tasks_ptr, num_tasks, sizeof(batch_task_t), Batch_Task_Cmp);
+	/* worker_id gets tasks worker_id, worker_id + num_workers, ..., in decreasing order of cost */
+	if(num_workers > num_tasks)
+	{
+		num_workers = num_tasks;
+	}
+	batch.num_workers = num_workers;
+	for(worker_id = 0, order_pos = 0; worker_id < num_workers; ++worker_id)
+	{
+		batch.workers_ptr[worker_id].batch_ptr = &batch;
+		batch.workers_ptr[worker_id].worker_id = worker_id;
+		batch.workers_ptr[worker_id].head_pos = order_pos;
+		for(task_pos = worker_id; task_pos < num_tasks; task_pos += num_workers)
+		{
+			batch.task_order_ptr[order_pos++] = task_pos;
+		}
+		batch.workers_ptr[worker_id].tail_pos = order_pos;
+		pthread_mutex_init(&batch.workers_ptr[worker_id].deque_mutex, NULL_DATA_PTR);
+	}
+	/* tasks of worker, whose thread is not created, are stolen by other workers */
+	for(num_threads = 1; num_threads < num_workers; ++num_threads)
+	{
+		if((pthread_create(&batch.workers_ptr[num_threads].thread, NULL_DATA_PTR, Batch_Worker, &batch.workers_ptr[num_threads])) != 0)
+		{
+			#ifdef TRACE_ERROR
+			   Trace_Error("batch - only %lu of %lu threads created \n", (unsigned long)num_threads, (unsigned long)num_workers);
+			#endif
+			break;
+		}
+	}
+	prev_par_nested_state = par_nested_state;
+	Batch_Worker(&batch.workers_ptr[0]);
+	par_nested_state = prev_par_nested_state;
+	for(worker_id = 1; worker_id < num_threads; ++worker_id)
+	{
+		pthread_join(batch.workers_ptr[worker_id].thread, NULL_DATA_PTR);
+	}
+	for(worker_id = 0; worker_id < num_workers; ++worker_id)
+	{
+		pthread_mutex_destroy(&batch.workers_ptr[worker_id].deque_mutex);
+	}
+	/* results of tasks are copied in record order into result block */
+	for(task_pos = 0; task_pos < num_tasks; ++task_pos)
+	{
+		if(batch.tasks_ptr[task_pos].status != SUCCESS)
+		{
+			ret_status = FAILURE;
+		}
+	}
+	for(rec_pos = 0; rec_pos < num_recs; ++rec_pos)
+	{
+		if(results_ptr[rec_pos].status == SUCCESS)
+		{
+			block_size += results_ptr[rec_pos].result_len + 1;
+		}
+	}
+	if(block_size != 0)
+	{
+		if((result_block_ptr = malloc(block_size)) == NULL_DATA_PTR)
+		{
+			#ifdef TRACE_ERROR
+			   Trace_Error("batch - memory alloc failed \n");
+			#endif
+			ret_status = FAILURE;
+		}
+		for(rec_pos = 0, block_size = 0; rec_pos < num_recs; ++rec_pos)
+		{
+			if(results_ptr[rec_pos].status != SUCCESS)
+			{
+				continue;
+			}
+			if(result_block_ptr == NULL_DATA_PTR)
+			{
+				results_ptr[rec_pos].result_ptr = NULL_DATA_PTR;
+				results_ptr[rec_pos].result_len = 0;
+				results_ptr[rec_pos].status = FAILURE;
+				continue;
+			}
+			memcpy(result_block_ptr + block_size, results_ptr[rec_pos].result_ptr, results_ptr[rec_pos].result_len + 1);
+			results_ptr[rec_pos].result_ptr = result_block_ptr + block_size;
+			block_size += results_ptr[rec_pos].result_len + 1;
+		}
+		*result_block_ptr_ptr = result_block_ptr;
+	}
+	for(task_pos = 0; task_pos < num_tasks; ++task_pos)
+	{
+		free(batch.tasks_ptr[task_pos].result_block_ptr);
+	}
+	free(batch.tasks_ptr);
+	free(batch.task_order_ptr);
+	free(batch.workers_ptr);
+	return ret_status;
+	#else
+	return Big_Nums_Batch(recs_ptr, num_recs, results_ptr, result_block_ptr_ptr);
+	#endif
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Batch_Rec_Cost
+
+DESCRIPTION    : estimated cost of batch record from num of chars of its operands
+
+INPUT          :
+
+OUTPUT         : returns cost in units of about a limb operation
+
+NOTE           : str conversion, add and subtract are linear in num of limbs. Multiply of m x n limbs, m >= n, is m * n
+                 below Karatsuba threshold, and grows as m * n ^ 0.585 above it, ie each halving of n above threshold makes
+                 3 half size multiplies instead of 4, so that m * n is scaled by 3 / 4 per halving, in integers. Division and
+                 modulus are about twice of multiply of quotient by divisor.
+
+Func ID        : 01.25
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint64_t Batch_Rec_Cost(const big_nums_batch_rec_t *const rec_ptr)
+{
+	uint64_t num_limbs1 = 1, num_limbs2 = 1, max_limbs, min_limbs, num_mul_opers = 1, mul_cost, split_limbs;
+
+	if(rec_ptr->operand_str1 != NULL_DATA_PTR)
+	{
+		num_limbs1 += strlen(rec_ptr->operand_str1) / BIG_NUM_LIMB_DEC_DIGITS;
+	}
+	if(rec_ptr->operand_str2 != NULL_DATA_PTR)
+	{
+		num_limbs2 += strlen(rec_ptr->operand_str2) / BIG_NUM_LIMB_DEC_DIGITS;
+	}
+	switch(rec_ptr->big_num_arithmetic_oper)
+	{
+		case BIG_NUMS_SUM_OPER:
+		case BIG_NUMS_SUBTRACT_OPER:
+		   return 2 * (num_limbs1 + num_limbs2);
+		case BIG_NUMS_MULTIPLY_OPER:
+		   max_limbs = num_limbs1;
+		   min_limbs = num_limbs2;
+		break;
+		case BIG_NUMS_DIVISION_OPER:
+		case BIG_NUMS_MODULUS_OPER:
+		   // quotient limbs, with limbs of precision digits of division
+		   max_limbs = (num_limbs1 > num_limbs2) ? num_limbs1 - num_limbs2 + 1 : 1;
+		   if(rec_ptr->big_num_arithmetic_oper == BIG_NUMS_DIVISION_OPER)
+		   {
+			   max_limbs += rec_ptr->num_precision_digits / BIG_NUM_LIMB_DEC_DIGITS;
+		   }
+		   min_limbs = num_limbs2;
+		   num_mul_opers = 2;
+		break;
+		default:
+		   return num_limbs1 + num_limbs2;
+	}
+	if(max_limbs < min_limbs)
+	{
+		Swap_Two_Datas(&max_limbs, &min_limbs, sizeof(uint64_t));
+	}
+	mul_cost = max_limbs * min_limbs;
+	for(split_limbs = min_limbs; split_limbs / 2 >= karatsuba_threshold && split_limbs > 1; split_limbs >>= 1)
+	{
+		mul_cost -= mul_cost >> 2;
+	}
+	return num_limbs1 + num_limbs2 + num_mul_opers * mul_cost;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Batch_Task_Cmp
+
+DESCRIPTION    : compares batch tasks for qsort() in decreasing order of cost
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           : tasks of same cost are in order of their first record, so that order of tasks is same on every run.
+
+Func ID        : 01.26
+
+BUGS           :
+-*------------------------------------------------------------*/
+int Batch_Task_Cmp(const void *const task1_ptr, const void *const task2_ptr)
+{
+	const batch_task_t *const batch_task1_ptr = (const batch_task_t *)task1_ptr, *const batch_task2_ptr = (const batch_task_t *)task2_ptr;
+
+	if(batch_task1_ptr->cost != batch_task2_ptr->cost)
+	{
+		return (batch_task1_ptr->cost > batch_task2_ptr->cost) ? -1 : 1;
+	}
+	return (batch_task1_ptr->rec_start < batch_task2_ptr->rec_start) ? -1 : (batch_task1_ptr->rec_start > batch_task2_ptr->rec_start);
+}
+
+#ifdef BIG_NUM_PTHREADS
+/*------------------------------------------------------------*
+FUNCTION NAME  : Batch_Worker
+
+DESCRIPTION    : does tasks of Big_Nums_Batch_Parallel(), till no worker has a task left
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           : as tasks are not added after workers start, worker ends, when its deque and deques of all other workers
+                 are empty. Worker thread, other than calling thread, pins itself to a CPU, if batch_cpu_affinity_state
+                 is STATE_YES, and frees its scratch arena before exit. Multiplications of worker are not split into
+                 threads, as all workers are busy.
+
+Func ID        : 01.27
+
+BUGS           :
+-*------------------------------------------------------------*/
+void *Batch_Worker(void *const worker_ptr)
+{
+	batch_worker_t *const batch_worker_ptr = (batch_worker_t *)worker_ptr;
+	batch_parallel_t *const batch_ptr = batch_worker_ptr->batch_ptr;
+	batch_task_t *task_ptr;
+	size_t task_pos;
+	#ifdef BIG_NUM_CPU_AFFINITY
+	cpu_set_t allowed_cpus, worker_cpus;
+	size_t cpu_id, num_cpus, cpu_pos;
+	#endif
+
+	#ifdef BIG_NUM_CPU_AFFINITY
+	if(batch_worker_ptr->worker_id != 0 && batch_cpu_affinity_state == STATE_YES && (sched_getaffinity(0, sizeof(allowed_cpus), &allowed_cpus)) == 0 &&
+	   (num_cpus = (size_t)CPU_COUNT(&allowed_cpus)) != 0)
+	{
+		cpu_pos = batch_worker_ptr->worker_id % num_cpus;
+		for(cpu_id = 0; cpu_pos != 0 || !CPU_ISSET(cpu_id, &allowed_cpus); ++cpu_id)
+		{
+			if(CPU_ISSET(cpu_id, &allowed_cpus))
+			{
+				--cpu_pos;
+			}
+		}
+		CPU_ZERO(&worker_cpus);
+		CPU_SET(cpu_id, &worker_cpus);
+		if((pthread_setaffinity_np(pthread_self(), sizeof(worker_cpus), &worker_cpus)) != 0)
+		{
+			#ifdef TRACE_ERROR
+			   Trace_Error("batch - worker %lu not pinned to CPU %lu \n", (unsigned long)batch_worker_ptr->worker_id, (unsigned long)cpu_id);
+			#endif
+		}
+	}
+	#endif
+	par_nested_state = STATE_YES;
+	while((task_pos = Batch_Worker_Next_Task(batch_worker_ptr)) != SIZE_MAX)
+	{
+		task_ptr = &batch_ptr->tasks_ptr[task_pos];
+		task_ptr->status = Big_Nums_Batch(batch_ptr->recs_ptr + task_ptr->rec_start, task_ptr->num_recs, batch_ptr->results_ptr + task_ptr->rec_start,
+		   &task_ptr->result_block_ptr);
+	}
+	if(batch_worker_ptr->worker_id != 0)
+	{
+		Big_Num_Scratch_Release();
+	}
+	return NULL_DATA_PTR;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Batch_Worker_Next_Task
+
+DESCRIPTION    : pops task at head of deque of worker, or else steals task at tail of deque of next worker, that has a task
+
+INPUT          :
+
+OUTPUT         : returns index of task, or SIZE_MAX, if no worker has a task left
+
+NOTE           : head of deque has costliest task of worker, so that a thief takes cheapest task, and owner keeps its
+                 costly tasks, which it started first.
+
+Func ID        : 01.28
+
+BUGS           :
+-*------------------------------------------------------------*/
+size_t Batch_Worker_Next_Task(batch_worker_t *const worker_ptr)
+{
+	batch_parallel_t *const batch_ptr = worker_ptr->batch_ptr;
+	batch_worker_t *victim_ptr;
+	size_t task_pos = SIZE_MAX, victim_id;
+
+	pthread_mutex_lock(&worker_ptr->deque_mutex);
+	if(worker_ptr->head_pos < worker_ptr->tail_pos)
+	{
+		task_pos = batch_ptr->task_order_ptr[worker_ptr->head_pos++];
+	}
+	pthread_mutex_unlock(&worker_ptr->deque_mutex);
+	for(victim_id = 1; task_pos == SIZE_MAX && victim_id < batch_ptr->num_workers; ++victim_id)
+	{
+		victim_ptr = &batch_ptr->workers_ptr[(worker_ptr->worker_id + victim_id) % batch_ptr->num_workers];
+		pthread_mutex_lock(&victim_ptr->deque_mutex);
+		if(victim_ptr->head_pos < victim_ptr->tail_pos)
+		{
+			task_pos = batch_ptr->task_order_ptr[--victim_ptr->tail_pos];
+		}
+		pthread_mutex_unlock(&victim_ptr->deque_mutex);
+	}
+	return task_pos;
+}
+#endif
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Batch_Cli
+
+DESCRIPTION    : does records of lines of "oper operand_str1 operand_str2 [num_precision_digits]" from input file, or from
+                 stdin, if input_file_name is NULL, and writes result of each record as a line in stdout
+
+INPUT          : oper is as of Big_Nums_Oper_From_Name(). num_precision_digits is only for
+                 division, and is REQ_PRECISION_DIGITS by default. Fields are separated by spaces or tabs. Blank lines and
+                 lines, whose first field starts with '#', are skipped.
+
+OUTPUT         : returns BATCH_CLI_EXIT_OK, if all records are done, BATCH_CLI_EXIT_REC_FAILED, if some records failed, or
+                 BATCH_CLI_EXIT_IO_FAILED, if input, output or memory failed, in which case records after failure are not done.
+
+NOTE           : failed record has empty line in stdout, and "line <line num>: <error>" line in stderr, instead of ERR message
+                 in stdout. Input is read in chunks of BATCH_CLI_IO_BUF_SIZE chars into read buffer, and records of its complete
+                 lines are parsed in place and done by Big_Nums_Batch_Parallel() in runs of upto BATCH_CLI_MAX_RECS records.
+                 stdout is fully buffered by BATCH_CLI_IO_BUF_SIZE chars. Line of more than 2 * max_operand_len +
+                 BATCH_CLI_LINE_SLACK chars is failed without reading it into memory.
+
+Func ID        : 01.33
+
+BUGS           :
+-*------------------------------------------------------------*/
+int Batch_Cli(const char *const input_file_name)
+{
+	FILE *input_file_ptr = stdin;
+	batch_cli_recs_t *cli_recs_ptr;
+	char *read_buf_ptr, *temp_buf_ptr, *line_ptr, *line_end_ptr;
+	size_t read_buf_size = BATCH_CLI_IO_BUF_SIZE, max_read_buf_size, buf_len = 0, line_start, num_read_chars, rec_pos;
+	uint64_t line_num = 0;
+	int exit_status = BATCH_CLI_EXIT_OK;
+	uint8_t eof_state = STATE_NO, skip_line_state = STATE_NO, rec_state;
+
+	if(input_file_name != NULL_DATA_PTR && (input_file_ptr = fopen(input_file_name, "rb")) == NULL_DATA_PTR)
+	{
+		fprintf(stderr, "batch - input file : %s is not opened \n", input_file_name);
+		return BATCH_CLI_EXIT_IO_FAILED;
+	}
+	cli_recs_ptr = malloc(sizeof(batch_cli_recs_t));
+	read_buf_ptr = malloc(read_buf_size + 1);
+	if(cli_recs_ptr == NULL_DATA_PTR || read_buf_ptr == NULL_DATA_PTR)
+	{
+		fprintf(stderr, "batch - memory alloc failed \n");
+		free(cli_recs_ptr);
+		free(read_buf_ptr);
+		if(input_file_ptr != stdin)
+		{
+			fclose(input_file_ptr);
+		}
+		return BATCH_CLI_EXIT_IO_FAILED;
+	}
+	max_read_buf_size = (max_operand_len < (SIZE_MAX - BATCH_CLI_LINE_SLACK) / 2) ? 2 * max_operand_len + BATCH_CLI_LINE_SLACK : SIZE_MAX - 1;
+	cli_recs_ptr->num_recs = 0;
+	cli_recs_ptr->rec_failed_state = STATE_NO;
+	setvbuf(stdout, batch_cli_out_buf, _IOFBF, BATCH_CLI_IO_BUF_SIZE);
+	Set_Trace_Error_Print(STATE_NO);
+	while(eof_state == STATE_NO && exit_status != BATCH_CLI_EXIT_IO_FAILED)
+	{
+		num_read_chars = fread(read_buf_ptr + buf_len, 1, read_buf_size - buf_len, input_file_ptr);
+		if(num_read_chars == 0)
+		{
+			if(ferror(input_file_ptr))
+			{
+				fprintf(stderr, "batch - input read failed \n");
+				exit_status = BATCH_CLI_EXIT_IO_FAILED;
+				break;
+			}
+			eof_state = STATE_YES;
+		}
+		buf_len += num_read_chars;
+		for(line_start = 0; exit_status != BATCH_CLI_EXIT_IO_FAILED; line_start = (size_t)(line_end_ptr - read_buf_ptr) + 1)
+		{
+			line_ptr = read_buf_ptr + line_start;
+			if((line_end_ptr = memchr(line_ptr, '\n', buf_len - line_start)) == NULL_DATA_PTR)
+			{
+				// last line of input need not end with newline, and rest of skipped line is failed at end of input
+				if(eof_state == STATE_NO || (line_start == buf_len && skip_line_state == STATE_NO))
+				{
+					break;
+				}
+				line_end_ptr = read_buf_ptr + buf_len;
+			}
+			*line_end_ptr = NULL_CHAR;
+			++line_num;
+			rec_pos = cli_recs_ptr->num_recs;
+			rec_state = STATE_YES;
+			if(skip_line_state == STATE_YES)
+			{
+				skip_line_state = STATE_NO;
+				cli_recs_ptr->recs[rec_pos].big_num_arithmetic_oper = 0;
+				cli_recs_ptr->recs[rec_pos].operand_str1 = NULL_DATA_PTR;
+				cli_recs_ptr->recs[rec_pos].operand_str2 = NULL_DATA_PTR;
+				cli_recs_ptr->parse_error_ptrs[rec_pos] = "line exceeds max chars";
+			}
+			else
+			{
+				rec_state = Batch_Cli_Parse_Line(line_ptr, &cli_recs_ptr->recs[rec_pos], &cli_recs_ptr->parse_error_ptrs[rec_pos]);
+			}
+			if(rec_state == STATE_YES)
+			{
+				cli_recs_ptr->line_nums[rec_pos] = line_num;
+				if(++cli_recs_ptr->num_recs == BATCH_CLI_MAX_RECS && (Batch_Cli_Flush(cli_recs_ptr)) != SUCCESS)
+				{
+					exit_status = BATCH_CLI_EXIT_IO_FAILED;
+				}
+			}
+			if(line_end_ptr == read_buf_ptr + buf_len)
+			{
+				line_start = buf_len;
+				break;
+			}
+		}
+		// records point into read buffer, so that they are done, before their lines are moved out
+		if(exit_status == BATCH_CLI_EXIT_IO_FAILED || (Batch_Cli_Flush(cli_recs_ptr)) != SUCCESS)
+		{
+			exit_status = BATCH_CLI_EXIT_IO_FAILED;
+			break;
+		}
+		buf_len -= line_start;
+		memmove(read_buf_ptr, read_buf_ptr + line_start, buf_len);
+		if(buf_len == read_buf_size)
+		{
+			if(read_buf_size >= max_read_buf_size)
+			{
+				// chars of too long line are dropped, till its newline
+				skip_line_state = STATE_YES;
+				buf_len = 0;
+				continue;
+			}
+			read_buf_size = (read_buf_size < max_read_buf_size / 2) ? 2 * read_buf_size : max_read_buf_size;
+			if((temp_buf_ptr = realloc(read_buf_ptr, read_buf_size + 1)) == NULL_DATA_PTR)
+			{
+				fprintf(stderr, "batch - memory alloc failed \n");
+				exit_status = BATCH_CLI_EXIT_IO_FAILED;
+				break;
+			}
+			read_buf_ptr = temp_buf_ptr;
+		}
+	}
+	Set_Trace_Error_Print(STATE_YES);
+	if(fflush(stdout) != 0 || ferror(stdout))
+	{
+		exit_status = BATCH_CLI_EXIT_IO_FAILED;
+	}
+	if(exit_status == BATCH_CLI_EXIT_OK && cli_recs_ptr->rec_failed_state == STATE_YES)
+	{
+		exit_status = BATCH_CLI_EXIT_REC_FAILED;
+	}
+	free(cli_recs_ptr);
+	free(read_buf_ptr);
+	if(input_file_ptr != stdin)
+	{
+		fclose(input_file_ptr);
+	}
+	return exit_status;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Batch_Cli_Parse_Line
+
+DESCRIPTION    : parses line of "oper operand_str1 operand_str2 [num_precision_digits]" of Batch_Cli() into batch record
+
+INPUT          : line is null terminated, and its fields are null terminated in place, to which record points
+
+OUTPUT         : returns STATE_NO, if line is blank or comment, else STATE_YES. parse_error_ptr_ptr has NULL, if record is
+                 parsed, or error of line, in which case oper of record is 0 and its operands are NULL.
+
+NOTE           : operand strs are validated, when record is done.
+
+Func ID        : 01.34
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint8_t Batch_Cli_Parse_Line(char *const line_ptr, big_nums_batch_rec_t *const rec_ptr, const char **const parse_error_ptr_ptr)
+{
+	char *field_ptrs[5], *char_ptr = line_ptr;
+	size_t num_fields = 0, num_precision_digits = 0;
+	uint8_t oper;
+
+	rec_ptr->big_num_arithmetic_oper = 0;
+	rec_ptr->operand_str1 = NULL_DATA_PTR;
+	rec_ptr->operand_str2 = NULL_DATA_PTR;
+	rec_ptr->num_precision_digits = REQ_PRECISION_DIGITS;
+	*parse_error_ptr_ptr = NULL_DATA_PTR;
+	// one field more than max fields is found, so that extra fields are detected
+	while(num_fields < 5)
+	{
+		while(*char_ptr == ' ' || *char_ptr == '\t' || *char_ptr == '\r')
+		{
+			++char_ptr;
+		}
+		if(*char_ptr == NULL_CHAR)
+		{
+			break;
+		}
+		field_ptrs[num_fields++] = char_ptr;
+		while(*char_ptr != NULL_CHAR && *char_ptr != ' ' && *char_ptr != '\t' && *char_ptr != '\r')
+		{
+			++char_ptr;
+		}
+		if(*char_ptr != NULL_CHAR)
+		{
+			*char_ptr++ = NULL_CHAR;
+		}
+	}
+	if(num_fields == 0 || field_ptrs[0][0] == '#')
+	{
+		return STATE_NO;
+	}
+	if(num_fields < 3 || num_fields > 4)
+	{
+		*parse_error_ptr_ptr = "expected : oper operand_str1 operand_str2 [num_precision_digits]";
+		return STATE_YES;
+	}
+	if((oper = Big_Nums_Oper_From_Name(field_ptrs[0])) == 0)
+	{
+		*parse_error_ptr_ptr = "invalid big num operation";
+		return STATE_YES;
+	}
+	if(num_fields == 4)
+	{
+		if(oper != BIG_NUMS_DIVISION_OPER)
+		{
+			*parse_error_ptr_ptr = "num_precision_digits is only for division";
+			return STATE_YES;
+		}
+		if((Precision_Digits_From_Str(field_ptrs[3], &num_precision_digits)) != SUCCESS)
+		{
+			*parse_error_ptr_ptr = "num_precision_digits is invalid or exceeds max operand len";
+			return STATE_YES;
+		}
+		rec_ptr->num_precision_digits = num_precision_digits;
+	}
+	rec_ptr->big_num_arithmetic_oper = oper;
+	rec_ptr->operand_str1 = field_ptrs[1];
+	rec_ptr->operand_str2 = field_ptrs[2];
+	return STATE_YES;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Batch_Cli_Flush
+
+DESCRIPTION    : does records of Batch_Cli() by Big_Nums_Batch_Parallel(), and writes their results in stdout and their
+                 errors in stderr
+
+INPUT          :
+
+OUTPUT         : returns FAILURE, if output or memory failed. rec_failed_state is STATE_YES, if a record failed.
+
+NOTE           : error message of failed record is kept in its result by thread, that did it. Records are removed after
+                 they are done.
+
+Func ID        : 01.35
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Batch_Cli_Flush(batch_cli_recs_t *const cli_recs_ptr)
+{
+	big_nums_batch_result_t *result_ptr;
+	char *result_block_ptr = NULL_DATA_PTR;
+	const char *error_ptr;
+	size_t rec_pos;
+
+	if(cli_recs_ptr->num_recs == 0)
+	{
+		return SUCCESS;
+	}
+	if((Big_Nums_Batch_Parallel(cli_recs_ptr->recs, cli_recs_ptr->num_recs, cli_recs_ptr->results, &result_block_ptr)) != SUCCESS)
+	{
+		fprintf(stderr, "batch - memory alloc failed \n");
+		free(result_block_ptr);
+		cli_recs_ptr->num_recs = 0;
+		return FAILURE;
+	}
+	for(rec_pos = 0; rec_pos < cli_recs_ptr->num_recs; ++rec_pos)
+	{
+		result_ptr = &cli_recs_ptr->results[rec_pos];
+		error_ptr = cli_recs_ptr->parse_error_ptrs[rec_pos];
+		if(result_ptr->status != SUCCESS && error_ptr == NULL_DATA_PTR)
+		{
+			error_ptr = (result_ptr->error_msg[0] != NULL_CHAR) ? result_ptr->error_msg : "big num operation failed";
+		}
+		if(error_ptr != NULL_DATA_PTR)
+		{
+			cli_recs_ptr->rec_failed_state = STATE_YES;
+			fprintf(stderr, "line %llu: %s\n", (unsigned long long)cli_recs_ptr->line_nums[rec_pos], error_ptr);
+		}
+		else
+		{
+			fwrite(result_ptr->result_ptr, 1, result_ptr->result_len, stdout);
+		}
+		putchar('\n');
+	}
+	free(result_block_ptr);
+	cli_recs_ptr->num_recs = 0;
+	return (ferror(stdout)) ? FAILURE : SUCCESS;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Nums_Expr_Compile
+
+DESCRIPTION    : compiles arithmetic expression of big nums and named variables, into plan of instructions on registers
+
+INPUT          : expr_str has decimal nums, variables of letters, digits and '_' not starting with digit, binary +, -, *, /, %,
+                 unary - and +, and parentheses, where *, / and % bind tighter than + and -, and operators of same level are
+                 left associative. num_precision_digits is used by every division of plan.
+
+OUTPUT         : on success, plan has num_vars variables in order of their first use in expr_str, and caller is responsible for
+                 freeing it by Big_Nums_Expr_Free().
+
+NOTE           : expression is parsed once by recursive descent of Expr_Parse_Sum(). Registers of plan are variables, then
+                 constants converted at compile, then temporaries, which are reused by stack order, so that plan has atmost one
+                 temporary per level of nesting. Unary - is 0 - operand.
+
+Func ID        : 01.41
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Big_Nums_Expr_Compile(expr_plan_t *const plan_ptr, const char *const expr_str, const size_t num_precision_digits)
+{
+	expr_parser_t parser;
+	size_t reg_pos, instr_pos, result_reg;
+
+	if(plan_ptr == NULL_DATA_PTR || expr_str == NULL_DATA_PTR)
+	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("expr - plan or expr str is null \n");
+		#endif
+		return FAILURE;
+	}
+	memset(plan_ptr, 0, sizeof(expr_plan_t));
+	Big_Num_Init(&plan_ptr->oper_result_num);
+	plan_ptr->num_precision_digits = num_precision_digits;
+	memset(&parser, 0, sizeof(expr_parser_t));
+	parser.plan_ptr = plan_ptr;
+	parser.expr_str = expr_str;
+	parser.zero_reg = EXPR_INVALID_REG;
+	result_reg = Expr_Parse_Sum(&parser);
+	while(expr_str[parser.str_pos] == ' ' || expr_str[parser.str_pos] == '\t')
+	{
+		++parser.str_pos;
+	}
+	if(result_reg != EXPR_INVALID_REG && expr_str[parser.str_pos] != NULL_CHAR)
+	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("expr - unexpected char : %c at pos : %lu \n", expr_str[parser.str_pos], (unsigned long)parser.str_pos);
+		#endif
+		result_reg = EXPR_INVALID_REG;
+	}
+	if(result_reg != EXPR_INVALID_REG)
+	{
+		plan_ptr->num_regs = plan_ptr->num_vars + parser.num_consts + parser.max_used_temps;
+		if((plan_ptr->regs_ptr = malloc((plan_ptr->num_regs + 1) * sizeof(big_num_t))) == NULL_DATA_PTR)
+		{
+			#ifdef TRACE_ERROR
+			   Trace_Error("expr - memory alloc failed \n");
+			#endif
+			result_reg = EXPR_INVALID_REG;
+		}
+	}
+	if(result_reg == EXPR_INVALID_REG)
+	{
+		for(reg_pos = 0; reg_pos < parser.num_consts; ++reg_pos)
+		{
+			Big_Num_Free(&parser.consts_ptr[reg_pos]);
+		}
+		free(parser.consts_ptr);
+		plan_ptr->num_regs = 0;
+		Big_Nums_Expr_Free(plan_ptr);
+		return FAILURE;
+	}
+	// constants are moved into their registers, and registers of instructions are relocated
+	for(reg_pos = 0; reg_pos < plan_ptr->num_regs; ++reg_pos)
+	{
+		Big_Num_Init(&plan_ptr->regs_ptr[reg_pos]);
+	}
+	if(parser.num_consts != 0)
+	{
+		memcpy(plan_ptr->regs_ptr + plan_ptr->num_vars, parser.consts_ptr, parser.num_consts * sizeof(big_num_t));
+	}
+	free(parser.consts_ptr);
+	for(instr_pos = 0; instr_pos < plan_ptr->num_instrs; ++instr_pos)
+	{
+		plan_ptr->instrs_ptr[instr_pos].dest_reg = Expr_Reg_Pos(plan_ptr->instrs_ptr[instr_pos].dest_reg, plan_ptr->num_vars, parser.num_consts);
+		plan_ptr->instrs_ptr[instr_pos].src_reg1 = Expr_Reg_Pos(plan_ptr->instrs_ptr[instr_pos].src_reg1, plan_ptr->num_vars, parser.num_consts);
+		plan_ptr->instrs_ptr[instr_pos].src_reg2 = Expr_Reg_Pos(plan_ptr->instrs_ptr[instr_pos].src_reg2, plan_ptr->num_vars, parser.num_consts);
+	}
+	plan_ptr->result_reg = Expr_Reg_Pos(result_reg, plan_ptr->num_vars, parser.num_consts);
+	return SUCCESS;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Nums_Expr_Run
+
+DESCRIPTION    : evaluates plan of Big_Nums_Expr_Compile() for values of its variables
+
+INPUT          : var_strs_ptr has num_vars big nums in str, in order of variables of plan
+
+OUTPUT         : returns register of plan, which has result, till next call or Big_Nums_Expr_Free(), or NULL on failure
+
+NOTE           : each var str is validated by Validate_Operand_Str(), and each instruction is done by Big_Num_Oper() as of
+                 Big_Nums_* operations, and operands of modulus must be integers. Result of instruction is found in oper_result_num and swapped into its register, so that limbs
+                 of registers are reused from instruction to instruction and from evaluation to evaluation. A plan must be
+                 used by one thread at a time.
+
+Func ID        : 01.42
+
+BUGS           :
+-*------------------------------------------------------------*/
+const big_num_t *Big_Nums_Expr_Run(expr_plan_t *const plan_ptr, const char *const *const var_strs_ptr)
+{
+	const expr_instr_t *instr_ptr;
+	size_t var_pos, instr_pos;
+
+	if(plan_ptr == NULL_DATA_PTR || plan_ptr->regs_ptr == NULL_DATA_PTR || (var_strs_ptr == NULL_DATA_PTR && plan_ptr->num_vars != 0))
+	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("expr - plan or var strs is null \n");
+		#endif
+		return NULL_DATA_PTR;
+	}
+	for(var_pos = 0; var_pos < plan_ptr->num_vars; ++var_pos)
+	{
+		if((Validate_Operand_Str(&plan_ptr->regs_ptr[var_pos], var_strs_ptr[var_pos], "expr - variable value")) != SUCCESS)
+		{
+			return NULL_DATA_PTR;
+		}
+	}
+	for(instr_pos = 0; instr_pos < plan_ptr->num_instrs; ++instr_pos)
+	{
+		instr_ptr = &plan_ptr->instrs_ptr[instr_pos];
+		if(instr_ptr->big_num_arithmetic_oper == BIG_NUMS_MODULUS_OPER && (plan_ptr->regs_ptr[instr_ptr->src_reg1].precision_digits != 0 ||
+		   plan_ptr->regs_ptr[instr_ptr->src_reg2].precision_digits != 0))
+		{
+			#ifdef TRACE_ERROR
+			   Trace_Error("expr - operands of modulus are non integer \n");
+			#endif
+			return NULL_DATA_PTR;
+		}
+		if((Big_Num_Oper(&plan_ptr->oper_result_num, instr_ptr->big_num_arithmetic_oper, &plan_ptr->regs_ptr[instr_ptr->src_reg1],
+		   &plan_ptr->regs_ptr[instr_ptr->src_reg2], plan_ptr->num_precision_digits)) != SUCCESS)
+		{
+			return NULL_DATA_PTR;
+		}
+		Big_Num_Swap(&plan_ptr->regs_ptr[instr_ptr->dest_reg], &plan_ptr->oper_result_num);
+	}
+	return &plan_ptr->regs_ptr[plan_ptr->result_reg];
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Nums_Expr_Eval
+
+DESCRIPTION    : evaluates plan of Big_Nums_Expr_Compile() for values of its variables, into caller's result buf of
+                 result_buf_size chars
+
+INPUT          : var_strs_ptr is as of Big_Nums_Expr_Run()
+
+OUTPUT         : result_len_ptr has num of chars of result, without null char. If result buf is small, result_len_ptr still
+                 has num of chars of result.
+
+NOTE           :
+
+Func ID        : 01.43
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Big_Nums_Expr_Eval(expr_plan_t *const plan_ptr, const char *const *const var_strs_ptr, char *const result_buf_ptr, const size_t result_buf_size,
+   size_t *const result_len_ptr)
+{
+	const big_num_t *result_num_ptr;
+
+	if((result_num_ptr = Big_Nums_Expr_Run(plan_ptr, var_strs_ptr)) == NULL_DATA_PTR)
+	{
+		return FAILURE;
+	}
+	return Big_Num_To_Buf(result_num_ptr, result_buf_ptr, result_buf_size, result_len_ptr);
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Nums_Expr_Free
+
+DESCRIPTION    : frees plan of Big_Nums_Expr_Compile()
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           :
+
+Func ID        : 01.44
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Big_Nums_Expr_Free(expr_plan_t *const plan_ptr)
+{
+	size_t pos;
+
+	if(plan_ptr == NULL_DATA_PTR)
+	{
+		return;
+	}
+	for(pos = 0; pos < plan_ptr->num_regs; ++pos)
+	{
+		Big_Num_Free(&plan_ptr->regs_ptr[pos]);
+	}
+	for(pos = 0; pos < plan_ptr->num_vars; ++pos)
+	{
+		free(plan_ptr->var_names_ptr[pos]);
+	}
+	free(plan_ptr->regs_ptr);
+	free(plan_ptr->var_names_ptr);
+	free(plan_ptr->instrs_ptr);
+	Big_Num_Free(&plan_ptr->oper_result_num);
+	memset(plan_ptr, 0, sizeof(expr_plan_t));
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Nums_Expr_Var_Index
+
+DESCRIPTION    : index of variable of plan, in var strs of Big_Nums_Expr_Run()
+
+INPUT          :
+
+OUTPUT         : returns SIZE_MAX, if plan has no such variable
+
+NOTE           :
+
+Func ID        : 01.45
+
+BUGS           :
+-*------------------------------------------------------------*/
+size_t Big_Nums_Expr_Var_Index(const expr_plan_t *const plan_ptr, const char *const var_name)
+{
+	size_t var_pos;
+
+	for(var_pos = 0; var_pos < plan_ptr->num_vars; ++var_pos)
+	{
+		if(strcmp(plan_ptr->var_names_ptr[var_pos], var_name) == 0)
+		{
+			return var_pos;
+		}
+	}
+	return SIZE_MAX;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Expr_Parse_Sum
+
+DESCRIPTION    : parses sum := product (('+' | '-') product)* of expression, and emits its instructions
+
+INPUT          :
+
+OUTPUT         : returns register of sum, or EXPR_INVALID_REG on failure
+
+NOTE           :
+
+Func ID        : 01.46
+
+BUGS           :
+-*------------------------------------------------------------*/
+size_t Expr_Parse_Sum(expr_parser_t *const parser_ptr)
+{
+	size_t reg1, reg2;
+	uint8_t oper;
+
+	if((reg1 = Expr_Parse_Product(parser_ptr)) == EXPR_INVALID_REG)
+	{
+		return EXPR_INVALID_REG;
+	}
+	while(1)
+	{
+		while(parser_ptr->expr_str[parser_ptr->str_pos] == ' ' || parser_ptr->expr_str[parser_ptr->str_pos] == '\t')
+		{
+			++parser_ptr->str_pos;
+		}
+		switch(parser_ptr->expr_str[parser_ptr->str_pos])
+		{
+			case '+':
+			   oper = BIG_NUMS_SUM_OPER;
+			break;
+			case '-':
+			   oper = BIG_NUMS_SUBTRACT_OPER;
+			break;
+			default:
+			   return reg1;
+		}
+		++parser_ptr->str_pos;
+		if((reg2 = Expr_Parse_Product(parser_ptr)) == EXPR_INVALID_REG)
+		{
+			return EXPR_INVALID_REG;
+		}
+		if((reg1 = Expr_Emit(parser_ptr, oper, reg1, reg2)) == EXPR_INVALID_REG)
+		{
+			return EXPR_INVALID_REG;
+		}
+	}
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Expr_Parse_Product
+
+DESCRIPTION    : parses product := unary (('*' | '/' | '%') unary)* of expression, and emits its instructions
+
+INPUT          :
+
+OUTPUT         : returns register of product, or EXPR_INVALID_REG on failure
+
+NOTE           :
+
+Func ID        : 01.47
+
+BUGS           :
+-*------------------------------------------------------------*/
+size_t Expr_Parse_Product(expr_parser_t *const parser_ptr)
+{
+	size_t reg1, reg2;
+	uint8_t oper;
+
+	if((reg1 = Expr_Parse_Unary(parser_ptr)) == EXPR_INVALID_REG)
+	{
+		return EXPR_INVALID_REG;
+	}
+	while(1)
+	{
+		while(parser_ptr->expr_str[parser_ptr->str_pos] == ' ' || parser_ptr->expr_str[parser_ptr->str_pos] == '\t')
+		{
+			++parser_ptr->str_pos;
+		}
+		switch(parser_ptr->expr_str[parser_ptr->str_pos])
+		{
+			case '*':
+			   oper = BIG_NUMS_MULTIPLY_OPER;
+			break;
+			case '/':
+			   oper = BIG_NUMS_DIVISION_OPER;
+			break;
+			case '%':
+			   oper = BIG_NUMS_MODULUS_OPER;
+			break;
+			default:
+			   return reg1;
+		}
+		++parser_ptr->str_pos;
+		if((reg2 = Expr_Parse_Unary(parser_ptr)) == EXPR_INVALID_REG)
+		{
+			return EXPR_INVALID_REG;
+		}
+		if((reg1 = Expr_Emit(parser_ptr, oper, reg1, reg2)) == EXPR_INVALID_REG)
+		{
+			return EXPR_INVALID_REG;
+		}
+	}
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Expr_Parse_Unary
+
+DESCRIPTION    : parses unary := ('-' | '+') unary | primary of expression, and emits its instructions
+
+INPUT          :
+
+OUTPUT         : returns register of unary, or EXPR_INVALID_REG on failure
+
+NOTE           : unary - is emitted as 0 - operand, where constant 0 is added once per plan.
+
+Func ID        : 01.48
+
+BUGS           :
+-*------------------------------------------------------------*/
+size_t Expr_Parse_Unary(expr_parser_t *const parser_ptr)
+{
+	size_t reg;
+	char sign_char;
+
+	while(parser_ptr->expr_str[parser_ptr->str_pos] == ' ' || parser_ptr->expr_str[parser_ptr->str_pos] == '\t')
+	{
+		++parser_ptr->str_pos;
+	}
+	sign_char = parser_ptr->expr_str[parser_ptr->str_pos];
+	if(sign_char != '-' && sign_char != '+')
+	{
+		return Expr_Parse_Primary(parser_ptr);
+	}
+	++parser_ptr->str_pos;
+	if(++parser_ptr->depth > EXPR_MAX_DEPTH)
+	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("expr - nesting exceeds %u levels at pos : %lu \n", (unsigned int)EXPR_MAX_DEPTH, (unsigned long)parser_ptr->str_pos);
+		#endif
+		return EXPR_INVALID_REG;
+	}
+	reg = Expr_Parse_Unary(parser_ptr);
+	--parser_ptr->depth;
+	if(reg == EXPR_INVALID_REG || sign_char == '+')
+	{
+		return reg;
+	}
+	if(parser_ptr->zero_reg == EXPR_INVALID_REG && (parser_ptr->zero_reg = Expr_Add_Const(parser_ptr, "0", 1)) == EXPR_INVALID_REG)
+	{
+		return EXPR_INVALID_REG;
+	}
+	return Expr_Emit(parser_ptr, BIG_NUMS_SUBTRACT_OPER, parser_ptr->zero_reg, reg);
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Expr_Parse_Primary
+
+DESCRIPTION    : parses primary := num | variable | '(' sum ')' of expression
+
+INPUT          :
+
+OUTPUT         : returns register of primary, or EXPR_INVALID_REG on failure
+
+NOTE           : num is converted into constant register at compile, and variable gets register on its first use.
+
+Func ID        : 01.49
+
+BUGS           :
+-*------------------------------------------------------------*/
+size_t Expr_Parse_Primary(expr_parser_t *const parser_ptr)
+{
+	expr_plan_t *const plan_ptr = parser_ptr->plan_ptr;
+	const char *const expr_str = parser_ptr->expr_str;
+	char **temp_names_ptr;
+	size_t start_pos = parser_ptr->str_pos, reg;
+	char cur_char = expr_str[start_pos];
+
+	if(cur_char == '(')
+	{
+		++parser_ptr->str_pos;
+		if(++parser_ptr->depth > EXPR_MAX_DEPTH)
+		{
+			#ifdef TRACE_ERROR
+			   Trace_Error("expr - nesting exceeds %u levels at pos : %lu \n", (unsigned int)EXPR_MAX_DEPTH, (unsigned long)start_pos);
+			#endif
+			return EXPR_INVALID_REG;
+		}
+		if((reg = Expr_Parse_Sum(parser_ptr)) == EXPR_INVALID_REG)
+		{
+			return EXPR_INVALID_REG;
+		}
+		--parser_ptr->depth;
+		while(expr_str[parser_ptr->str_pos] == ' ' || expr_str[parser_ptr->str_pos] == '\t')
+		{
+			++parser_ptr->str_pos;
+		}
+		if(expr_str[parser_ptr->str_pos] != ')')
+		{
+			#ifdef TRACE_ERROR
+			   Trace_Error("expr - missing ) for ( at pos : %lu \n", (unsigned long)start_pos);
+			#endif
+			return EXPR_INVALID_REG;
+		}
+		++parser_ptr->str_pos;
+		return reg;
+	}
+	if((cur_char >= '0' && cur_char <= '9') || cur_char == '.')
+	{
+		while((expr_str[parser_ptr->str_pos] >= '0' && expr_str[parser_ptr->str_pos] <= '9') || expr_str[parser_ptr->str_pos] == '.')
+		{
+			++parser_ptr->str_pos;
+		}
+		return Expr_Add_Const(parser_ptr, expr_str + start_pos, parser_ptr->str_pos - start_pos);
+	}
+	if((cur_char >= 'a' && cur_char <= 'z') || (cur_char >= 'A' && cur_char <= 'Z') || cur_char == '_')
+	{
+		while((expr_str[parser_ptr->str_pos] >= 'a' && expr_str[parser_ptr->str_pos] <= 'z') || (expr_str[parser_ptr->str_pos] >= 'A' && expr_str[parser_ptr->str_pos] <= 'Z') ||
+		   (expr_str[parser_ptr->str_pos] >= '0' && expr_str[parser_ptr->str_pos] <= '9') || expr_str[parser_ptr->str_pos] == '_')
+		{
+			++parser_ptr->str_pos;
+		}
+		for(reg = 0; reg < plan_ptr->num_vars; ++reg)
+		{
+			if(strncmp(plan_ptr->var_names_ptr[reg], expr_str + start_pos, parser_ptr->str_pos - start_pos) == 0 &&
+			   plan_ptr->var_names_ptr[reg][parser_ptr->str_pos - start_pos] == NULL_CHAR)
+			{
+				return reg;
+			}
+		}
+		if((temp_names_ptr = realloc(plan_ptr->var_names_ptr, (plan_ptr->num_vars + 1) * sizeof(char *))) == NULL_DATA_PTR ||
+		   (temp_names_ptr[plan_ptr->num_vars] = malloc(parser_ptr->str_pos - start_pos + 1)) == NULL_DATA_PTR)
+		{
+			#ifdef TRACE_ERROR
+			   Trace_Error("expr - memory alloc failed \n");
+			#endif
+			if(temp_names_ptr != NULL_DATA_PTR)
+			{
+				plan_ptr->var_names_ptr = temp_names_ptr;
+			}
+			return EXPR_INVALID_REG;
+		}
+		plan_ptr->var_names_ptr = temp_names_ptr;
+		memcpy(plan_ptr->var_names_ptr[plan_ptr->num_vars], expr_str + start_pos, parser_ptr->str_pos - start_pos);
+		plan_ptr->var_names_ptr[plan_ptr->num_vars][parser_ptr->str_pos - start_pos] = NULL_CHAR;
+		return plan_ptr->num_vars++;
+	}
+	#ifdef TRACE_ERROR
+	   if(cur_char == NULL_CHAR)
+	   {
+		   Trace_Error("expr - operand missing at end \n");
+	   }
+	   else
+	   {
+		   Trace_Error("expr - unexpected char : %c at pos : %lu \n", cur_char, (unsigned long)start_pos);
+	   }
+	#endif
+	return EXPR_INVALID_REG;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Expr_Add_Const
+
+DESCRIPTION    : converts num_chars chars of num in expression, into constant register
+
+INPUT          :
+
+OUTPUT         : returns constant register, or EXPR_INVALID_REG on failure
+
+NOTE           :
+
+Func ID        : 01.50
+
+BUGS           :
+-*------------------------------------------------------------*/
+size_t Expr_Add_Const(expr_parser_t *const parser_ptr, const char *const num_str, const size_t num_chars)
+{
+	big_num_t *temp_consts_ptr;
+
+	if(parser_ptr->num_consts == parser_ptr->alloc_consts)
+	{
+		if((temp_consts_ptr = realloc(parser_ptr->consts_ptr, (2 * parser_ptr->alloc_consts + 4) * sizeof(big_num_t))) == NULL_DATA_PTR)
+		{
+			#ifdef TRACE_ERROR
+			   Trace_Error("expr - memory alloc failed \n");
+			#endif
+			return EXPR_INVALID_REG;
+		}
+		parser_ptr->consts_ptr = temp_consts_ptr;
+		parser_ptr->alloc_consts = 2 * parser_ptr->alloc_consts + 4;
+	}
+	Big_Num_Init(&parser_ptr->consts_ptr[parser_ptr->num_consts]);
+	if((Big_Num_From_Chars(&parser_ptr->consts_ptr[parser_ptr->num_consts], num_str, num_chars)) != SUCCESS)
+	{
+		Big_Num_Free(&parser_ptr->consts_ptr[parser_ptr->num_consts]);
+		return EXPR_INVALID_REG;
+	}
+	return EXPR_CONST_REG_FLAG | parser_ptr->num_consts++;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Expr_Emit
+
+DESCRIPTION    : emits instruction of reg1 oper reg2 into plan, whose result is in a temporary register
+
+INPUT          :
+
+OUTPUT         : returns temporary register of result, or EXPR_INVALID_REG on failure
+
+NOTE           : temporaries are used in stack order, as reg2 is found after reg1. So temporaries of operands are released, and
+                 result takes first free temporary, which can be temporary of reg1.
+
+Func ID        : 01.51
+
+BUGS           :
+-*------------------------------------------------------------*/
+size_t Expr_Emit(expr_parser_t *const parser_ptr, const uint8_t big_num_arithmetic_oper, const size_t reg1, const size_t reg2)
+{
+	expr_plan_t *const plan_ptr = parser_ptr->plan_ptr;
+	expr_instr_t *temp_instrs_ptr;
+
+	if(plan_ptr->num_instrs == plan_ptr->alloc_instrs)
+	{
+		if((temp_instrs_ptr = realloc(plan_ptr->instrs_ptr, (2 * plan_ptr->alloc_instrs + 8) * sizeof(expr_instr_t))) == NULL_DATA_PTR)
+		{
+			#ifdef TRACE_ERROR
+			   Trace_Error("expr - memory alloc failed \n");
+			#endif
+			return EXPR_INVALID_REG;
+		}
+		plan_ptr->instrs_ptr = temp_instrs_ptr;
+		plan_ptr->alloc_instrs = 2 * plan_ptr->alloc_instrs + 8;
+	}
+	if((reg2 & EXPR_TEMP_REG_FLAG) != 0 && (reg2 & EXPR_CONST_REG_FLAG) == 0)
+	{
+		--parser_ptr->num_used_temps;
+	}
+	if((reg1 & EXPR_TEMP_REG_FLAG) != 0 && (reg1 & EXPR_CONST_REG_FLAG) == 0)
+	{
+		--parser_ptr->num_used_temps;
+	}
+	plan_ptr->instrs_ptr[plan_ptr->num_instrs].big_num_arithmetic_oper = big_num_arithmetic_oper;
+	plan_ptr->instrs_ptr[plan_ptr->num_instrs].dest_reg = EXPR_TEMP_REG_FLAG | parser_ptr->num_used_temps;
+	plan_ptr->instrs_ptr[plan_ptr->num_instrs].src_reg1 = reg1;
+	plan_ptr->instrs_ptr[plan_ptr->num_instrs].src_reg2 = reg2;
+	if(++parser_ptr->num_used_temps > parser_ptr->max_used_temps)
+	{
+		parser_ptr->max_used_temps = parser_ptr->num_used_temps;
+	}
+	return plan_ptr->instrs_ptr[plan_ptr->num_instrs++].dest_reg;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Expr_Reg_Pos
+
+DESCRIPTION    : pos of register in registers of plan, which are variables, then constants, then temporaries
+
+INPUT          : reg is as of compile, ie variable index, or constant or temporary index with its flag
+
+OUTPUT         :
+
+NOTE           :
+
+Func ID        : 01.52
+
+BUGS           :
+-*------------------------------------------------------------*/
+static inline size_t Expr_Reg_Pos(const size_t reg, const size_t num_vars, const size_t num_consts)
+{
+	if((reg & EXPR_CONST_REG_FLAG) != 0)
+	{
+		return num_vars + (reg & ~EXPR_CONST_REG_FLAG);
+	}
+	if((reg & EXPR_TEMP_REG_FLAG) != 0)
+	{
+		return num_vars + num_consts + (reg & ~EXPR_TEMP_REG_FLAG);
+	}
+	return reg;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Expr_Cli
+
+DESCRIPTION    : compiles expression once, and evaluates it for each line of stdin, which has values of its variables in order
+                 of their first use in expression, separated by spaces or tabs, and writes result of each line in stdout
+
+INPUT          : num_precision_digits is used by every division of expression
+
+OUTPUT         : returns exit status as of Batch_Cli()
+
+NOTE           : expression without variables is evaluated once, without reading stdin. Blank lines and lines, whose first
+                 field starts with '#', are skipped. Failed line has empty line in stdout, and
+                 "line <line num>: <error>" line in stderr. Results are written by Big_Num_Write() into stdout, which is fully
+                 buffered by BATCH_CLI_IO_BUF_SIZE chars. As of Batch_Cli(), line of more than (num of variables + 1) *
+                 max_operand_len + BATCH_CLI_LINE_SLACK chars is failed without reading it into memory.
+
+Func ID        : 01.53
+
+BUGS           :
+-*------------------------------------------------------------*/
+int Expr_Cli(const char *const expr_str, const size_t num_precision_digits)
+{
+	expr_plan_t plan;
+	const big_num_t *result_num_ptr;
+	const char **var_strs_ptr;
+	const char *error_ptr;
+	char *line_ptr, *temp_line_ptr, *char_ptr;
+	size_t line_alloc = INIT_INPUT_STR_ALLOC_SIZE, max_line_alloc, line_len, num_fields;
+	uint64_t line_num = 0;
+	int exit_status = BATCH_CLI_EXIT_OK;
+	uint8_t skip_line_state;
+
+	Set_Trace_Error_Print(STATE_NO);
+	trace_error_msg[0] = NULL_CHAR;
+	if((Big_Nums_Expr_Compile(&plan, expr_str, num_precision_digits)) != SUCCESS)
+	{
+		Set_Trace_Error_Print(STATE_YES);
+		fprintf(stderr, "%s\n", (trace_error_msg[0] != NULL_CHAR) ? trace_error_msg : "expr compile failed");
+		return BATCH_CLI_EXIT_IO_FAILED;
+	}
+	// expression without variables is evaluated once, without input
+	if(plan.num_vars == 0)
+	{
+		exit_status = ((result_num_ptr = Big_Nums_Expr_Run(&plan, NULL_DATA_PTR)) != NULL_DATA_PTR && (Big_Num_Write(result_num_ptr, stdout)) == SUCCESS &&
+		   putchar('\n') != EOF) ? BATCH_CLI_EXIT_OK : BATCH_CLI_EXIT_REC_FAILED;
+		Set_Trace_Error_Print(STATE_YES);
+		if(exit_status != BATCH_CLI_EXIT_OK)
+		{
+			fprintf(stderr, "%s\n", (trace_error_msg[0] != NULL_CHAR) ? trace_error_msg : "expr evaluation failed");
+		}
+		Big_Nums_Expr_Free(&plan);
+		return exit_status;
+	}
+	// one field more than variables is found, so that extra fields are detected
+	var_strs_ptr = malloc((plan.num_vars + 1) * sizeof(char *));
+	line_ptr = malloc(line_alloc);
+	if(var_strs_ptr == NULL_DATA_PTR || line_ptr == NULL_DATA_PTR)
+	{
+		fprintf(stderr, "expr - memory alloc failed \n");
+		Set_Trace_Error_Print(STATE_YES);
+		free(var_strs_ptr);
+		free(line_ptr);
+		Big_Nums_Expr_Free(&plan);
+		return BATCH_CLI_EXIT_IO_FAILED;
+	}
+	// line has values of variables and their separators, and buf has its newline and null char
+	max_line_alloc = (max_operand_len < (SIZE_MAX - BATCH_CLI_LINE_SLACK - 2) / (plan.num_vars + 1)) ?
+	   (plan.num_vars + 1) * max_operand_len + BATCH_CLI_LINE_SLACK + 2 : SIZE_MAX;
+	setvbuf(stdout, batch_cli_out_buf, _IOFBF, BATCH_CLI_IO_BUF_SIZE);
+	while(exit_status != BATCH_CLI_EXIT_IO_FAILED)
+	{
+		// line is read in pieces, till its newline, and its buf grows by doubling upto max_line_alloc
+		for(line_len = 0, skip_line_state = STATE_NO; fgets(line_ptr + line_len, (int)((line_alloc - line_len < INT32_MAX) ? line_alloc - line_len : INT32_MAX), stdin) != NULL_DATA_PTR; )
+		{
+			line_len += strlen(line_ptr + line_len);
+			if(line_len != 0 && line_ptr[line_len - 1] == '\n')
+			{
+				break;
+			}
+			if(line_len + 1 == line_alloc)
+			{
+				if(line_alloc >= max_line_alloc)
+				{
+					// chars of too long line are dropped, till its newline
+					skip_line_state = STATE_YES;
+					line_len = 0;
+					continue;
+				}
+				if((temp_line_ptr = realloc(line_ptr, (line_alloc < max_line_alloc / 2) ? 2 * line_alloc : max_line_alloc)) == NULL_DATA_PTR)
+				{
+					fprintf(stderr, "expr - memory alloc failed \n");
+					exit_status = BATCH_CLI_EXIT_IO_FAILED;
+					break;
+				}
+				line_ptr = temp_line_ptr;
+				line_alloc = (line_alloc < max_line_alloc / 2) ? 2 * line_alloc : max_line_alloc;
+			}
+		}
+		if((line_len == 0 && skip_line_state == STATE_NO) || exit_status == BATCH_CLI_EXIT_IO_FAILED)
+		{
+			break;
+		}
+		++line_num;
+		if(skip_line_state == STATE_YES)
+		{
+			exit_status = BATCH_CLI_EXIT_REC_FAILED;
+			fprintf(stderr, "line %llu: line exceeds max chars\n", (unsigned long long)line_num);
+			putchar('\n');
+			continue;
+		}
+		for(num_fields = 0, char_ptr = line_ptr; num_fields <= plan.num_vars; )
+		{
+			while(*char_ptr == ' ' || *char_ptr == '\t' || *char_ptr == '\r' || *char_ptr == '\n')
+			{
+				++char_ptr;
+			}
+			if(*char_ptr == NULL_CHAR)
+			{
+				break;
+			}
+			var_strs_ptr[num_fields++] = char_ptr;
+			while(*char_ptr != NULL_CHAR && *char_ptr != ' ' && *char_ptr != '\t' && *char_ptr != '\r' && *char_ptr != '\n')
+			{
+				++char_ptr;
+			}
+			if(*char_ptr != NULL_CHAR)
+			{
+				*char_ptr++ = NULL_CHAR;
+			}
+		}
+		if(num_fields == 0 || var_strs_ptr[0][0] == '#')
+		{
+			continue;
+		}
+		error_ptr = NULL_DATA_PTR;
+		result_num_ptr = NULL_DATA_PTR;
+		if(num_fields != plan.num_vars)
+		{
+			error_ptr = "num of values differs from num of variables";
+		}
+		else
+		{
+			trace_error_msg[0] = NULL_CHAR;
+			if((result_num_ptr = Big_Nums_Expr_Run(&plan, var_strs_ptr)) == NULL_DATA_PTR)
+			{
+				error_ptr = (trace_error_msg[0] != NULL_CHAR) ? trace_error_msg : "expr evaluation failed";
+			}
+		}
+		if(error_ptr != NULL_DATA_PTR)
+		{
+			exit_status = BATCH_CLI_EXIT_REC_FAILED;
+			fprintf(stderr, "line %llu: %s\n", (unsigned long long)line_num, error_ptr);
+		}
+		else if((Big_Num_Write(result_num_ptr, stdout)) != SUCCESS)
+		{
+			exit_status = BATCH_CLI_EXIT_IO_FAILED;
+		}
+		putchar('\n');
+	}
+	Set_Trace_Error_Print(STATE_YES);
+	if(ferror(stdin))
+	{
+		fprintf(stderr, "expr - input read failed \n");
+		exit_status = BATCH_CLI_EXIT_IO_FAILED;
+	}
+	if(fflush(stdout) != 0 || ferror(stdout))
+	{
+		exit_status = BATCH_CLI_EXIT_IO_FAILED;
+	}
+	free(var_strs_ptr);
+	free(line_ptr);
+	Big_Nums_Expr_Free(&plan);
+	return exit_status;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Sum_Cli
+
+DESCRIPTION    : adds big num of each line of input file or of stdin, and writes their sum in stdout
+
+INPUT          : input_file_name is NULL for stdin
+
+OUTPUT         : returns exit status as of Batch_Cli()
+
+NOTE           : blank lines and lines starting with '#' are skipped. Failed line is not added, and has
+                 "line <line num>: <error>" line in stderr. Lines are added by Big_Num_Acc_Add_Chars(), so that sum is
+                 normalised and formatted once, after last line. Big num of more than max_operand_len chars is failed, and
+                 as of Batch_Cli(), line of more than max_operand_len + BATCH_CLI_LINE_SLACK chars is failed without reading
+                 it into memory.
+
+Func ID        : 01.55
+
+BUGS           :
+-*------------------------------------------------------------*/
+int Sum_Cli(const char *const input_file_name)
+{
+	big_num_acc_t sum_acc;
+	FILE *input_file_ptr = stdin;
+	char *line_ptr, *temp_line_ptr, *result_ptr, *num_str;
+	size_t line_alloc = INIT_INPUT_STR_ALLOC_SIZE, max_line_alloc, line_len, num_chars, result_len;
+	uint64_t line_num = 0;
+	int exit_status = BATCH_CLI_EXIT_OK;
+	uint8_t skip_line_state;
+
+	if(input_file_name != NULL_DATA_PTR && (input_file_ptr = fopen(input_file_name, "rb")) == NULL_DATA_PTR)
+	{
+		fprintf(stderr, "sum - input file : %s is not opened \n", input_file_name);
+		return BATCH_CLI_EXIT_IO_FAILED;
+	}
+	if((line_ptr = malloc(line_alloc)) == NULL_DATA_PTR)
+	{
+		fprintf(stderr, "sum - memory alloc failed \n");
+		if(input_file_ptr != stdin)
+		{
+			fclose(input_file_ptr);
+		}
+		return BATCH_CLI_EXIT_IO_FAILED;
+	}
+	// buf of line has its newline and null char
+	max_line_alloc = (max_operand_len < SIZE_MAX - BATCH_CLI_LINE_SLACK - 2) ? max_operand_len + BATCH_CLI_LINE_SLACK + 2 : SIZE_MAX;
+	Big_Num_Acc_Init(&sum_acc);
+	Set_Trace_Error_Print(STATE_NO);
+	while(exit_status != BATCH_CLI_EXIT_IO_FAILED)
+	{
+		// line is read in pieces, till its newline, and its buf grows by doubling upto max_line_alloc
+		for(line_len = 0, skip_line_state = STATE_NO; fgets(line_ptr + line_len, (int)((line_alloc - line_len < INT32_MAX) ? line_alloc - line_len : INT32_MAX), input_file_ptr) != NULL_DATA_PTR; )
+		{
+			line_len += strlen(line_ptr + line_len);
+			if(line_len != 0 && line_ptr[line_len - 1] == '\n')
+			{
+				break;
+			}
+			if(line_len + 1 == line_alloc)
+			{
+				if(line_alloc >= max_line_alloc)
+				{
+					// chars of too long line are dropped, till its newline
+					skip_line_state = STATE_YES;
+					line_len = 0;
+					continue;
+				}
+				if((temp_line_ptr = realloc(line_ptr, (line_alloc < max_line_alloc / 2) ? 2 * line_alloc : max_line_alloc)) == NULL_DATA_PTR)
+				{
+					fprintf(stderr, "sum - memory alloc failed \n");
+					exit_status = BATCH_CLI_EXIT_IO_FAILED;
+					break;
+				}
+				line_ptr = temp_line_ptr;
+				line_alloc = (line_alloc < max_line_alloc / 2) ? 2 * line_alloc : max_line_alloc;
+			}
+		}
+		if((line_len == 0 && skip_line_state == STATE_NO) || exit_status == BATCH_CLI_EXIT_IO_FAILED)
+		{
+			break;
+		}
+		++line_num;
+		if(skip_line_state == STATE_YES)
+		{
+			exit_status = BATCH_CLI_EXIT_REC_FAILED;
+			fprintf(stderr, "line %llu: line exceeds max chars\n", (unsigned long long)line_num);
+			continue;
+		}
+		// big num is line without leading and trailing spaces and newlines
+		num_str = line_ptr;
+		while(*num_str == ' ' || *num_str == '\t')
+		{
+			++num_str;
+		}
+		num_chars = line_len - (size_t)(num_str - line_ptr);
+		while(num_chars != 0 && (num_str[num_chars - 1] == ' ' || num_str[num_chars - 1] == '\t' || num_str[num_chars - 1] == '\r' || num_str[num_chars - 1] == '\n'))
+		{
+			--num_chars;
+		}
+		if(num_chars == 0 || num_str[0] == '#')
+		{
+			continue;
+		}
+		if(num_chars > max_operand_len)
+		{
+			exit_status = BATCH_CLI_EXIT_REC_FAILED;
+			fprintf(stderr, "line %llu: num chars exceeds max chars : %lu\n", (unsigned long long)line_num, (unsigned long)max_operand_len);
+			continue;
+		}
+		trace_error_msg[0] = NULL_CHAR;
+		if((Big_Num_Acc_Add_Chars(&sum_acc, num_str, num_chars)) != SUCCESS)
+		{
+			exit_status = BATCH_CLI_EXIT_REC_FAILED;
+			fprintf(stderr, "line %llu: %s\n", (unsigned long long)line_num, (trace_error_msg[0] != NULL_CHAR) ? trace_error_msg : "sum failed");
+		}
+	}
+	if(ferror(input_file_ptr))
+	{
+		fprintf(stderr, "sum - input read failed \n");
+		exit_status = BATCH_CLI_EXIT_IO_FAILED;
+	}
+	if(exit_status != BATCH_CLI_EXIT_IO_FAILED)
+	{
+		trace_error_msg[0] = NULL_CHAR;
+		if((result_ptr = Big_Num_Acc_Format(&sum_acc, NULL_DATA_PTR, 0, &result_len)) == NULL_DATA_PTR)
+		{
+			fprintf(stderr, "%s\n", (trace_error_msg[0] != NULL_CHAR) ? trace_error_msg : "sum failed");
+			exit_status = BATCH_CLI_EXIT_IO_FAILED;
+		}
+		else if(fwrite(result_ptr, 1, result_len, stdout) != result_len || putchar('\n') == EOF || fflush(stdout) != 0)
+		{
+			exit_status = BATCH_CLI_EXIT_IO_FAILED;
+		}
+		free(result_ptr);
+	}
+	Set_Trace_Error_Print(STATE_YES);
+	if(input_file_ptr != stdin)
+	{
+		fclose(input_file_ptr);
+	}
+	free(line_ptr);
+	Big_Num_Acc_Free(&sum_acc);
+	return exit_status;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Nums_Oper_From_Name
+
+DESCRIPTION    : big num oper of oper name
+
+INPUT          : oper_name is +, -, *, /, % or add, sub, mul, div, mod or 1 to 5 as of menu
+
+OUTPUT         : returns BIG_NUMS_SUM_OPER to BIG_NUMS_MODULUS_OPER, or 0, if oper name is invalid
+
+NOTE           :
+
+Func ID        : 01.36
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint8_t Big_Nums_Oper_From_Name(const char *const oper_name)
+{
+	const char *const oper_names[][3] = {{"+", "add", "1"}, {"-", "sub", "2"}, {"*", "mul", "3"}, {"/", "div", "4"}, {"%", "mod", "5"}};
+	size_t name_pos;
+	uint8_t oper;
+
+	for(oper = BIG_NUMS_SUM_OPER; oper <= BIG_NUMS_MODULUS_OPER; ++oper)
+	{
+		for(name_pos = 0; name_pos < 3; ++name_pos)
+		{
+			if(strcmp(oper_name, oper_names[oper - BIG_NUMS_SUM_OPER][name_pos]) == 0)
+			{
+				return oper;
+			}
+		}
+	}
+	return 0;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Precision_Digits_From_Str
+
+DESCRIPTION    : converts num_precision_digits in str of command line or batch record, into num
+
+INPUT          :
+
+OUTPUT         : returns FAILURE, if num_str is empty, has non digit char, or exceeds max_operand_len, in which case
+                 num_precision_digits_ptr is not changed
+
+NOTE           : parsed by Size_From_Str().
+
+Func ID        : 01.64
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Precision_Digits_From_Str(const char *const num_str, size_t *const num_precision_digits_ptr)
+{
+	return Size_From_Str(num_str, max_operand_len, num_precision_digits_ptr);
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Size_From_Str
+
+DESCRIPTION    : converts unsigned decimal num in str of command line, batch record or environment variable, into num
+
+INPUT          :
+
+OUTPUT         : returns FAILURE, if num_str is NULL or empty, has non digit char, or exceeds max_value, in which case
+                 value_ptr is not changed
+
+NOTE           : digit is accumulated only if value stays upto max_value, so that long str cannot overflow, and sign is
+                 invalid, unlike strtoull(), which wraps "-1" into max value.
+
+Func ID        : 01.67
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Size_From_Str(const char *const num_str, const size_t max_value, size_t *const value_ptr)
+{
+	const char *char_ptr;
+	size_t value = 0, digit;
+
+	if(num_str == NULL_DATA_PTR || num_str[0] == NULL_CHAR)
+	{
+		return FAILURE;
+	}
+	for(char_ptr = num_str; *char_ptr >= '0' && *char_ptr <= '9'; ++char_ptr)
+	{
+		digit = (size_t)(*char_ptr - '0');
+		if(digit > max_value || value > (max_value - digit) / 10)
+		{
+			return FAILURE;
+		}
+		value = (value * 10) + digit;
+	}
+	if(*char_ptr != NULL_CHAR)
+	{
+		return FAILURE;
+	}
+	*value_ptr = value;
+	return SUCCESS;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Env_Options
+
+DESCRIPTION    : sets options of command line modes from environment variables
+
+INPUT          : MAX_OPERAND_LEN_ENV_NAME has max num of chars in operand str, from 1 to SIZE_MAX / 4, so that buffers of
+                 lines of operands cannot overflow. BATCH_THREADS_ENV_NAME has num of threads of Big_Nums_Batch_Parallel(), where 0 is num of online CPUs, and
+                 BATCH_AFFINITY_ENV_NAME has 1 to pin its worker threads to CPUs, or 0. Unset variable keeps its default.
+
+OUTPUT         : returns FAILURE, if a variable is invalid, which is reported in stderr
+
+NOTE           : values are parsed by Size_From_Str(), and set by Set_Max_Operand_Len() and Set_Batch_Threads().
+
+Func ID        : 01.68
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Env_Options(void)
+{
+	const char *env_str;
+	size_t max_len = max_operand_len, num_threads = batch_num_threads, cpu_affinity = (batch_cpu_affinity_state == STATE_YES) ? 1 : 0;
+
+	if((env_str = getenv(MAX_OPERAND_LEN_ENV_NAME)) != NULL_DATA_PTR && ((Size_From_Str(env_str, SIZE_MAX / 4, &max_len)) != SUCCESS || max_len == 0))
+	{
+		fprintf(stderr, "%s : %s is invalid, 0 or exceeds %lu \n", MAX_OPERAND_LEN_ENV_NAME, env_str, (unsigned long)(SIZE_MAX / 4));
+		return FAILURE;
+	}
+	if((env_str = getenv(BATCH_THREADS_ENV_NAME)) != NULL_DATA_PTR && (Size_From_Str(env_str, BATCH_MAX_THREADS, &num_threads)) != SUCCESS)
+	{
+		fprintf(stderr, "%s : %s is invalid or exceeds %u \n", BATCH_THREADS_ENV_NAME, env_str, (unsigned int)BATCH_MAX_THREADS);
+		return FAILURE;
+	}
+	if((env_str = getenv(BATCH_AFFINITY_ENV_NAME)) != NULL_DATA_PTR && (Size_From_Str(env_str, 1, &cpu_affinity)) != SUCCESS)
+	{
+		fprintf(stderr, "%s : %s is not 0 or 1 \n", BATCH_AFFINITY_ENV_NAME, env_str);
+		return FAILURE;
+	}
+	Set_Max_Operand_Len(max_len);
+	Set_Batch_Threads(num_threads, (cpu_affinity == 1) ? STATE_YES : STATE_NO);
+	return SUCCESS;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Operand_File_Open
+
+DESCRIPTION    : maps operand file into memory, and locates its big num chars
+
+INPUT          :
+
+OUTPUT         : chars_ptr of operand file has num_chars chars of big num, without leading and trailing spaces and newlines.
+                 On success, caller is responsible for closing it by Operand_File_Close().
+
+NOTE           : file is mapped read only, and is advised for sequential access, so that its pages are read ahead and can
+                 be dropped by kernel, after they are converted. Where mmap is not supported, file is read into memory.
+
+Func ID        : 01.37
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Operand_File_Open(operand_file_t *const operand_file_ptr, const char *const file_name)
+{
+	const char *chars_ptr;
+	size_t num_chars;
+	#ifdef BIG_NUM_MMAP
+	   struct stat file_stat;
+	   void *map_ptr;
+	   int file_desc;
+	#else
+	   FILE *file_ptr;
+	   long file_size;
+	#endif
+
+	operand_file_ptr->chars_ptr = NULL_DATA_PTR;
+	operand_file_ptr->num_chars = 0;
+	operand_file_ptr->map_ptr = NULL_DATA_PTR;
+	operand_file_ptr->map_size = 0;
+	#ifdef BIG_NUM_MMAP
+	   if((file_desc = open(file_name, O_RDONLY)) < 0)
+	   {
+		   #ifdef TRACE_ERROR
+		      Trace_Error("operand file : %s is not opened \n", file_name);
+		   #endif
+		   return FAILURE;
+	   }
+	   if(fstat(file_desc, &file_stat) != 0 || file_stat.st_size <= 0)
+	   {
+		   #ifdef TRACE_ERROR
+		      Trace_Error("operand file : %s is empty or its size is unknown \n", file_name);
+		   #endif
+		   close(file_desc);
+		   return FAILURE;
+	   }
+	   map_ptr = mmap(NULL_DATA_PTR, (size_t)file_stat.st_size, PROT_READ, MAP_PRIVATE, file_desc, 0);
+	   // mapping is kept, after its file is closed
+	   close(file_desc);
+	   if(map_ptr == MAP_FAILED)
+	   {
+		   #ifdef TRACE_ERROR
+		      Trace_Error("operand file : %s is not mapped \n", file_name);
+		   #endif
+		   return FAILURE;
+	   }
+	   madvise(map_ptr, (size_t)file_stat.st_size, MADV_SEQUENTIAL);
+	   operand_file_ptr->map_ptr = map_ptr;
+	   operand_file_ptr->map_size = (size_t)file_stat.st_size;
+	#else
+	   if((file_ptr = fopen(file_name, "rb")) == NULL_DATA_PTR)
+	   {
+		   #ifdef TRACE_ERROR
+		      Trace_Error("operand file : %s is not opened \n", file_name);
+		   #endif
+		   return FAILURE;
+	   }
+	   if(fseek(file_ptr, 0, SEEK_END) != 0 || (file_size = ftell(file_ptr)) <= 0 || fseek(file_ptr, 0, SEEK_SET) != 0 ||
+	      (operand_file_ptr->map_ptr = malloc((size_t)file_size)) == NULL_DATA_PTR ||
+	      fread(operand_file_ptr->map_ptr, 1, (size_t)file_size, file_ptr) != (size_t)file_size)
+	   {
+		   #ifdef TRACE_ERROR
+		      Trace_Error("operand file : %s is empty or not read \n", file_name);
+		   #endif
+		   free(operand_file_ptr->map_ptr);
+		   operand_file_ptr->map_ptr = NULL_DATA_PTR;
+		   fclose(file_ptr);
+		   return FAILURE;
+	   }
+	   fclose(file_ptr);
+	   operand_file_ptr->map_size = (size_t)file_size;
+	#endif
+	chars_ptr = operand_file_ptr->map_ptr;
+	num_chars = operand_file_ptr->map_size;
+	while(num_chars != 0 && (chars_ptr[0] == ' ' || chars_ptr[0] == '\t' || chars_ptr[0] == '\r' || chars_ptr[0] == '\n'))
+	{
+		++chars_ptr;
+		--num_chars;
+	}
+	while(num_chars != 0 && (chars_ptr[num_chars - 1] == ' ' || chars_ptr[num_chars - 1] == '\t' || chars_ptr[num_chars - 1] == '\r' ||
+	   chars_ptr[num_chars - 1] == '\n'))
+	{
+		--num_chars;
+	}
+	if(num_chars == 0)
+	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("operand file : %s has no big num \n", file_name);
+		#endif
+		Operand_File_Close(operand_file_ptr);
+		return FAILURE;
+	}
+	operand_file_ptr->chars_ptr = chars_ptr;
+	operand_file_ptr->num_chars = num_chars;
+	return SUCCESS;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Operand_File_Close
+
+DESCRIPTION    : unmaps operand file opened by Operand_File_Open()
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           :
+
+Func ID        : 01.38
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Operand_File_Close(operand_file_t *const operand_file_ptr)
+{
+	if(operand_file_ptr->map_ptr != NULL_DATA_PTR)
+	{
+		#ifdef BIG_NUM_MMAP
+		   munmap(operand_file_ptr->map_ptr, operand_file_ptr->map_size);
+		#else
+		   free(operand_file_ptr->map_ptr);
+		#endif
+	}
+	operand_file_ptr->chars_ptr = NULL_DATA_PTR;
+	operand_file_ptr->num_chars = 0;
+	operand_file_ptr->map_ptr = NULL_DATA_PTR;
+	operand_file_ptr->map_size = 0;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Operand_File_Drop
+
+DESCRIPTION    : drops mapped pages of operand file, which are before end_ptr
+
+INPUT          : end_ptr is in mapping of operand file
+
+OUTPUT         :
+
+NOTE           : only whole pages are dropped, and they are read again from file, if they are used after it. Where mmap is not
+                 supported, file is in memory till Operand_File_Close().
+
+Func ID        : 01.71
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Operand_File_Drop(operand_file_t *const operand_file_ptr, const char *const end_ptr)
+{
+	#ifdef BIG_NUM_MMAP
+	   size_t page_size, drop_size;
+
+	   page_size = (size_t)sysconf(_SC_PAGESIZE);
+	   drop_size = ((size_t)(end_ptr - (const char *)operand_file_ptr->map_ptr) / page_size) * page_size;
+	   if(drop_size != 0)
+	   {
+		   madvise(operand_file_ptr->map_ptr, drop_size, MADV_DONTNEED);
+	   }
+	#else
+	   (void)operand_file_ptr;
+	   (void)end_ptr;
+	#endif
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Nums_Files
+
+DESCRIPTION    : finds result of oper of big nums in operand files, and writes it into result file
+
+INPUT          : num_precision_digits is used only by BIG_NUMS_DIVISION_OPER
+
+OUTPUT         : result file has result str, as of Big_Nums_* operations, followed by newline
+
+NOTE           : each operand file is mapped by Operand_File_Open(), and unmapped, before next one is mapped. Operands of + and -
+                 are added into accumulator by Big_Num_Acc_Add_Signed_Chars(), whose sum is written by Big_Num_Acc_Write(), so
+                 that they cost a pass over digits without limbs conversion. Operands of other opers are converted by
+                 Big_Num_From_Mapped_Chars(), and are freed, before result is written by Big_Num_Write(), so that no str of
+                 operand or result is kept. Scratch arena is released after each of conversion, oper and write, so that scratch
+                 of one stage is not kept, while heap scratch of next stage is in use. max_operand_len is not applied, as operand
+                 is not read into memory.
+
+Func ID        : 01.39
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Big_Nums_Files(const uint8_t big_num_arithmetic_oper, const char *const operand_file_name1, const char *const operand_file_name2,
+   const char *const result_file_name, const size_t num_precision_digits)
+{
+	operand_file_t operand_file;
+	big_num_t proc_nums[2], result_num;
+	big_num_acc_t sum_acc;
+	FILE *result_file_ptr;
+	const char *operand_file_names[2];
+	uint16_t ret_status = SUCCESS;
+	uint8_t operand_pos, acc_state;
+
+	if(operand_file_name1 == NULL_DATA_PTR || operand_file_name2 == NULL_DATA_PTR || result_file_name == NULL_DATA_PTR)
+	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("operand or result file name is null \n");
+		#endif
+		return FAILURE;
+	}
+	operand_file_names[0] = operand_file_name1;
+	operand_file_names[1] = operand_file_name2;
+	acc_state = (big_num_arithmetic_oper == BIG_NUMS_SUM_OPER || big_num_arithmetic_oper == BIG_NUMS_SUBTRACT_OPER) ? STATE_YES : STATE_NO;
+	Big_Num_Init(&proc_nums[0]);
+	Big_Num_Init(&proc_nums[1]);
+	Big_Num_Init(&result_num);
+	Big_Num_Acc_Init(&sum_acc);
+	for(operand_pos = 0; operand_pos < 2 && ret_status == SUCCESS; ++operand_pos)
+	{
+		if((ret_status = Operand_File_Open(&operand_file, operand_file_names[operand_pos])) == SUCCESS)
+		{
+			if(acc_state == STATE_YES)
+			{
+				ret_status = Big_Num_Acc_Add_Signed_Chars(&sum_acc, operand_file.chars_ptr, operand_file.num_chars,
+				   (operand_pos == 1 && big_num_arithmetic_oper == BIG_NUMS_SUBTRACT_OPER) ? STATE_YES : STATE_NO);
+			}
+			else
+			{
+				ret_status = Big_Num_From_Mapped_Chars(&proc_nums[operand_pos], operand_file.chars_ptr, operand_file.num_chars, &operand_file);
+			}
+			Operand_File_Close(&operand_file);
+			Big_Num_Scratch_Release();
+		}
+	}
+	if(ret_status == SUCCESS && big_num_arithmetic_oper == BIG_NUMS_MODULUS_OPER && (proc_nums[0].precision_digits != 0 || proc_nums[1].precision_digits != 0))
+	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("%s or %s has non integer \n", operand_file_name1, operand_file_name2);
+		#endif
+		ret_status = FAILURE;
+	}
+	if(ret_status == SUCCESS && acc_state == STATE_NO)
+	{
+		ret_status = Big_Num_Oper(&result_num, big_num_arithmetic_oper, &proc_nums[0], &proc_nums[1], num_precision_digits);
+		Big_Num_Scratch_Release();
+	}
+	Big_Num_Free(&proc_nums[0]);
+	Big_Num_Free(&proc_nums[1]);
+	if(ret_status == SUCCESS)
+	{
+		if((result_file_ptr = fopen(result_file_name, "wb")) == NULL_DATA_PTR)
+		{
+			#ifdef TRACE_ERROR
+			   Trace_Error("result file : %s is not opened \n", result_file_name);
+			#endif
+			ret_status = FAILURE;
+		}
+		else
+		{
+			ret_status = (acc_state == STATE_YES) ? Big_Num_Acc_Write(&sum_acc, result_file_ptr) : Big_Num_Write(&result_num, result_file_ptr);
+			if(fputc('\n', result_file_ptr) == EOF || fclose(result_file_ptr) != 0)
+			{
+				ret_status = FAILURE;
+			}
+			#ifdef TRACE_ERROR
+			   if(ret_status != SUCCESS)
+			   {
+				   Trace_Error("result file : %s is not written \n", result_file_name);
+			   }
+			#endif
+		}
+	}
+	Big_Num_Free(&result_num);
+	Big_Num_Acc_Free(&sum_acc);
+	Big_Num_Scratch_Release();
+	return ret_status;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limb_Count_Leading_Zeros
+
+DESCRIPTION    : num of leading zero bits in limb
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           : limb must not be 0
+
+Func ID        : 03.01
+
+BUGS           :
+-*------------------------------------------------------------*/
+static inline unsigned int Limb_Count_Leading_Zeros(const big_num_limb_t limb)
+{
+	#if defined(__GNUC__)
+	   return (unsigned int)__builtin_clzll(limb);
+	#else
+	   unsigned int num_zero_bits = 0;
+	   big_num_limb_t proc_limb = limb;
+
+	   while((proc_limb & ((big_num_limb_t)1 << (BIG_NUM_LIMB_BITS - 1))) == 0)
+	   {
+		   proc_limb <<= 1;
+		   ++num_zero_bits;
+	   }
+	   return num_zero_bits;
+	#endif
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limb_Mul_Full
+
+DESCRIPTION    : 64 x 64 bits multiply of limbs into 128 bits product
+
+INPUT          :
+
+OUTPUT         : returns low limb of product, and high limb of product is stored in high_limb_ptr
+
+NOTE           :
+
+Func ID        : 03.02
+
+BUGS           :
+-*------------------------------------------------------------*/
+static inline big_num_limb_t Limb_Mul_Full(const big_num_limb_t limb1, const big_num_limb_t limb2, big_num_limb_t *const high_limb_ptr)
+{
+	#ifdef BIG_NUM_DLIMB_SUPPORT
+	   big_num_dlimb_t product = (big_num_dlimb_t)limb1 * limb2;
+
+	   *high_limb_ptr = (big_num_limb_t)(product >> BIG_NUM_LIMB_BITS);
+	   return (big_num_limb_t)product;
+	#else
+	   big_num_limb_t limb1_low = limb1 & 0xFFFFFFFFULL, limb1_high = limb1 >> 32, limb2_low = limb2 & 0xFFFFFFFFULL, limb2_high = limb2 >> 32;
+	   big_num_limb_t low_product, mid1_product, mid2_product, high_product, mid_sum;
+
+	   low_product = limb1_low * limb2_low;
+	   mid1_product = limb1_low * limb2_high;
+	   mid2_product = limb1_high * limb2_low;
+	   high_product = limb1_high * limb2_high;
+	   mid_sum = (low_product >> 32) + (mid1_product & 0xFFFFFFFFULL) + (mid2_product & 0xFFFFFFFFULL);
+	   *high_limb_ptr = high_product + (mid1_product >> 32) + (mid2_product >> 32) + (mid_sum >> 32);
+	   return (mid_sum << 32) | (low_product & 0xFFFFFFFFULL);
+	#endif
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limb_Div_2by1
+
+DESCRIPTION    : 128 / 64 bits division of (high_limb, low_limb) by divisor
+
+INPUT          :
+
+OUTPUT         : returns quotient limb, and remainder is stored in rem_ptr
+
+NOTE           : high_limb must be less than divisor, so that quotient fits in a limb.
+                 Without double limb support, Knuth's algorithm of 32 bits half limbs is used (Hacker's Delight, divlu).
+
+Func ID        : 03.03
+
+BUGS           :
+-*------------------------------------------------------------*/
+static inline big_num_limb_t Limb_Div_2by1(const big_num_limb_t high_limb, const big_num_limb_t low_limb, const big_num_limb_t divisor, big_num_limb_t *const rem_ptr)
+{
+	#ifdef BIG_NUM_DLIMB_SUPPORT
+	   big_num_dlimb_t dividend = ((big_num_dlimb_t)high_limb << BIG_NUM_LIMB_BITS) | low_limb;
+	   big_num_limb_t quot;
+
+	   quot = (big_num_limb_t)(dividend / divisor);
+	   *rem_ptr = low_limb - (quot * divisor);
+	   return quot;
+	#else
+	   const big_num_limb_t half_base = 0x100000000ULL;
+	   big_num_limb_t norm_divisor, divisor_high, divisor_low, dividend_32, dividend_21, dividend_10, dividend_1, dividend_0, quot_1, quot_0, rhat;
+	   unsigned int shift_bits;
+
+	   shift_bits = Limb_Count_Leading_Zeros(divisor);
+	   norm_divisor = divisor << shift_bits;
+	   divisor_high = norm_divisor >> 32;
+	   divisor_low = norm_divisor & 0xFFFFFFFFULL;
+	   dividend_32 = (shift_bits == 0) ? high_limb : ((high_limb << shift_bits) | (low_limb >> (BIG_NUM_LIMB_BITS - shift_bits)));
+	   dividend_10 = low_limb << shift_bits;
+	   dividend_1 = dividend_10 >> 32;
+	   dividend_0 = dividend_10 & 0xFFFFFFFFULL;
+	   quot_1 = dividend_32 / divisor_high;
+	   rhat = dividend_32 - quot_1 * divisor_high;
+	   while(quot_1 >= half_base || quot_1 * divisor_low > ((rhat << 32) | dividend_1))
+	   {
+		   --quot_1;
+		   rhat += divisor_high;
+		   if(rhat >= half_base)
+		   {
+			   break;
+		   }
+	   }
+	   dividend_21 = (dividend_32 << 32) + dividend_1 - quot_1 * norm_divisor;
+	   quot_0 = dividend_21 / divisor_high;
+	   rhat = dividend_21 - quot_0 * divisor_high;
+	   while(quot_0 >= half_base || quot_0 * divisor_low > ((rhat << 32) | dividend_0))
+	   {
+		   --quot_0;
+		   rhat += divisor_high;
+		   if(rhat >= half_base)
+		   {
+			   break;
+		   }
+	   }
+	   *rem_ptr = ((dividend_21 << 32) + dividend_0 - quot_0 * norm_divisor) >> shift_bits;
+	   return (quot_1 << 32) | quot_0;
+	#endif
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Add_N
+
+DESCRIPTION    : result = limbs1 + limbs2, where both have num_limbs
+
+INPUT          :
+
+OUTPUT         : returns carry out of most significant limb
+
+NOTE           : result_ptr can be same as limbs1_ptr or limbs2_ptr.
+                 On x86-64, add with carry chain of 4 limbs per iteration is used, or Limbs_Add_N_Avx2() from LIMBS_AVX2_MIN_LEN limbs.
+
+Func ID        : 03.04
+
+BUGS           :
+-*------------------------------------------------------------*/
+big_num_limb_t Limbs_Add_N(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs1_ptr, const big_num_limb_t *const limbs2_ptr, const size_t num_limbs)
+{
+	size_t limb_pos = 0;
+
+	#ifdef BIG_NUM_X86_64_KERNELS
+	   unsigned char carry = 0;
+
+	   if(num_limbs >= LIMBS_AVX2_MIN_LEN && Cpu_Has_Avx2() == STATE_YES)
+	   {
+		   return Limbs_Add_N_Avx2(result_ptr, limbs1_ptr, limbs2_ptr, num_limbs);
+	   }
+	   for(; limb_pos + 4 <= num_limbs; limb_pos += 4)
+	   {
+		   carry = _addcarry_u64(carry, limbs1_ptr[limb_pos], limbs2_ptr[limb_pos], (big_num_adc_limb_t *)(result_ptr + limb_pos));
+		   carry = _addcarry_u64(carry, limbs1_ptr[limb_pos + 1], limbs2_ptr[limb_pos + 1], (big_num_adc_limb_t *)(result_ptr + limb_pos + 1));
+		   carry = _addcarry_u64(carry, limbs1_ptr[limb_pos + 2], limbs2_ptr[limb_pos + 2], (big_num_adc_limb_t *)(result_ptr + limb_pos + 2));
+		   carry = _addcarry_u64(carry, limbs1_ptr[limb_pos + 3], limbs2_ptr[limb_pos + 3], (big_num_adc_limb_t *)(result_ptr + limb_pos + 3));
+	   }
+	   for(; limb_pos < num_limbs; ++limb_pos)
+	   {
+		   carry = _addcarry_u64(carry, limbs1_ptr[limb_pos], limbs2_ptr[limb_pos], (big_num_adc_limb_t *)(result_ptr + limb_pos));
+	   }
+	   return carry;
+	#else
+	   big_num_limb_t carry = 0, sum, limb;
+
+	   for(; limb_pos < num_limbs; ++limb_pos)
+	   {
+		   limb = limbs1_ptr[limb_pos] + carry;
+		   carry = (limb < carry);
+		   sum = limb + limbs2_ptr[limb_pos];
+		   carry += (sum < limb);
+		   result_ptr[limb_pos] = sum;
+	   }
+	   return carry;
+	#endif
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Add_1
+
+DESCRIPTION    : result = limbs + limb
+
+INPUT          :
+
+OUTPUT         : returns carry out of most significant limb
+
+NOTE           : result_ptr can be same as limbs_ptr
+
+Func ID        : 03.05
+
+BUGS           :
+-*------------------------------------------------------------*/
+big_num_limb_t Limbs_Add_1(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs_ptr, const size_t num_limbs, const big_num_limb_t limb)
+{
+	big_num_limb_t carry = limb, sum;
+	size_t limb_pos;
+
+	for(limb_pos = 0; limb_pos < num_limbs && carry != 0; ++limb_pos)
+	{
+		sum = limbs_ptr[limb_pos] + carry;
+		carry = (sum < carry);
+		result_ptr[limb_pos] = sum;
+	}
+	if(result_ptr != limbs_ptr && limb_pos < num_limbs)
+	{
+		memcpy(result_ptr + limb_pos, limbs_ptr + limb_pos, (num_limbs - limb_pos) * sizeof(big_num_limb_t));
+	}
+	return carry;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Add
+
+DESCRIPTION    : result = limbs1 + limbs2, where num_limbs1 >= num_limbs2
+
+INPUT          :
+
+OUTPUT         : returns carry out of most significant limb, result has num_limbs1 limbs
+
+NOTE           : result_ptr can be same as limbs1_ptr or limbs2_ptr
+
+Func ID        : 03.06
+
+BUGS           :
+-*------------------------------------------------------------*/
+big_num_limb_t Limbs_Add(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs1_ptr, const size_t num_limbs1, const big_num_limb_t *const limbs2_ptr, const size_t num_limbs2)
+{
+	big_num_limb_t carry;
+
+	carry = Limbs_Add_N(result_ptr, limbs1_ptr, limbs2_ptr, num_limbs2);
+	return Limbs_Add_1(result_ptr + num_limbs2, limbs1_ptr + num_limbs2, num_limbs1 - num_limbs2, carry);
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Sub_N
+
+DESCRIPTION    : result = limbs1 - limbs2, where both have num_limbs
+
+INPUT          :
+
+OUTPUT         : returns borrow out of most significant limb
+
+NOTE           : result_ptr can be same as limbs1_ptr or limbs2_ptr.
+                 On x86-64, subtract with borrow chain of 4 limbs per iteration is used, or Limbs_Sub_N_Avx2() from LIMBS_AVX2_MIN_LEN limbs.
+
+Func ID        : 03.07
+
+BUGS           :
+-*------------------------------------------------------------*/
+big_num_limb_t Limbs_Sub_N(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs1_ptr, const big_num_limb_t *const limbs2_ptr, const size_t num_limbs)
+{
+	size_t limb_pos = 0;
+
+	#ifdef BIG_NUM_X86_64_KERNELS
+	   unsigned char borrow = 0;
+
+	   if(num_limbs >= LIMBS_AVX2_MIN_LEN && Cpu_Has_Avx2() == STATE_YES)
+	   {
+		   return Limbs_Sub_N_Avx2(result_ptr, limbs1_ptr, limbs2_ptr, num_limbs);
+	   }
+	   for(; limb_pos + 4 <= num_limbs; limb_pos += 4)
+	   {
+		   borrow = _subborrow_u64(borrow, limbs1_ptr[limb_pos], limbs2_ptr[limb_pos], (big_num_adc_limb_t *)(result_ptr + limb_pos));
+		   borrow = _subborrow_u64(borrow, limbs1_ptr[limb_pos + 1], limbs2_ptr[limb_pos + 1], (big_num_adc_limb_t *)(result_ptr + limb_pos + 1));
+		   borrow = _subborrow_u64(borrow, limbs1_ptr[limb_pos + 2], limbs2_ptr[limb_pos + 2], (big_num_adc_limb_t *)(result_ptr + limb_pos + 2));
+		   borrow = _subborrow_u64(borrow, limbs1_ptr[limb_pos + 3], limbs2_ptr[limb_pos + 3], (big_num_adc_limb_t *)(result_ptr + limb_pos + 3));
+	   }
+	   for(; limb_pos < num_limbs; ++limb_pos)
+	   {
+		   borrow = _subborrow_u64(borrow, limbs1_ptr[limb_pos], limbs2_ptr[limb_pos], (big_num_adc_limb_t *)(result_ptr + limb_pos));
+	   }
+	   return borrow;
+	#else
+	   big_num_limb_t borrow = 0, limb1, limb2;
+
+	   for(; limb_pos < num_limbs; ++limb_pos)
+	   {
+		   limb1 = limbs1_ptr[limb_pos];
+		   limb2 = limbs2_ptr[limb_pos] + borrow;
+		   borrow = (limb2 < borrow);
+		   borrow += (limb1 < limb2);
+		   result_ptr[limb_pos] = limb1 - limb2;
+	   }
+	   return borrow;
+	#endif
+}
+
+#ifdef BIG_NUM_X86_64_KERNELS
+/*------------------------------------------------------------*
+FUNCTION NAME  : Cpu_Has_Avx2
+
+DESCRIPTION    : checks if CPU supports AVX2
+
+INPUT          :
+
+OUTPUT         : returns STATE_YES or STATE_NO
+
+NOTE           : CPUID is checked on first call, and kept in cpu_avx2_state.
+
+Func ID        : 01.11
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint8_t Cpu_Has_Avx2(void)
+{
+	uint8_t avx2_state = __atomic_load_n(&cpu_avx2_state, __ATOMIC_RELAXED);
+
+	// threads checking CPUID at same time, store same state
+	if(avx2_state == STATE_NA)
+	{
+		__builtin_cpu_init();
+		avx2_state = (__builtin_cpu_supports("avx2")) ? STATE_YES : STATE_NO;
+		__atomic_store_n(&cpu_avx2_state, avx2_state, __ATOMIC_RELAXED);
+	}
+	return avx2_state;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Add_N_Avx2
+
+DESCRIPTION    : result = limbs1 + limbs2, where both have num_limbs, by AVX2 with carry lookahead
+
+INPUT          :
+
+OUTPUT         : returns carry out of most significant limb
+
+NOTE           : 4 limbs are added in lanes without carry. Lane i generates carry if its sum is less than its limb1, and
+                 propagates carry if its sum is all ones. Like carry lookahead adder, carry into lane i is bit i of
+                 (((generate << 1) + propagate + carry in) ^ propagate), and bit 4 is carry out to next 4 limbs.
+                 result_ptr can be same as limbs1_ptr or limbs2_ptr.
+
+Func ID        : 03.52
+
+BUGS           :
+-*------------------------------------------------------------*/
+__attribute__((target("avx2")))
+big_num_limb_t Limbs_Add_N_Avx2(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs1_ptr, const big_num_limb_t *const limbs2_ptr, const size_t num_limbs)
+{
+	const __m256i sign_bits = _mm256_set1_epi64x(INT64_MIN), all_ones = _mm256_set1_epi64x(-1), lane_shifts = _mm256_set_epi64x(3, 2, 1, 0),
+	   lane_one = _mm256_set1_epi64x(1);
+	__m256i limbs1, sums;
+	big_num_limb_t sum;
+	unsigned int carry = 0, generate_mask, propagate_mask, carry_mask;
+	size_t limb_pos;
+
+	for(limb_pos = 0; limb_pos + 4 <= num_limbs; limb_pos += 4)
+	{
+		limbs1 = _mm256_loadu_si256((const __m256i *)(limbs1_ptr + limb_pos));
+		sums = _mm256_add_epi64(limbs1, _mm256_loadu_si256((const __m256i *)(limbs2_ptr + limb_pos)));
+		/* unsigned compare, by flipping sign bits for signed compare */
+		generate_mask = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(_mm256_xor_si256(limbs1, sign_bits), _mm256_xor_si256(sums, sign_bits))));
+		propagate_mask = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(sums, all_ones)));
+		carry_mask = (generate_mask << 1) + propagate_mask + carry;
+		carry = carry_mask >> 4;
+		carry_mask = (carry_mask ^ propagate_mask) & 0xF;
+		sums = _mm256_add_epi64(sums, _mm256_and_si256(_mm256_srlv_epi64(_mm256_set1_epi64x(carry_mask), lane_shifts), lane_one));
+		_mm256_storeu_si256((__m256i *)(result_ptr + limb_pos), sums);
+	}
+	for(; limb_pos < num_limbs; ++limb_pos)
+	{
+		sum = limbs1_ptr[limb_pos] + carry;
+		carry = (sum < carry);
+		result_ptr[limb_pos] = sum + limbs2_ptr[limb_pos];
+		carry += (result_ptr[limb_pos] < sum);
+	}
+	return carry;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Sub_N_Avx2
+
+DESCRIPTION    : result = limbs1 - limbs2, where both have num_limbs, by AVX2 with borrow lookahead
+
+INPUT          :
+
+OUTPUT         : returns borrow out of most significant limb
+
+NOTE           : as of Limbs_Add_N_Avx2(), where lane i generates borrow if its limb1 is less than its limb2, and propagates
+                 borrow if its difference is 0. result_ptr can be same as limbs1_ptr or limbs2_ptr.
+
+Func ID        : 03.53
+
+BUGS           :
+-*------------------------------------------------------------*/
+__attribute__((target("avx2")))
+big_num_limb_t Limbs_Sub_N_Avx2(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs1_ptr, const big_num_limb_t *const limbs2_ptr, const size_t num_limbs)
+{
+	const __m256i sign_bits = _mm256_set1_epi64x(INT64_MIN), lane_shifts = _mm256_set_epi64x(3, 2, 1, 0), lane_one = _mm256_set1_epi64x(1);
+	__m256i limbs1, limbs2, diffs;
+	big_num_limb_t limb2;
+	unsigned int borrow = 0, generate_mask, propagate_mask, borrow_mask;
+	size_t limb_pos;
+
+	for(limb_pos = 0; limb_pos + 4 <= num_limbs; limb_pos += 4)
+	{
+		limbs1 = _mm256_loadu_si256((const __m256i *)(limbs1_ptr + limb_pos));
+		limbs2 = _mm256_loadu_si256((const __m256i *)(limbs2_ptr + limb_pos));
+		diffs = _mm256_sub_epi64(limbs1, limbs2);
+		generate_mask = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(_mm256_xor_si256(limbs2, sign_bits), _mm256_xor_si256(limbs1, sign_bits))));
+		propagate_mask = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(diffs, _mm256_setzero_si256())));
+		borrow_mask = (generate_mask << 1) + propagate_mask + borrow;
+		borrow = borrow_mask >> 4;
+		borrow_mask = (borrow_mask ^ propagate_mask) & 0xF;
+		diffs = _mm256_sub_epi64(diffs, _mm256_and_si256(_mm256_srlv_epi64(_mm256_set1_epi64x(borrow_mask), lane_shifts), lane_one));
+		_mm256_storeu_si256((__m256i *)(result_ptr + limb_pos), diffs);
+	}
+	for(; limb_pos < num_limbs; ++limb_pos)
+	{
+		limb2 = limbs2_ptr[limb_pos] + borrow;
+		borrow = (limb2 < borrow);
+		borrow += (limbs1_ptr[limb_pos] < limb2);
+		result_ptr[limb_pos] = limbs1_ptr[limb_pos] - limb2;
+	}
+	return borrow;
+}
+#endif
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Sub_1
+
+DESCRIPTION    : result = limbs - limb
+
+INPUT          :
+
+OUTPUT         : returns borrow out of most significant limb
+
+NOTE           : result_ptr can be same as limbs_ptr
+
+Func ID        : 03.08
+
+BUGS           :
+-*------------------------------------------------------------*/
+big_num_limb_t Limbs_Sub_1(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs_ptr, const size_t num_limbs, const big_num_limb_t limb)
+{
+	big_num_limb_t borrow = limb, limb1;
+	size_t limb_pos;
+
+	for(limb_pos = 0; limb_pos < num_limbs && borrow != 0; ++limb_pos)
+	{
+		limb1 = limbs_ptr[limb_pos];
+		result_ptr[limb_pos] = limb1 - borrow;
+		borrow = (limb1 < borrow);
+	}
+	if(result_ptr != limbs_ptr && limb_pos < num_limbs)
+	{
+		memcpy(result_ptr + limb_pos, limbs_ptr + limb_pos, (num_limbs - limb_pos) * sizeof(big_num_limb_t));
+	}
+	return borrow;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Sub
+
+DESCRIPTION    : result = limbs1 - limbs2, where num_limbs1 >= num_limbs2
+
+INPUT          :
+
+OUTPUT         : returns borrow out of most significant limb, result has num_limbs1 limbs
+
+NOTE           : result_ptr can be same as limbs1_ptr or limbs2_ptr
+
+Func ID        : 03.09
+
+BUGS           :
+-*------------------------------------------------------------*/
+big_num_limb_t Limbs_Sub(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs1_ptr, const size_t num_limbs1, const big_num_limb_t *const limbs2_ptr, const size_t num_limbs2)
+{
+	big_num_limb_t borrow;
+
+	borrow = Limbs_Sub_N(result_ptr, limbs1_ptr, limbs2_ptr, num_limbs2);
+	return Limbs_Sub_1(result_ptr + num_limbs2, limbs1_ptr + num_limbs2, num_limbs1 - num_limbs2, borrow);
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Mul_1
+
+DESCRIPTION    : result = limbs * multiplier
+
+INPUT          :
+
+OUTPUT         : returns carry limb out of most significant limb
+
+NOTE           : result_ptr can be same as limbs_ptr
+
+Func ID        : 03.10
+
+BUGS           :
+-*------------------------------------------------------------*/
+big_num_limb_t Limbs_Mul_1(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs_ptr, const size_t num_limbs, const big_num_limb_t multiplier)
+{
+	big_num_limb_t carry = 0, low_limb, high_limb;
+	size_t limb_pos;
+
+	for(limb_pos = 0; limb_pos < num_limbs; ++limb_pos)
+	{
+		low_limb = Limb_Mul_Full(limbs_ptr[limb_pos], multiplier, &high_limb);
+		low_limb += carry;
+		high_limb += (low_limb < carry);
+		result_ptr[limb_pos] = low_limb;
+		carry = high_limb;
+	}
+	return carry;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Addmul_1
+
+DESCRIPTION    : result = result + (limbs * multiplier)
+
+INPUT          :
+
+OUTPUT         : returns carry limb out of most significant limb
+
+NOTE           :
+
+Func ID        : 03.11
+
+BUGS           :
+-*------------------------------------------------------------*/
+big_num_limb_t Limbs_Addmul_1(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs_ptr, const size_t num_limbs, const big_num_limb_t multiplier)
+{
+	big_num_limb_t carry = 0, low_limb, high_limb, sum;
+	size_t limb_pos;
+
+	for(limb_pos = 0; limb_pos < num_limbs; ++limb_pos)
+	{
+		low_limb = Limb_Mul_Full(limbs_ptr[limb_pos], multiplier, &high_limb);
+		low_limb += carry;
+		high_limb += (low_limb < carry);
+		sum = result_ptr[limb_pos] + low_limb;
+		high_limb += (sum < low_limb);
+		result_ptr[limb_pos] = sum;
+		carry = high_limb;
+	}
+	return carry;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Submul_1
+
+DESCRIPTION    : result = result - (limbs * multiplier)
+
+INPUT          :
+
+OUTPUT         : returns borrow limb out of most significant limb
+
+NOTE           :
+
+Func ID        : 03.12
+
+BUGS           :
+-*------------------------------------------------------------*/
+big_num_limb_t Limbs_Submul_1(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs_ptr, const size_t num_limbs, const big_num_limb_t multiplier)
+{
+	big_num_limb_t borrow = 0, low_limb, high_limb, limb;
+	size_t limb_pos;
+
+	for(limb_pos = 0; limb_pos < num_limbs; ++limb_pos)
+	{
+		low_limb = Limb_Mul_Full(limbs_ptr[limb_pos], multiplier, &high_limb);
+		low_limb += borrow;
+		high_limb += (low_limb < borrow);
+		limb = result_ptr[limb_pos];
+		result_ptr[limb_pos] = limb - low_limb;
+		high_limb += (limb < low_limb);
+		borrow = high_limb;
+	}
+	return borrow;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Lshift
+
+DESCRIPTION    : result = limbs << shift_bits
+
+INPUT          :
+
+OUTPUT         : returns bits shifted out of most significant limb
+
+NOTE           : shift_bits must be in [1, BIG_NUM_LIMB_BITS - 1]. result_ptr can be same as limbs_ptr
+
+Func ID        : 03.13
+
+BUGS           :
+-*------------------------------------------------------------*/
+big_num_limb_t Limbs_Lshift(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs_ptr, const size_t num_limbs, const unsigned int shift_bits)
+{
+	big_num_limb_t out_bits = 0, limb;
+	size_t limb_pos;
+
+	for(limb_pos = num_limbs; limb_pos > 0; --limb_pos)
+	{
+		limb = limbs_ptr[limb_pos - 1];
+		if(limb_pos == num_limbs)
+		{
+			out_bits = limb >> (BIG_NUM_LIMB_BITS - shift_bits);
+		}
+		result_ptr[limb_pos - 1] = (limb << shift_bits) | ((limb_pos > 1) ? (limbs_ptr[limb_pos - 2] >> (BIG_NUM_LIMB_BITS - shift_bits)) : 0);
+	}
+	return out_bits;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Rshift
+
+DESCRIPTION    : result = limbs >> shift_bits
+
+INPUT          :
+
+OUTPUT         : returns bits shifted out of least significant limb, in high bits of returned limb
+
+NOTE           : shift_bits must be in [1, BIG_NUM_LIMB_BITS - 1]. result_ptr can be same as limbs_ptr
+
+Func ID        : 03.14
+
+BUGS           :
+-*------------------------------------------------------------*/
+big_num_limb_t Limbs_Rshift(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs_ptr, const size_t num_limbs, const unsigned int shift_bits)
+{
+	big_num_limb_t out_bits = 0, limb;
+	size_t limb_pos;
+
+	for(limb_pos = 0; limb_pos < num_limbs; ++limb_pos)
+	{
+		limb = limbs_ptr[limb_pos];
+		if(limb_pos == 0)
+		{
+			out_bits = limb << (BIG_NUM_LIMB_BITS - shift_bits);
+		}
+		result_ptr[limb_pos] = (limb >> shift_bits) | ((limb_pos + 1 < num_limbs) ? (limbs_ptr[limb_pos + 1] << (BIG_NUM_LIMB_BITS - shift_bits)) : 0);
+	}
+	return out_bits;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Cmp
+
+DESCRIPTION    : compares limbs1 and limbs2, where both have num_limbs
+
+INPUT          :
+
+OUTPUT         : returns 1 if limbs1 > limbs2, 0 if equal, -1 if limbs1 < limbs2
+
+NOTE           :
+
+Func ID        : 03.15
+
+BUGS           :
+-*------------------------------------------------------------*/
+int Limbs_Cmp(const big_num_limb_t *const limbs1_ptr, const big_num_limb_t *const limbs2_ptr, const size_t num_limbs)
+{
+	size_t limb_pos;
+
+	for(limb_pos = num_limbs; limb_pos > 0; --limb_pos)
+	{
+		if(limbs1_ptr[limb_pos - 1] != limbs2_ptr[limb_pos - 1])
+		{
+			return (limbs1_ptr[limb_pos - 1] > limbs2_ptr[limb_pos - 1]) ? 1 : -1;
+		}
+	}
+	return 0;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Normalized_Len
+
+DESCRIPTION    : num of limbs after excluding zero limbs at most significant end
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           :
+
+Func ID        : 03.16
+
+BUGS           :
+-*------------------------------------------------------------*/
+size_t Limbs_Normalized_Len(const big_num_limb_t *const limbs_ptr, size_t num_limbs)
+{
+	while(num_limbs > 0 && limbs_ptr[num_limbs - 1] == 0)
+	{
+		--num_limbs;
+	}
+	return num_limbs;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Mul_Basecase
+
+DESCRIPTION    : grade-school method of multiplication, one limb of limbs2 per row
+
+INPUT          :
+
+OUTPUT         : result has (num_limbs1 + num_limbs2) limbs
+
+NOTE           : num_limbs1 >= num_limbs2 >= 1. result_ptr must not overlap limbs1_ptr or limbs2_ptr
+
+Func ID        : 03.17
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Limbs_Mul_Basecase(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs1_ptr, const size_t num_limbs1, const big_num_limb_t *const limbs2_ptr, const size_t num_limbs2)
+{
+	size_t limb_pos;
+
+	result_ptr[num_limbs1] = Limbs_Mul_1(result_ptr, limbs1_ptr, num_limbs1, limbs2_ptr[0]);
+	for(limb_pos = 1; limb_pos < num_limbs2; ++limb_pos)
+	{
+		result_ptr[num_limbs1 + limb_pos] = Limbs_Addmul_1(result_ptr + limb_pos, limbs1_ptr, num_limbs1, limbs2_ptr[limb_pos]);
+	}
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Mul
+
+DESCRIPTION    : result = limbs1 * limbs2
+
+INPUT          :
+
+OUTPUT         : result has (num_limbs1 + num_limbs2) limbs
+
+NOTE           : num_limbs1, num_limbs2 >= 1, and operands are exchanged if num_limbs1 < num_limbs2. result_ptr must not overlap limbs1_ptr or limbs2_ptr.
+                 For squaring, limbs2_ptr can be same as limbs1_ptr, and then NTT does only one forward transform.
+                 Scratch of Karatsuba, Toom and NTT multiplication is taken from scratch arena of calling thread by Scratch_Alloc().
+                 Large multiplication is split into tasks of upto mul_num_threads threads, with same product for any num of threads.
+
+Func ID        : 03.18
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Limbs_Mul(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs1_ptr, const size_t num_limbs1, const big_num_limb_t *const limbs2_ptr, const size_t num_limbs2)
+{
+	big_num_limb_t *scratch_ptr, *chunk_prod_ptr, carry;
+	size_t scratch_size, limb_pos, chunk_len;
+	uint16_t ret_status = SUCCESS;
+
+	if(num_limbs1 < num_limbs2)
+	{
+		return Limbs_Mul(result_ptr, limbs2_ptr, num_limbs2, limbs1_ptr, num_limbs1);
+	}
+	if(num_limbs2 < karatsuba_threshold)
+	{
+		Limbs_Mul_Basecase(result_ptr, limbs1_ptr, num_limbs1, limbs2_ptr, num_limbs2);
+		return SUCCESS;
+	}
+	if(num_limbs2 >= ntt_threshold)
+	{
+		return Limbs_Mul_Ntt(result_ptr, limbs1_ptr, num_limbs1, limbs2_ptr, num_limbs2);
+	}
+	scratch_size = Limbs_Mul_N_Scratch_Size(num_limbs2);
+	scratch_ptr = Scratch_Alloc(scratch_size + 2 * num_limbs2);
+	if(scratch_ptr == NULL_DATA_PTR)
+	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("mul - memory alloc failed \n");
+		#endif
+		return FAILURE;
+	}
+	/* unbalanced operands: limbs1 is multiplied in chunks of num_limbs2 limbs, and each chunk product is added at its position.
+	   Full chunks are multiplied in parallel, if Limbs_Mul_Chunks_Par() can */
+	if((Limbs_Mul_Chunks_Par(result_ptr, limbs1_ptr, num_limbs1, limbs2_ptr, num_limbs2)) == STATE_YES)
+	{
+		limb_pos = (num_limbs1 / num_limbs2) * num_limbs2;
+	}
+	else
+	{
+		Limbs_Mul_N(result_ptr, limbs1_ptr, limbs2_ptr, num_limbs2, scratch_ptr);
+		limb_pos = num_limbs2;
+	}
+	chunk_prod_ptr = scratch_ptr + scratch_size;
+	for(; limb_pos < num_limbs1 && ret_status == SUCCESS; limb_pos += chunk_len)
+	{
+		chunk_len = (num_limbs1 - limb_pos < num_limbs2) ? (num_limbs1 - limb_pos) : num_limbs2;
+		if(chunk_len == num_limbs2)
+		{
+			Limbs_Mul_N(chunk_prod_ptr, limbs1_ptr + limb_pos, limbs2_ptr, num_limbs2, scratch_ptr);
+		}
+		else
+		{
+			ret_status = Limbs_Mul(chunk_prod_ptr, limbs2_ptr, num_limbs2, limbs1_ptr + limb_pos, chunk_len);
+		}
+		carry = Limbs_Add_N(result_ptr + limb_pos, result_ptr + limb_pos, chunk_prod_ptr, num_limbs2);
+		Limbs_Add_1(result_ptr + limb_pos + num_limbs2, chunk_prod_ptr + num_limbs2, chunk_len, carry);
+	}
+	Scratch_Free(scratch_ptr);
+	return ret_status;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Abs_Diff
+
+DESCRIPTION    : result = |limbs1 - limbs2|, where num_limbs1 >= num_limbs2
+
+INPUT          :
+
+OUTPUT         : returns 1 if limbs1 < limbs2, else 0. result has num_limbs1 limbs
+
+NOTE           :
+
+Func ID        : 03.21
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint8_t Limbs_Abs_Diff(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs1_ptr, const size_t num_limbs1, const big_num_limb_t *const limbs2_ptr, const size_t num_limbs2)
+{
+	int cmp_result;
+
+	if(Limbs_Normalized_Len(limbs1_ptr + num_limbs2, num_limbs1 - num_limbs2) != 0)
+	{
+		cmp_result = 1;
+	}
+	else
+	{
+		cmp_result = Limbs_Cmp(limbs1_ptr, limbs2_ptr, num_limbs2);
+	}
+	if(cmp_result >= 0)
+	{
+		Limbs_Sub(result_ptr, limbs1_ptr, num_limbs1, limbs2_ptr, num_limbs2);
+		return 0;
+	}
+	Limbs_Sub_N(result_ptr, limbs2_ptr, limbs1_ptr, num_limbs2);
+	memset(result_ptr + num_limbs2, 0, (num_limbs1 - num_limbs2) * sizeof(big_num_limb_t));
+	return 1;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Mul_N_Scratch_Size
+
+DESCRIPTION    : num of scratch limbs needed by Limbs_Mul_N() for num_limbs x num_limbs multiplication
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           : every Karatsuba, Toom-3 or Toom-4 level uses at most (8 * num_limbs + 64) limbs, and passes rest of scratch to
+                 its sub products, which have at most (num_limbs / 2 + 2) limbs. So size is same or more for more num_limbs.
+
+Func ID        : 03.22
+
+BUGS           :
+-*------------------------------------------------------------*/
+size_t Limbs_Mul_N_Scratch_Size(const size_t num_limbs)
+{
+	size_t scratch_size = 0, proc_num_limbs = num_limbs;
+
+	while(proc_num_limbs >= karatsuba_threshold)
+	{
+		scratch_size += 8 * proc_num_limbs + 64;
+		proc_num_limbs = proc_num_limbs / 2 + 2;
+	}
+	return scratch_size;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Mul_N
+
+DESCRIPTION    : result = limbs1 * limbs2, where both have num_limbs
+
+INPUT          :
+
+OUTPUT         : result has (2 * num_limbs) limbs
+
+NOTE           : selects grade-school, Karatsuba, Toom-3 or Toom-4 multiplication by num_limbs.
+                 scratch_ptr must have Limbs_Mul_N_Scratch_Size(num_limbs) limbs.
+
+Func ID        : 03.23
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Limbs_Mul_N(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs1_ptr, const big_num_limb_t *const limbs2_ptr, const size_t num_limbs, big_num_limb_t *const scratch_ptr)
+{
+	if(num_limbs < karatsuba_threshold)
+	{
+		Limbs_Mul_Basecase(result_ptr, limbs1_ptr, num_limbs, limbs2_ptr, num_limbs);
+	}
+	else if(num_limbs < toom3_threshold)
+	{
+		Limbs_Mul_Karatsuba(result_ptr, limbs1_ptr, limbs2_ptr, num_limbs, scratch_ptr);
+	}
+	else if(num_limbs < toom4_threshold)
+	{
+		Limbs_Mul_Toom3(result_ptr, limbs1_ptr, limbs2_ptr, num_limbs, scratch_ptr);
+	}
+	else
+	{
+		Limbs_Mul_Toom4(result_ptr, limbs1_ptr, limbs2_ptr, num_limbs, scratch_ptr);
+	}
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Mul_Karatsuba
+
+DESCRIPTION    : Karatsuba multiplication of limbs1 and limbs2, where both have num_limbs
+
+INPUT          :
+
+OUTPUT         : result has (2 * num_limbs) limbs
+
+NOTE           : limbs1 = a1 * B^half + a0, limbs2 = b1 * B^half + b0, where B = 2 ^ BIG_NUM_LIMB_BITS.
+                 result = z2 * B^(2 * half) + z1 * B^half + z0, where z0 = a0 * b0, z2 = a1 * b1 and
+                 z1 = z0 + z2 - (a0 - a1) * (b0 - b1), so that only three half size products are needed.
+
+Func ID        : 03.24
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Limbs_Mul_Karatsuba(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs1_ptr, const big_num_limb_t *const limbs2_ptr, const size_t num_limbs, big_num_limb_t *const scratch_ptr)
+{
+	size_t half = (num_limbs + 1) / 2, high = num_limbs - half;
+	big_num_limb_t *diff1_ptr = scratch_ptr, *diff2_ptr = scratch_ptr + half, *diff_prod_ptr = scratch_ptr + 2 * half, *mid_ptr = scratch_ptr + 4 * half;
+	big_num_limb_t *next_scratch_ptr = scratch_ptr + 6 * half + 1;
+	uint8_t diff1_neg_flag, diff2_neg_flag;
+
+	diff1_neg_flag = Limbs_Abs_Diff(diff1_ptr, limbs1_ptr, half, limbs1_ptr + half, high);
+	diff2_neg_flag = Limbs_Abs_Diff(diff2_ptr, limbs2_ptr, half, limbs2_ptr + half, high);
+	Limbs_Mul_N(result_ptr, limbs1_ptr, limbs2_ptr, half, next_scratch_ptr);
+	Limbs_Mul_N(result_ptr + 2 * half, limbs1_ptr + half, limbs2_ptr + half, high, next_scratch_ptr);
+	Limbs_Mul_N(diff_prod_ptr, diff1_ptr, diff2_ptr, half, next_scratch_ptr);
+	mid_ptr[2 * half] = Limbs_Add(mid_ptr, result_ptr, 2 * half, result_ptr + 2 * half, 2 * high);
+	if(diff1_neg_flag == diff2_neg_flag)
+	{
+		Limbs_Sub(mid_ptr, mid_ptr, 2 * half + 1, diff_prod_ptr, 2 * half);
+	}
+	else
+	{
+		Limbs_Add(mid_ptr, mid_ptr, 2 * half + 1, diff_prod_ptr, 2 * half);
+	}
+	Limbs_Add(result_ptr + half, result_ptr + half, 2 * num_limbs - half, mid_ptr, 2 * half + 1);
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Twos_Neg
+
+DESCRIPTION    : limbs = -limbs, in two's complement of num_limbs
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           :
+
+Func ID        : 03.25
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Limbs_Twos_Neg(big_num_limb_t *const limbs_ptr, const size_t num_limbs)
+{
+	size_t limb_pos;
+
+	for(limb_pos = 0; limb_pos < num_limbs; ++limb_pos)
+	{
+		limbs_ptr[limb_pos] = ~limbs_ptr[limb_pos];
+	}
+	Limbs_Add_1(limbs_ptr, limbs_ptr, num_limbs, 1);
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Twos_Divexact_1
+
+DESCRIPTION    : limbs = limbs / divisor, in two's complement of num_limbs
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           : limbs must be multiple of divisor. divisor = 2 ^ shift_bits * odd divisor, where 2 ^ shift_bits is divided by arithmetic
+                 right shift, and odd divisor by multiplying with its inverse modulo 2 ^ BIG_NUM_LIMB_BITS, one limb at a time from
+                 least significant limb, so that no division instruction is needed.
+
+Func ID        : 03.26
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Limbs_Twos_Divexact_1(big_num_limb_t *const limbs_ptr, const size_t num_limbs, const big_num_limb_t divisor)
+{
+	big_num_limb_t odd_divisor = divisor, inverse, borrow = 0, limb, high_limb, sign_limb;
+	unsigned int shift_bits = 0;
+	size_t limb_pos;
+
+	while((odd_divisor & 1) == 0)
+	{
+		odd_divisor >>= 1;
+		++shift_bits;
+	}
+	if(shift_bits > 0)
+	{
+		sign_limb = (limbs_ptr[num_limbs - 1] >> (BIG_NUM_LIMB_BITS - 1)) ? BIG_NUM_LIMB_MAX : 0;
+		Limbs_Rshift(limbs_ptr, limbs_ptr, num_limbs, shift_bits);
+		limbs_ptr[num_limbs - 1] |= sign_limb << (BIG_NUM_LIMB_BITS - shift_bits);
+	}
+	if(odd_divisor == 1)
+	{
+		return;
+	}
+	/* Newton iteration doubles num of correct low bits of inverse, from 5 bits of (3 * odd_divisor) ^ 2 */
+	inverse = (3 * odd_divisor) ^ 2;
+	inverse *= 2 - odd_divisor * inverse;
+	inverse *= 2 - odd_divisor * inverse;
+	inverse *= 2 - odd_divisor * inverse;
+	inverse *= 2 - odd_divisor * inverse;
+	for(limb_pos = 0; limb_pos < num_limbs; ++limb_pos)
+	{
+		limb = limbs_ptr[limb_pos] - borrow;
+		borrow = (limbs_ptr[limb_pos] < borrow);
+		limb *= inverse;
+		limbs_ptr[limb_pos] = limb;
+		Limb_Mul_Full(limb, odd_divisor, &high_limb);
+		borrow += high_limb;
+	}
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Twos_Submul_1
+
+DESCRIPTION    : result = result - limbs * multiplier, in two's complement of num_result_limbs
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           : num_result_limbs >= num_limbs >= 1, and limbs is unsigned
+
+Func ID        : 03.27
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Limbs_Twos_Submul_1(big_num_limb_t *const result_ptr, const size_t num_result_limbs, const big_num_limb_t *const limbs_ptr, const size_t num_limbs, const big_num_limb_t multiplier)
+{
+	big_num_limb_t borrow;
+
+	borrow = Limbs_Submul_1(result_ptr, limbs_ptr, num_limbs, multiplier);
+	Limbs_Sub_1(result_ptr + num_limbs, result_ptr + num_limbs, num_result_limbs - num_limbs, borrow);
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Toom_Eval
+
+DESCRIPTION    : result = sum of part[i] * point ^ ((i - first_part) / 2), for i = first_part, first_part + 2, .. < num_parts
+
+INPUT          : limbs is split into num_parts, each of part_len limbs, except last part of last_part_len limbs
+
+OUTPUT         : result has (part_len + 1) limbs
+
+NOTE           : evaluated by Horner's method. Value must fit in (part_len + 1) limbs
+
+Func ID        : 03.28
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Limbs_Toom_Eval(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs_ptr, const size_t part_len, const size_t last_part_len, const size_t num_parts,
+   const size_t first_part, const big_num_limb_t point)
+{
+	size_t part_index = first_part + ((num_parts - 1 - first_part) / 2) * 2, proc_part_len;
+
+	proc_part_len = (part_index == num_parts - 1) ? last_part_len : part_len;
+	memcpy(result_ptr, limbs_ptr + part_index * part_len, proc_part_len * sizeof(big_num_limb_t));
+	memset(result_ptr + proc_part_len, 0, (part_len + 1 - proc_part_len) * sizeof(big_num_limb_t));
+	while(part_index > first_part)
+	{
+		part_index -= 2;
+		Limbs_Mul_1(result_ptr, result_ptr, part_len + 1, point);
+		Limbs_Add(result_ptr, result_ptr, part_len + 1, limbs_ptr + part_index * part_len, part_len);
+	}
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Toom_Eval_Pm
+
+DESCRIPTION    : pos = value of limbs at +point, neg = |value of limbs at -point|, where limbs is split into num_parts
+
+INPUT          : temp_ptr has (part_len + 1) limbs
+
+OUTPUT         : returns 1 if value at -point is negative, else 0. pos and neg have (part_len + 1) limbs
+
+NOTE           : value = even + odd, where even and odd are sums of even and odd parts of limbs at point
+
+Func ID        : 03.29
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint8_t Limbs_Toom_Eval_Pm(big_num_limb_t *const pos_ptr, big_num_limb_t *const neg_ptr, big_num_limb_t *const temp_ptr, const big_num_limb_t *const limbs_ptr, const size_t part_len,
+   const size_t last_part_len, const size_t num_parts, const big_num_limb_t point)
+{
+	uint8_t neg_flag;
+
+	Limbs_Toom_Eval(pos_ptr, limbs_ptr, part_len, last_part_len, num_parts, 0, point * point);
+	Limbs_Toom_Eval(temp_ptr, limbs_ptr, part_len, last_part_len, num_parts, 1, point * point);
+	Limbs_Mul_1(temp_ptr, temp_ptr, part_len + 1, point);
+	neg_flag = Limbs_Abs_Diff(neg_ptr, pos_ptr, part_len + 1, temp_ptr, part_len + 1);
+	Limbs_Add_N(pos_ptr, pos_ptr, temp_ptr, part_len + 1);
+	return neg_flag;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Toom_Add_Coeff
+
+DESCRIPTION    : result = result + coeff, where coeff is non negative
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           : coeff must fit in num_result_limbs, after its leading zero limbs are removed
+
+Func ID        : 03.30
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Limbs_Toom_Add_Coeff(big_num_limb_t *const result_ptr, const size_t num_result_limbs, const big_num_limb_t *const coeff_ptr, const size_t num_coeff_limbs)
+{
+	size_t coeff_len = Limbs_Normalized_Len(coeff_ptr, num_coeff_limbs);
+
+	if(coeff_len > 0)
+	{
+		Limbs_Add(result_ptr, result_ptr, num_result_limbs, coeff_ptr, coeff_len);
+	}
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Mul_Toom3
+
+DESCRIPTION    : Toom-3 multiplication of limbs1 and limbs2, where both have num_limbs
+
+INPUT          :
+
+OUTPUT         : result has (2 * num_limbs) limbs
+
+NOTE           : limbs1 and limbs2 are split into 3 parts of part_len limbs, as polynomials of degree 2 in B^part_len.
+                 Their product polynomial of degree 4 is found from its values at 0, 1, -1, 2 and infinity:
+                 c0 = v0, c4 = vinf, c2 = (v1 + v-1) / 2 - c0 - c4,
+                 c3 = ((v2 - c0 - 4 * c2 - 16 * c4) / 2 - (v1 - v-1) / 2) / 3, c1 = (v1 - v-1) / 2 - c3.
+                 Interpolation is done in two's complement of (2 * part_len + 2) limbs, as its intermediate values can be negative.
+
+Func ID        : 03.31
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Limbs_Mul_Toom3(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs1_ptr, const big_num_limb_t *const limbs2_ptr, const size_t num_limbs, big_num_limb_t *const scratch_ptr)
+{
+	size_t part_len = (num_limbs + 2) / 3, last_part_len = num_limbs - 2 * part_len, eval_len = part_len + 1, coeff_len = 2 * part_len + 2;
+	big_num_limb_t *eval1_pos1_ptr = scratch_ptr, *eval1_neg1_ptr = eval1_pos1_ptr + eval_len, *eval1_pos2_ptr = eval1_neg1_ptr + eval_len;
+	big_num_limb_t *eval2_pos1_ptr = eval1_pos2_ptr + eval_len, *eval2_neg1_ptr = eval2_pos1_ptr + eval_len, *eval2_pos2_ptr = eval2_neg1_ptr + eval_len;
+	big_num_limb_t *val_pos1_ptr = eval2_pos2_ptr + eval_len, *val_neg1_ptr = val_pos1_ptr + coeff_len, *val_pos2_ptr = val_neg1_ptr + coeff_len;
+	big_num_limb_t *temp_ptr = val_pos2_ptr + coeff_len, *next_scratch_ptr = temp_ptr + coeff_len;
+	big_num_limb_t *const val_inf_ptr = result_ptr + 4 * part_len;
+	limbs_mul_task_t mul_tasks[5] =
+	{
+		{val_pos1_ptr, eval1_pos1_ptr, eval2_pos1_ptr, eval_len, NULL_DATA_PTR}, {val_neg1_ptr, eval1_neg1_ptr, eval2_neg1_ptr, eval_len, NULL_DATA_PTR},
+		{val_pos2_ptr, eval1_pos2_ptr, eval2_pos2_ptr, eval_len, NULL_DATA_PTR}, {result_ptr, limbs1_ptr, limbs2_ptr, part_len, NULL_DATA_PTR},
+		{val_inf_ptr, limbs1_ptr + 2 * part_len, limbs2_ptr + 2 * part_len, last_part_len, NULL_DATA_PTR}
+	};
+	uint8_t neg_flag;
+
+	neg_flag = Limbs_Toom_Eval_Pm(eval1_pos1_ptr, eval1_neg1_ptr, temp_ptr, limbs1_ptr, part_len, last_part_len, 3, 1);
+	neg_flag ^= Limbs_Toom_Eval_Pm(eval2_pos1_ptr, eval2_neg1_ptr, temp_ptr, limbs2_ptr, part_len, last_part_len, 3, 1);
+	/* value at 2 = even parts at 4 + 2 * odd parts at 4 */
+	Limbs_Toom_Eval(eval1_pos2_ptr, limbs1_ptr, part_len, last_part_len, 3, 0, 4);
+	Limbs_Toom_Eval(temp_ptr, limbs1_ptr, part_len, last_part_len, 3, 1, 4);
+	Limbs_Addmul_1(eval1_pos2_ptr, temp_ptr, eval_len, 2);
+	Limbs_Toom_Eval(eval2_pos2_ptr, limbs2_ptr, part_len, last_part_len, 3, 0, 4);
+	Limbs_Toom_Eval(temp_ptr, limbs2_ptr, part_len, last_part_len, 3, 1, 4);
+	Limbs_Addmul_1(eval2_pos2_ptr, temp_ptr, eval_len, 2);
+
+	Limbs_Mul_N_Tasks(mul_tasks, 5, next_scratch_ptr);
+	if(neg_flag)
+	{
+		Limbs_Twos_Neg(val_neg1_ptr, coeff_len);
+	}
+
+	/* temp = (v1 - v-1) / 2, val_neg1 = (v1 + v-1) / 2 - c0 - c4 = c2 */
+	Limbs_Sub_N(temp_ptr, val_pos1_ptr, val_neg1_ptr, coeff_len);
+	Limbs_Twos_Divexact_1(temp_ptr, coeff_len, 2);
+	Limbs_Sub_N(val_neg1_ptr, val_pos1_ptr, temp_ptr, coeff_len);
+	Limbs_Sub(val_neg1_ptr, val_neg1_ptr, coeff_len, result_ptr, 2 * part_len);
+	Limbs_Sub(val_neg1_ptr, val_neg1_ptr, coeff_len, val_inf_ptr, 2 * last_part_len);
+	/* val_pos2 = c3, temp = c1 */
+	Limbs_Sub(val_pos2_ptr, val_pos2_ptr, coeff_len, result_ptr, 2 * part_len);
+	Limbs_Twos_Submul_1(val_pos2_ptr, coeff_len, val_neg1_ptr, coeff_len, 4);
+	Limbs_Twos_Submul_1(val_pos2_ptr, coeff_len, val_inf_ptr, 2 * last_part_len, 16);
+	Limbs_Twos_Divexact_1(val_pos2_ptr, coeff_len, 2);
+	Limbs_Sub_N(val_pos2_ptr, val_pos2_ptr, temp_ptr, coeff_len);
+	Limbs_Twos_Divexact_1(val_pos2_ptr, coeff_len, 3);
+	Limbs_Sub_N(temp_ptr, temp_ptr, val_pos2_ptr, coeff_len);
+
+	memset(result_ptr + 2 * part_len, 0, 2 * part_len * sizeof(big_num_limb_t));
+	Limbs_Toom_Add_Coeff(result_ptr + part_len, 2 * num_limbs - part_len, temp_ptr, coeff_len);
+	Limbs_Toom_Add_Coeff(result_ptr + 2 * part_len, 2 * num_limbs - 2 * part_len, val_neg1_ptr, coeff_len);
+	Limbs_Toom_Add_Coeff(result_ptr + 3 * part_len, 2 * num_limbs - 3 * part_len, val_pos2_ptr, coeff_len);
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Mul_Toom4
+
+DESCRIPTION    : Toom-4 multiplication of limbs1 and limbs2, where both have num_limbs
+
+INPUT          :
+
+OUTPUT         : result has (2 * num_limbs) limbs
+
+NOTE           : limbs1 and limbs2 are split into 4 parts of part_len limbs, as polynomials of degree 3 in B^part_len.
+                 Their product polynomial of degree 6 is found from its values at 0, 1, -1, 2, -2, 3 and infinity:
+                 with O1 = (v1 - v-1) / 2, O2 = (v2 - v-2) / 4, S1 = (v1 + v-1) / 2 - c0 - c6, S2 = (v2 + v-2) / 2 - c0 - 64 * c6,
+                 c4 = (S2 / 4 - S1) / 3, c2 = S1 - c4, D1 = (O2 - O1) / 3,
+                 c5 = (((v3 - c0 - 9 * c2 - 81 * c4 - 729 * c6) / 3 - O1) / 8 - D1) / 5, c3 = D1 - 5 * c5, c1 = O1 - c3 - c5.
+                 Interpolation is done in two's complement of (2 * part_len + 2) limbs, as its intermediate values can be negative.
+
+Func ID        : 03.32
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Limbs_Mul_Toom4(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs1_ptr, const big_num_limb_t *const limbs2_ptr, const size_t num_limbs, big_num_limb_t *const scratch_ptr)
+{
+	size_t part_len = (num_limbs + 3) / 4, last_part_len = num_limbs - 3 * part_len, eval_len = part_len + 1, coeff_len = 2 * part_len + 2;
+	big_num_limb_t *eval1_pos1_ptr = scratch_ptr, *eval1_neg1_ptr = eval1_pos1_ptr + eval_len, *eval1_pos2_ptr = eval1_neg1_ptr + eval_len;
+	big_num_limb_t *eval1_neg2_ptr = eval1_pos2_ptr + eval_len, *eval1_pos3_ptr = eval1_neg2_ptr + eval_len;
+	big_num_limb_t *eval2_pos1_ptr = eval1_pos3_ptr + eval_len, *eval2_neg1_ptr = eval2_pos1_ptr + eval_len, *eval2_pos2_ptr = eval2_neg1_ptr + eval_len;
+	big_num_limb_t *eval2_neg2_ptr = eval2_pos2_ptr + eval_len, *eval2_pos3_ptr = eval2_neg2_ptr + eval_len;
+	big_num_limb_t *val_pos1_ptr = eval2_pos3_ptr + eval_len, *val_neg1_ptr = val_pos1_ptr + coeff_len, *val_pos2_ptr = val_neg1_ptr + coeff_len;
+	big_num_limb_t *val_neg2_ptr = val_pos2_ptr + coeff_len, *val_pos3_ptr = val_neg2_ptr + coeff_len;
+	big_num_limb_t *temp_ptr = val_pos3_ptr + coeff_len, *next_scratch_ptr = temp_ptr + coeff_len;
+	big_num_limb_t *const val_inf_ptr = result_ptr + 6 * part_len;
+	limbs_mul_task_t mul_tasks[7] =
+	{
+		{val_pos1_ptr, eval1_pos1_ptr, eval2_pos1_ptr, eval_len, NULL_DATA_PTR}, {val_neg1_ptr, eval1_neg1_ptr, eval2_neg1_ptr, eval_len, NULL_DATA_PTR},
+		{val_pos2_ptr, eval1_pos2_ptr, eval2_pos2_ptr, eval_len, NULL_DATA_PTR}, {val_neg2_ptr, eval1_neg2_ptr, eval2_neg2_ptr, eval_len, NULL_DATA_PTR},
+		{val_pos3_ptr, eval1_pos3_ptr, eval2_pos3_ptr, eval_len, NULL_DATA_PTR}, {result_ptr, limbs1_ptr, limbs2_ptr, part_len, NULL_DATA_PTR},
+		{val_inf_ptr, limbs1_ptr + 3 * part_len, limbs2_ptr + 3 * part_len, last_part_len, NULL_DATA_PTR}
+	};
+	uint8_t neg1_flag, neg2_flag;
+
+	neg1_flag = Limbs_Toom_Eval_Pm(eval1_pos1_ptr, eval1_neg1_ptr, temp_ptr, limbs1_ptr, part_len, last_part_len, 4, 1);
+	neg1_flag ^= Limbs_Toom_Eval_Pm(eval2_pos1_ptr, eval2_neg1_ptr, temp_ptr, limbs2_ptr, part_len, last_part_len, 4, 1);
+	neg2_flag = Limbs_Toom_Eval_Pm(eval1_pos2_ptr, eval1_neg2_ptr, temp_ptr, limbs1_ptr, part_len, last_part_len, 4, 2);
+	neg2_flag ^= Limbs_Toom_Eval_Pm(eval2_pos2_ptr, eval2_neg2_ptr, temp_ptr, limbs2_ptr, part_len, last_part_len, 4, 2);
+	/* value at 3 = even parts at 9 + 3 * odd parts at 9 */
+	Limbs_Toom_Eval(eval1_pos3_ptr, limbs1_ptr, part_len, last_part_len, 4, 0, 9);
+	Limbs_Toom_Eval(temp_ptr, limbs1_ptr, part_len, last_part_len, 4, 1, 9);
+	Limbs_Addmul_1(eval1_pos3_ptr, temp_ptr, eval_len, 3);
+	Limbs_Toom_Eval(eval2_pos3_ptr, limbs2_ptr, part_len, last_part_len, 4, 0, 9);
+	Limbs_Toom_Eval(temp_ptr, limbs2_ptr, part_len, last_part_len, 4, 1, 9);
+	Limbs_Addmul_1(eval2_pos3_ptr, temp_ptr, eval_len, 3);
+
+	Limbs_Mul_N_Tasks(mul_tasks, 7, next_scratch_ptr);
+	if(neg1_flag)
+	{
+		Limbs_Twos_Neg(val_neg1_ptr, coeff_len);
+	}
+	if(neg2_flag)
+	{
+		Limbs_Twos_Neg(val_neg2_ptr, coeff_len);
+	}
+
+	/* temp = O1, val_neg1 = S1, val_neg2 = O2, val_pos2 = S2 */
+	Limbs_Sub_N(temp_ptr, val_pos1_ptr, val_neg1_ptr, coeff_len);
+	Limbs_Twos_Divexact_1(temp_ptr, coeff_len, 2);
+	Limbs_Sub_N(val_neg1_ptr, val_pos1_ptr, temp_ptr, coeff_len);
+	Limbs_Sub(val_neg1_ptr, val_neg1_ptr, coeff_len, result_ptr, 2 * part_len);
+	Limbs_Sub(val_neg1_ptr, val_neg1_ptr, coeff_len, val_inf_ptr, 2 * last_part_len);
+	Limbs_Sub_N(val_neg2_ptr, val_pos2_ptr, val_neg2_ptr, coeff_len);
+	Limbs_Twos_Divexact_1(val_neg2_ptr, coeff_len, 4);
+	Limbs_Twos_Submul_1(val_pos2_ptr, coeff_len, val_neg2_ptr, coeff_len, 2);
+	Limbs_Sub(val_pos2_ptr, val_pos2_ptr, coeff_len, result_ptr, 2 * part_len);
+	Limbs_Twos_Submul_1(val_pos2_ptr, coeff_len, val_inf_ptr, 2 * last_part_len, 64);
+	/* val_pos2 = c4, val_neg1 = c2 */
+	Limbs_Twos_Divexact_1(val_pos2_ptr, coeff_len, 4);
+	Limbs_Sub_N(val_pos2_ptr, val_pos2_ptr, val_neg1_ptr, coeff_len);
+	Limbs_Twos_Divexact_1(val_pos2_ptr, coeff_len, 3);
+	Limbs_Sub_N(val_neg1_ptr, val_neg1_ptr, val_pos2_ptr, coeff_len);
+	/* val_neg2 = D1, val_pos3 = c5 */
+	Limbs_Sub(val_pos3_ptr, val_pos3_ptr, coeff_len, result_ptr, 2 * part_len);
+	Limbs_Twos_Submul_1(val_pos3_ptr, coeff_len, val_neg1_ptr, coeff_len, 9);
+	Limbs_Twos_Submul_1(val_pos3_ptr, coeff_len, val_pos2_ptr, coeff_len, 81);
+	Limbs_Twos_Submul_1(val_pos3_ptr, coeff_len, val_inf_ptr, 2 * last_part_len, 729);
+	Limbs_Twos_Divexact_1(val_pos3_ptr, coeff_len, 3);
+	Limbs_Sub_N(val_pos3_ptr, val_pos3_ptr, temp_ptr, coeff_len);
+	Limbs_Twos_Divexact_1(val_pos3_ptr, coeff_len, 8);
+	Limbs_Sub_N(val_neg2_ptr, val_neg2_ptr, temp_ptr, coeff_len);
+	Limbs_Twos_Divexact_1(val_neg2_ptr, coeff_len, 3);
+	Limbs_Sub_N(val_pos3_ptr, val_pos3_ptr, val_neg2_ptr, coeff_len);
+	Limbs_Twos_Divexact_1(val_pos3_ptr, coeff_len, 5);
+	/* val_neg2 = c3, temp = c1 */
+	Limbs_Twos_Submul_1(val_neg2_ptr, coeff_len, val_pos3_ptr, coeff_len, 5);
+	Limbs_Sub_N(temp_ptr, temp_ptr, val_neg2_ptr, coeff_len);
+	Limbs_Sub_N(temp_ptr, temp_ptr, val_pos3_ptr, coeff_len);
+
+	memset(result_ptr + 2 * part_len, 0, 4 * part_len * sizeof(big_num_limb_t));
+	Limbs_Toom_Add_Coeff(result_ptr + part_len, 2 * num_limbs - part_len, temp_ptr, coeff_len);
+	Limbs_Toom_Add_Coeff(result_ptr + 2 * part_len, 2 * num_limbs - 2 * part_len, val_neg1_ptr, coeff_len);
+	Limbs_Toom_Add_Coeff(result_ptr + 3 * part_len, 2 * num_limbs - 3 * part_len, val_neg2_ptr, coeff_len);
+	Limbs_Toom_Add_Coeff(result_ptr + 4 * part_len, 2 * num_limbs - 4 * part_len, val_pos2_ptr, coeff_len);
+	Limbs_Toom_Add_Coeff(result_ptr + 5 * part_len, 2 * num_limbs - 5 * part_len, val_pos3_ptr, coeff_len);
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Par_Num_Tasks
+
+DESCRIPTION    : num of parallel tasks, into which num_items are split, so that each task has atleast min_items
+
+INPUT          :
+
+OUTPUT         : returns num of tasks from 1 to num of threads of multiplication
+
+NOTE           : returns 1 within a task of Par_Run() or Big_Nums_Batch_Parallel(), as its threads are already busy.
+
+Func ID        : 03.64
+
+BUGS           :
+-*------------------------------------------------------------*/
+size_t Par_Num_Tasks(const size_t num_items, const size_t min_items)
+{
+	size_t num_threads = (mul_num_threads == 0) ? Num_Online_Cpus() : mul_num_threads, num_tasks;
+
+	if(par_nested_state == STATE_YES || num_threads <= 1)
+	{
+		return 1;
+	}
+	if(num_threads > PAR_MAX_THREADS)
+	{
+		num_threads = PAR_MAX_THREADS;
+	}
+	num_tasks = num_items / ((min_items != 0) ? min_items : 1);
+	if(num_tasks > num_threads)
+	{
+		return num_threads;
+	}
+	return (num_tasks != 0) ? num_tasks : 1;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Par_Run
+
+DESCRIPTION    : runs task_func for task index 0 to (num_tasks - 1), by upto num_tasks threads
+
+INPUT          : tasks must write disjoint memory
+
+OUTPUT         :
+
+NOTE           : calling thread runs tasks with atmost (num_tasks - 1) threads created for this run, and returns after all
+                 tasks are done. If a thread is not created, its tasks are done by other threads. Without pthreads, or
+                 within a task, tasks are run in order by calling thread.
+
+Func ID        : 03.65
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Par_Run(void (*const task_func)(void *const task_ctx_ptr, const size_t task_index), void *const task_ctx_ptr, const size_t num_tasks)
+{
+	size_t task_index;
+	#ifdef BIG_NUM_PTHREADS
+	pthread_t threads[PAR_MAX_THREADS];
+	par_run_t par_run;
+	size_t num_threads;
+
+	if(num_tasks > 1 && par_nested_state == STATE_NO)
+	{
+		par_run.task_func = task_func;
+		par_run.task_ctx_ptr = task_ctx_ptr;
+		par_run.num_tasks = num_tasks;
+		par_run.next_task = 0;
+		pthread_mutex_init(&par_run.task_mutex, NULL_DATA_PTR);
+		for(num_threads = 0; num_threads + 1 < num_tasks && num_threads < PAR_MAX_THREADS; ++num_threads)
+		{
+			if((pthread_create(&threads[num_threads], NULL_DATA_PTR, Par_Thread, &par_run)) != 0)
+			{
+				break;
+			}
+		}
+		par_nested_state = STATE_YES;
+		Par_Run_Tasks(&par_run);
+		par_nested_state = STATE_NO;
+		while(num_threads > 0)
+		{
+			pthread_join(threads[--num_threads], NULL_DATA_PTR);
+		}
+		pthread_mutex_destroy(&par_run.task_mutex);
+		return;
+	}
+	#endif
+	for(task_index = 0; task_index < num_tasks; ++task_index)
+	{
+		task_func(task_ctx_ptr, task_index);
+	}
+}
+
+#ifdef BIG_NUM_PTHREADS
+/*------------------------------------------------------------*
+FUNCTION NAME  : Par_Run_Tasks
+
+DESCRIPTION    : takes next task of parallel run and does it, till no task is left
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           :
+
+Func ID        : 03.66
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Par_Run_Tasks(par_run_t *const par_run_ptr)
+{
+	size_t task_index;
+
+	while(1)
+	{
+		pthread_mutex_lock(&par_run_ptr->task_mutex);
+		task_index = par_run_ptr->next_task;
+		if(task_index < par_run_ptr->num_tasks)
+		{
+			++par_run_ptr->next_task;
+		}
+		pthread_mutex_unlock(&par_run_ptr->task_mutex);
+		if(task_index >= par_run_ptr->num_tasks)
+		{
+			return;
+		}
+		par_run_ptr->task_func(par_run_ptr->task_ctx_ptr, task_index);
+	}
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Par_Thread
+
+DESCRIPTION    : thread of Par_Run(), which does tasks of parallel run
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           : tasks of thread are not split further. Thread frees its scratch arena before exit.
+
+Func ID        : 03.67
+
+BUGS           :
+-*------------------------------------------------------------*/
+void *Par_Thread(void *const par_run_ptr)
+{
+	par_nested_state = STATE_YES;
+	Par_Run_Tasks((par_run_t *)par_run_ptr);
+	Big_Num_Scratch_Release();
+	return NULL_DATA_PTR;
+}
+#endif
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Mul_N_Tasks
+
+DESCRIPTION    : does num_limbs x num_limbs sub products of Toom multiplication
+
+INPUT          : num_limbs of first task is largest, and scratch_ptr has Limbs_Mul_N_Scratch_Size() of it
+
+OUTPUT         :
+
+NOTE           : from PAR_MUL_MIN_LIMBS limbs, sub products are done in parallel, each with its own scratch of scratch arena.
+                 Otherwise, or if that scratch is not allocated, they are done in order with scratch_ptr.
+
+Func ID        : 03.68
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Limbs_Mul_N_Tasks(limbs_mul_task_t *const tasks_ptr, const size_t num_tasks, big_num_limb_t *const scratch_ptr)
+{
+	big_num_limb_t *tasks_scratch_ptr;
+	size_t scratch_size, task_index;
+
+	if(tasks_ptr[0].num_limbs >= PAR_MUL_MIN_LIMBS && Par_Num_Tasks(num_tasks, 1) > 1)
+	{
+		scratch_size = Limbs_Mul_N_Scratch_Size(tasks_ptr[0].num_limbs);
+		if((tasks_scratch_ptr = Scratch_Alloc(num_tasks * scratch_size)) != NULL_DATA_PTR)
+		{
+			for(task_index = 0; task_index < num_tasks; ++task_index)
+			{
+				tasks_ptr[task_index].scratch_ptr = tasks_scratch_ptr + task_index * scratch_size;
+			}
+			Par_Run(Limbs_Mul_N_Task, tasks_ptr, num_tasks);
+			Scratch_Free(tasks_scratch_ptr);
+			return;
+		}
+	}
+	for(task_index = 0; task_index < num_tasks; ++task_index)
+	{
+		tasks_ptr[task_index].scratch_ptr = scratch_ptr;
+		Limbs_Mul_N_Task(tasks_ptr, task_index);
+	}
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Mul_N_Task
+
+DESCRIPTION    : does sub product of task_index
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           :
+
+Func ID        : 03.69
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Limbs_Mul_N_Task(void *const tasks_ptr, const size_t task_index)
+{
+	const limbs_mul_task_t *const task_ptr = (limbs_mul_task_t *)tasks_ptr + task_index;
+
+	Limbs_Mul_N(task_ptr->result_ptr, task_ptr->limbs1_ptr, task_ptr->limbs2_ptr, task_ptr->num_limbs, task_ptr->scratch_ptr);
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Mul_Chunks_Par
+
+DESCRIPTION    : result = chunks of limbs1 * limbs2, for all full chunks of num_limbs2 limbs of limbs1, in parallel
+
+INPUT          : num_limbs1 >= num_limbs2, karatsuba_threshold <= num_limbs2 < ntt_threshold
+
+OUTPUT         : returns STATE_YES, if done, and then result has ((num_limbs1 / num_limbs2 + 1) * num_limbs2) limbs.
+                 Returns STATE_NO, if not done in parallel.
+
+NOTE           : chunk k product is at k * num_limbs2 and has 2 * num_limbs2 limbs, so products of even chunks do not overlap,
+                 and go directly to result, and products of odd chunks go to odd prods, which is then added to result.
+                 Done, only if there are atleast 2 chunks, and product is of atleast PAR_MUL_MIN_LIMBS x PAR_MUL_MIN_LIMBS limbs.
+
+Func ID        : 03.70
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint8_t Limbs_Mul_Chunks_Par(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs1_ptr, const size_t num_limbs1, const big_num_limb_t *const limbs2_ptr,
+   const size_t num_limbs2)
+{
+	limbs_mul_chunks_t mul_chunks;
+	size_t num_chunks = num_limbs1 / num_limbs2, num_tasks;
+
+	if(num_chunks < 2 || num_limbs1 / PAR_MUL_MIN_LIMBS < PAR_MUL_MIN_LIMBS / num_limbs2 || (num_tasks = Par_Num_Tasks(num_chunks, 1)) <= 1)
+	{
+		return STATE_NO;
+	}
+	mul_chunks.result_ptr = result_ptr;
+	mul_chunks.limbs1_ptr = limbs1_ptr;
+	mul_chunks.limbs2_ptr = limbs2_ptr;
+	mul_chunks.num_limbs2 = num_limbs2;
+	mul_chunks.num_chunks = num_chunks;
+	mul_chunks.num_tasks = num_tasks;
+	mul_chunks.scratch_size = Limbs_Mul_N_Scratch_Size(num_limbs2);
+	if((mul_chunks.odd_prods_ptr = Scratch_Alloc((num_chunks + 1) * num_limbs2 + num_tasks * mul_chunks.scratch_size)) == NULL_DATA_PTR)
+	{
+		return STATE_NO;
+	}
+	mul_chunks.scratch_ptr = mul_chunks.odd_prods_ptr + (num_chunks + 1) * num_limbs2;
+	Par_Run(Limbs_Mul_Chunks_Task, &mul_chunks, num_tasks);
+	/* even products end at (num_chunks + 1) chunks, if last chunk is even, else at num_chunks chunks */
+	if(num_chunks % 2 == 0)
+	{
+		memset(result_ptr + num_chunks * num_limbs2, 0, num_limbs2 * sizeof(big_num_limb_t));
+	}
+	Limbs_Add(result_ptr + num_limbs2, result_ptr + num_limbs2, num_chunks * num_limbs2, mul_chunks.odd_prods_ptr + num_limbs2,
+	   ((num_chunks % 2 == 0) ? num_chunks : num_chunks - 1) * num_limbs2);
+	Scratch_Free(mul_chunks.odd_prods_ptr);
+	return STATE_YES;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Mul_Chunks_Task
+
+DESCRIPTION    : does chunk products of task_index, with its own scratch
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           :
+
+Func ID        : 03.71
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Limbs_Mul_Chunks_Task(void *const mul_chunks_ptr, const size_t task_index)
+{
+	const limbs_mul_chunks_t *const chunks_ptr = (limbs_mul_chunks_t *)mul_chunks_ptr;
+	const size_t num_limbs2 = chunks_ptr->num_limbs2, end_chunk = chunks_ptr->num_chunks * (task_index + 1) / chunks_ptr->num_tasks;
+	size_t chunk;
+
+	for(chunk = chunks_ptr->num_chunks * task_index / chunks_ptr->num_tasks; chunk < end_chunk; ++chunk)
+	{
+		Limbs_Mul_N(((chunk % 2 == 0) ? chunks_ptr->result_ptr : chunks_ptr->odd_prods_ptr) + chunk * num_limbs2, chunks_ptr->limbs1_ptr + chunk * num_limbs2,
+		   chunks_ptr->limbs2_ptr, num_limbs2, chunks_ptr->scratch_ptr + task_index * chunks_ptr->scratch_size);
+	}
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limb_Mont_Mul
+
+DESCRIPTION    : Montgomery multiplication, returns limb1 * limb2 * 2 ^ -BIG_NUM_LIMB_BITS mod prime
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           : limb1 * limb2 < prime * 2 ^ BIG_NUM_LIMB_BITS, eg limb1 < 2 ^ BIG_NUM_LIMB_BITS and limb2 < prime, or both < 2 * prime,
+                 as prime < 2 ^ 62. Result is fully reduced. If limb2 is in Montgomery form, result is limb1 * value of limb2,
+                 and if limb1 and limb2 are in Montgomery form, result is in Montgomery form.
+
+Func ID        : 03.33
+
+BUGS           :
+-*------------------------------------------------------------*/
+static inline big_num_limb_t Limb_Mont_Mul(const big_num_limb_t limb1, const big_num_limb_t limb2, const ntt_prime_t *const ntt_prime_ptr)
+{
+	big_num_limb_t low_limb, high_limb, reduce_high_limb, result;
+
+	low_limb = Limb_Mul_Full(limb1, limb2, &high_limb);
+	Limb_Mul_Full(low_limb * ntt_prime_ptr->neg_inverse, ntt_prime_ptr->prime, &reduce_high_limb);
+	/* low limb of (product + (low limb * neg_inverse) * prime) is 0, with carry out, if low limb of product is not 0 */
+	result = high_limb + reduce_high_limb + (low_limb != 0) - ntt_prime_ptr->prime;
+	/* adds back prime, if result is negative, without branch */
+	return result + (ntt_prime_ptr->prime & (0 - (result >> (BIG_NUM_LIMB_BITS - 1))));
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limb_Shoup_Mul
+
+DESCRIPTION    : returns limb * root mod prime, in range [0, 2 * prime)
+
+INPUT          : root < prime < 2 ^ 62, root_quot = floor(root * 2 ^ BIG_NUM_LIMB_BITS / prime)
+
+OUTPUT         :
+
+NOTE           : Shoup's multiplication by constant with precomputed quotient. Quotient estimate from high limb of limb * root_quot
+                 is atmost one less than exact quotient, so low limbs of products give result without any correction.
+
+Func ID        : 03.34
+
+BUGS           :
+-*------------------------------------------------------------*/
+static inline big_num_limb_t Limb_Shoup_Mul(const big_num_limb_t limb, const big_num_limb_t root, const big_num_limb_t root_quot, const big_num_limb_t prime)
+{
+	big_num_limb_t quot;
+
+	Limb_Mul_Full(limb, root_quot, &quot);
+	return limb * root - quot * prime;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limb_Mod_Add
+
+DESCRIPTION    : returns (limb1 + limb2) mod modulus
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           : limb1, limb2 < modulus < 2 ^ 63. Without branch, as NTT butterflies take either path at random
+
+Func ID        : 03.35
+
+BUGS           :
+-*------------------------------------------------------------*/
+static inline big_num_limb_t Limb_Mod_Add(const big_num_limb_t limb1, const big_num_limb_t limb2, const big_num_limb_t modulus)
+{
+	big_num_limb_t sum = limb1 + limb2 - modulus;
+
+	return sum + (modulus & (0 - (sum >> (BIG_NUM_LIMB_BITS - 1))));
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limb_Mod_Sub
+
+DESCRIPTION    : returns (limb1 - limb2) mod modulus
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           : limb1, limb2 < modulus < 2 ^ 63. Without branch, as of Limb_Mod_Add()
+
+Func ID        : 03.36
+
+BUGS           :
+-*------------------------------------------------------------*/
+static inline big_num_limb_t Limb_Mod_Sub(const big_num_limb_t limb1, const big_num_limb_t limb2, const big_num_limb_t modulus)
+{
+	big_num_limb_t diff = limb1 - limb2;
+
+	return diff + (modulus & (0 - (diff >> (BIG_NUM_LIMB_BITS - 1))));
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Ntt_Init_Prime
+
+DESCRIPTION    : sets NTT prime and its constants of Montgomery multiplication
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           :
+
+Func ID        : 03.37
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Ntt_Init_Prime(ntt_prime_t *const ntt_prime_ptr, const big_num_limb_t prime, const big_num_limb_t generator)
+{
+	big_num_limb_t inverse;
+	unsigned int bit_pos;
+
+	ntt_prime_ptr->prime = prime;
+	ntt_prime_ptr->generator = generator;
+	/* Newton iteration doubles num of correct low bits of inverse, from 5 bits of (3 * prime) ^ 2 */
+	inverse = (3 * prime) ^ 2;
+	inverse *= 2 - prime * inverse;
+	inverse *= 2 - prime * inverse;
+	inverse *= 2 - prime * inverse;
+	inverse *= 2 - prime * inverse;
+	ntt_prime_ptr->neg_inverse = 0 - inverse;
+	ntt_prime_ptr->mont_one = (BIG_NUM_LIMB_MAX % prime + 1) % prime;
+	ntt_prime_ptr->mont_r2 = ntt_prime_ptr->mont_one;
+	for(bit_pos = 0; bit_pos < BIG_NUM_LIMB_BITS; ++bit_pos)
+	{
+		ntt_prime_ptr->mont_r2 = Limb_Mod_Add(ntt_prime_ptr->mont_r2, ntt_prime_ptr->mont_r2, prime);
+	}
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Ntt_Pow_Mod
+
+DESCRIPTION    : returns mont_base ^ exponent mod prime, in Montgomery form
+
+INPUT          : mont_base is in Montgomery form
+
+OUTPUT         :
+
+NOTE           : binary exponentiation, from least significant bit of exponent
+
+Func ID        : 03.38
+
+BUGS           :
+-*------------------------------------------------------------*/
+big_num_limb_t Ntt_Pow_Mod(const big_num_limb_t mont_base, big_num_limb_t exponent, const ntt_prime_t *const ntt_prime_ptr)
+{
+	big_num_limb_t result = ntt_prime_ptr->mont_one, square = mont_base;
+
+	while(exponent != 0)
+	{
+		if(exponent & 1)
+		{
+			result = Limb_Mont_Mul(result, square, ntt_prime_ptr);
+		}
+		square = Limb_Mont_Mul(square, square, ntt_prime_ptr);
+		exponent >>= 1;
+	}
+	return result;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Ntt_Forward_Level
+
+DESCRIPTION    : one level of forward NTT butterflies, from first_butterfly to end_butterfly of blocks of block_len
+
+INPUT          : root_step = transform_len / block_len. Butterfly k is of coeff (k mod (block_len / 2)) of block (k / (block_len / 2)).
+                 coeffs are in range [0, 2 * prime)
+
+OUTPUT         : coeffs are in range [0, 2 * prime)
+
+NOTE           : butterfly is (x + y, (x - y) * w), with lazy reduction modulo 2 * prime. Root of first coeff of block is 1.
+                 A range of butterflies, that starts or ends within a block, lets threads share a level of few large blocks.
+
+Func ID        : 03.39
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Ntt_Forward_Level(big_num_limb_t *const coeffs_ptr, const size_t block_len, const big_num_limb_t *const roots_ptr, const size_t root_step,
+   const big_num_limb_t prime, const size_t first_butterfly, const size_t end_butterfly)
+{
+	const big_num_limb_t twice_prime = 2 * prime;
+	const size_t half_len = block_len / 2;
+	const big_num_limb_t *root_ptr;
+	big_num_limb_t *block_ptr, coeff1, coeff2;
+	size_t butterfly, next_butterfly, coeff_pos, end_coeff_pos;
+
+	for(butterfly = first_butterfly; butterfly < end_butterfly; butterfly = next_butterfly)
+	{
+		coeff_pos = butterfly & (half_len - 1);
+		block_ptr = coeffs_ptr + 2 * (butterfly - coeff_pos);
+		end_coeff_pos = (end_butterfly - butterfly < half_len - coeff_pos) ? coeff_pos + (end_butterfly - butterfly) : half_len;
+		next_butterfly = butterfly + (end_coeff_pos - coeff_pos);
+		if(coeff_pos == 0)
+		{
+			coeff1 = block_ptr[0];
+			coeff2 = block_ptr[half_len];
+			block_ptr[0] = Limb_Mod_Add(coeff1, coeff2, twice_prime);
+			block_ptr[half_len] = Limb_Mod_Sub(coeff1, coeff2, twice_prime);
+			++coeff_pos;
+		}
+		for(root_ptr = roots_ptr + 2 * root_step * coeff_pos; coeff_pos < end_coeff_pos; ++coeff_pos, root_ptr += 2 * root_step)
+		{
+			coeff1 = block_ptr[coeff_pos];
+			coeff2 = block_ptr[coeff_pos + half_len];
+			block_ptr[coeff_pos] = Limb_Mod_Add(coeff1, coeff2, twice_prime);
+			block_ptr[coeff_pos + half_len] = Limb_Shoup_Mul(coeff1 - coeff2 + twice_prime, root_ptr[0], root_ptr[1], prime);
+		}
+	}
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Ntt_Inverse_Level
+
+DESCRIPTION    : one level of inverse NTT butterflies, from first_butterfly to end_butterfly of blocks of block_len
+
+INPUT          : root_step = transform_len / block_len. Butterflies are numbered as of Ntt_Forward_Level().
+                 coeffs are in range [0, 2 * prime)
+
+OUTPUT         : coeffs are in range [0, 2 * prime)
+
+NOTE           : butterfly is (x + y * w ^ -1, x - y * w ^ -1), with lazy reduction modulo 2 * prime.
+                 As w ^ (transform_len / 2) = -1, inverse root w ^ -k is taken as -w ^ (transform_len / 2 - k), and its sign is
+                 applied by exchanging add and subtract of butterfly.
+
+Func ID        : 03.40
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Ntt_Inverse_Level(big_num_limb_t *const coeffs_ptr, const size_t block_len, const big_num_limb_t *const roots_ptr, const size_t root_step,
+   const size_t transform_len, const big_num_limb_t prime, const size_t first_butterfly, const size_t end_butterfly)
+{
+	const big_num_limb_t twice_prime = 2 * prime;
+	const size_t half_len = block_len / 2;
+	const big_num_limb_t *root_ptr;
+	big_num_limb_t *block_ptr, coeff1, coeff2;
+	size_t butterfly, next_butterfly, coeff_pos, end_coeff_pos;
+
+	for(butterfly = first_butterfly; butterfly < end_butterfly; butterfly = next_butterfly)
+	{
+		coeff_pos = butterfly & (half_len - 1);
+		block_ptr = coeffs_ptr + 2 * (butterfly - coeff_pos);
+		end_coeff_pos = (end_butterfly - butterfly < half_len - coeff_pos) ? coeff_pos + (end_butterfly - butterfly) : half_len;
+		next_butterfly = butterfly + (end_coeff_pos - coeff_pos);
+		if(coeff_pos == 0)
+		{
+			coeff1 = block_ptr[0];
+			coeff2 = block_ptr[half_len];
+			block_ptr[0] = Limb_Mod_Add(coeff1, coeff2, twice_prime);
+			block_ptr[half_len] = Limb_Mod_Sub(coeff1, coeff2, twice_prime);
+			++coeff_pos;
+		}
+		for(root_ptr = roots_ptr + transform_len - 2 * root_step * coeff_pos; coeff_pos < end_coeff_pos; ++coeff_pos, root_ptr -= 2 * root_step)
+		{
+			coeff1 = block_ptr[coeff_pos];
+			coeff2 = Limb_Shoup_Mul(block_ptr[coeff_pos + half_len], root_ptr[0], root_ptr[1], prime);
+			block_ptr[coeff_pos] = Limb_Mod_Sub(coeff1, coeff2, twice_prime);
+			block_ptr[coeff_pos + half_len] = Limb_Mod_Add(coeff1, coeff2, twice_prime);
+		}
+	}
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Ntt_Forward
+
+DESCRIPTION    : forward NTT of coeffs of ntt par modulo its NTT prime, with decimation in frequency
+
+INPUT          : roots_ptr has (transform_len / 2) pairs of w ^ k and its Shoup quotient, where w is primitive transform_len th root of unity.
+                 coeffs are in range [0, 2 * prime)
+
+OUTPUT         : transformed coeffs are in bit reversed order, in range [0, 2 * prime)
+
+NOTE           : transform_len is power of 2. As Ntt_Inverse() takes bit reversed order, no bit reversal permutation is needed.
+                 Levels of blocks larger than NTT_CACHE_BLOCK_LEN are done on all coeffs, and then all smaller levels are done
+                 on one cache block at a time. Each level of all coeffs, and cache blocks, are split into parallel tasks.
+
+Func ID        : 03.41
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Ntt_Forward(ntt_par_t *const ntt_par_ptr)
+{
+	const size_t transform_len = ntt_par_ptr->transform_len;
+	size_t block_len;
+
+	for(block_len = transform_len; block_len > NTT_CACHE_BLOCK_LEN; block_len >>= 1)
+	{
+		ntt_par_ptr->block_len = block_len;
+		Ntt_Par_Stage(ntt_par_ptr, NTT_STAGE_FORWARD_LEVEL, transform_len / 2, PAR_MIN_GRAIN);
+	}
+	ntt_par_ptr->block_len = block_len;
+	Ntt_Par_Stage(ntt_par_ptr, NTT_STAGE_FORWARD_BLOCKS, transform_len / block_len, (PAR_MIN_GRAIN + block_len - 1) / block_len);
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Ntt_Inverse
+
+DESCRIPTION    : inverse NTT of coeffs of ntt par modulo its NTT prime, with decimation in time
+
+INPUT          : coeffs are in bit reversed order, in range [0, 2 * prime). roots_ptr is same as of Ntt_Forward()
+
+OUTPUT         : coeffs are in natural order, in range [0, 2 * prime), and are not divided by transform_len
+
+NOTE           : levels upto NTT_CACHE_BLOCK_LEN are done on one cache block at a time, and then larger levels on all coeffs.
+
+Func ID        : 03.42
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Ntt_Inverse(ntt_par_t *const ntt_par_ptr)
+{
+	const size_t transform_len = ntt_par_ptr->transform_len;
+	size_t block_len, cache_block_len;
+
+	cache_block_len = (transform_len < NTT_CACHE_BLOCK_LEN) ? transform_len : NTT_CACHE_BLOCK_LEN;
+	ntt_par_ptr->block_len = cache_block_len;
+	Ntt_Par_Stage(ntt_par_ptr, NTT_STAGE_INVERSE_BLOCKS, transform_len / cache_block_len, (PAR_MIN_GRAIN + cache_block_len - 1) / cache_block_len);
+	for(block_len = cache_block_len * 2; block_len <= transform_len; block_len <<= 1)
+	{
+		ntt_par_ptr->block_len = block_len;
+		Ntt_Par_Stage(ntt_par_ptr, NTT_STAGE_INVERSE_LEVEL, transform_len / 2, PAR_MIN_GRAIN);
+	}
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Ntt_Par_Stage
+
+DESCRIPTION    : does stage of NTT multiplication on num_items, split into parallel tasks of atleast min_items
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           : items are split equally in order of task index, so that split depends only on num of tasks, and each
+                 task writes only its own items.
+
+Func ID        : 03.72
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Ntt_Par_Stage(ntt_par_t *const ntt_par_ptr, const uint8_t stage, const size_t num_items, const size_t min_items)
+{
+	ntt_par_ptr->stage = stage;
+	ntt_par_ptr->num_items = num_items;
+	ntt_par_ptr->num_tasks = Par_Num_Tasks(num_items, min_items);
+	Par_Run(Ntt_Par_Task, ntt_par_ptr, ntt_par_ptr->num_tasks);
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Ntt_Par_Task
+
+DESCRIPTION    : does stage of NTT multiplication on items of task_index
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           : roots from item k start at w ^ k, found by Ntt_Pow_Mod(), so that each task needs no previous root.
+                 CRT task starts with 0 carry, and its carry out is added to first coeff of next task by Limbs_Mul_Ntt().
+
+Func ID        : 03.73
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Ntt_Par_Task(void *const ntt_par_ptr, const size_t task_index)
+{
+	ntt_par_t *const par_ptr = (ntt_par_t *)ntt_par_ptr;
+	const ntt_prime_t *const ntt_prime_ptr = par_ptr->ntt_prime_ptr, *const ntt_primes = par_ptr->ntt_primes_ptr;
+	const size_t first_item = par_ptr->num_items * task_index / par_ptr->num_tasks, end_item = par_ptr->num_items * (task_index + 1) / par_ptr->num_tasks;
+	const size_t transform_len = par_ptr->transform_len, block_len = par_ptr->block_len;
+	big_num_limb_t *const coeffs_ptr = par_ptr->coeffs_ptr, *const roots_ptr = par_ptr->roots_ptr, *const residues_ptr = par_ptr->residues_ptr;
+	big_num_limb_t root, rem, crt_limbs[3], acc_limbs[4], residue1, residue2, residue3;
+	size_t item_pos, level_len, root_step;
+
+	switch(par_ptr->stage)
+	{
+		case NTT_STAGE_ROOTS:
+		   root = (first_item == 0) ? 1 : Limb_Mont_Mul(Ntt_Pow_Mod(par_ptr->root, first_item, ntt_prime_ptr), 1, ntt_prime_ptr);
+		   for(item_pos = first_item; item_pos < end_item; ++item_pos)
+		   {
+			   if(item_pos > first_item)
+			   {
+				   root = Limb_Mont_Mul(root, par_ptr->root, ntt_prime_ptr);
+			   }
+			   roots_ptr[2 * item_pos] = root;
+			   roots_ptr[2 * item_pos + 1] = Limb_Div_2by1(root, 0, ntt_prime_ptr->prime, &rem);
+		   }
+		break;
+		case NTT_STAGE_TO_MONT:
+		   for(item_pos = first_item; item_pos < end_item && item_pos < par_ptr->num_limbs; ++item_pos)
+		   {
+			   coeffs_ptr[item_pos] = Limb_Mont_Mul(par_ptr->limbs_ptr[item_pos], ntt_prime_ptr->mont_r2, ntt_prime_ptr);
+		   }
+		   if(item_pos < end_item)
+		   {
+			   memset(coeffs_ptr + item_pos, 0, (end_item - item_pos) * sizeof(big_num_limb_t));
+		   }
+		break;
+		case NTT_STAGE_FORWARD_LEVEL:
+		   Ntt_Forward_Level(coeffs_ptr, block_len, roots_ptr, transform_len / block_len, ntt_prime_ptr->prime, first_item, end_item);
+		break;
+		case NTT_STAGE_FORWARD_BLOCKS:
+		   for(item_pos = first_item; item_pos < end_item; ++item_pos)
+		   {
+			   for(level_len = block_len, root_step = transform_len / block_len; level_len >= 2; level_len >>= 1, root_step <<= 1)
+			   {
+				   Ntt_Forward_Level(coeffs_ptr + item_pos * block_len, level_len, roots_ptr, root_step, ntt_prime_ptr->prime, 0, block_len / 2);
+			   }
+		   }
+		break;
+		case NTT_STAGE_POINTWISE:
+		   for(item_pos = first_item; item_pos < end_item; ++item_pos)
+		   {
+			   coeffs_ptr[item_pos] = Limb_Mont_Mul(coeffs_ptr[item_pos], par_ptr->coeffs2_ptr[item_pos], ntt_prime_ptr);
+		   }
+		break;
+		case NTT_STAGE_INVERSE_BLOCKS:
+		   for(item_pos = first_item; item_pos < end_item; ++item_pos)
+		   {
+			   for(level_len = 2, root_step = transform_len / 2; level_len <= block_len; level_len <<= 1, root_step >>= 1)
+			   {
+				   Ntt_Inverse_Level(coeffs_ptr + item_pos * block_len, level_len, roots_ptr, root_step, transform_len, ntt_prime_ptr->prime, 0, block_len / 2);
+			   }
+		   }
+		break;
+		case NTT_STAGE_INVERSE_LEVEL:
+		   Ntt_Inverse_Level(coeffs_ptr, block_len, roots_ptr, transform_len / block_len, transform_len, ntt_prime_ptr->prime, first_item, end_item);
+		break;
+		case NTT_STAGE_SCALE:
+		   for(item_pos = first_item; item_pos < end_item; ++item_pos)
+		   {
+			   coeffs_ptr[item_pos] = Limb_Mont_Mul(coeffs_ptr[item_pos], par_ptr->scale, ntt_prime_ptr);
+		   }
+		break;
+		case NTT_STAGE_CRT:
+		   /* Garner's CRT: coeff = r1 + p1 * ((r2 - r1) / p1 mod p2) + p1 * p2 * ((r3 - (r1 + p1 * t2)) / (p1 * p2) mod p3) */
+		   memset(acc_limbs, 0, sizeof(acc_limbs));
+		   for(item_pos = first_item; item_pos < end_item; ++item_pos)
+		   {
+			   residue1 = residues_ptr[item_pos];
+			   residue2 = Limb_Mont_Mul(Limb_Mod_Sub(residues_ptr[transform_len + item_pos], Limb_Mont_Mul(residue1, ntt_primes[1].mont_one, &ntt_primes[1]), ntt_primes[1].prime),
+			      par_ptr->inverse1_mod2, &ntt_primes[1]);
+			   residue3 = Limb_Mod_Add(Limb_Mont_Mul(residue1, ntt_primes[2].mont_one, &ntt_primes[2]), Limb_Mont_Mul(residue2, par_ptr->prime1_mod3, &ntt_primes[2]), ntt_primes[2].prime);
+			   residue3 = Limb_Mont_Mul(Limb_Mod_Sub(residues_ptr[2 * transform_len + item_pos], residue3, ntt_primes[2].prime), par_ptr->inverse12_mod3, &ntt_primes[2]);
+			   crt_limbs[0] = Limb_Mul_Full(ntt_primes[0].prime, residue2, &crt_limbs[1]);
+			   crt_limbs[2] = 0;
+			   Limbs_Add_1(crt_limbs, crt_limbs, 3, residue1);
+			   crt_limbs[2] += Limbs_Addmul_1(crt_limbs, par_ptr->prime12_limbs, 2, residue3);
+			   Limbs_Add(acc_limbs, acc_limbs, 4, crt_limbs, 3);
+			   par_ptr->result_ptr[item_pos] = acc_limbs[0];
+			   acc_limbs[0] = acc_limbs[1];
+			   acc_limbs[1] = acc_limbs[2];
+			   acc_limbs[2] = acc_limbs[3];
+			   acc_limbs[3] = 0;
+		   }
+		   memcpy(&par_ptr->crt_carries[3 * task_index], acc_limbs, 3 * sizeof(big_num_limb_t));
+		break;
+	}
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Mul_Ntt
+
+DESCRIPTION    : result = limbs1 * limbs2, by NTT modulo 3 primes and Chinese remainder theorem (CRT)
+
+INPUT          :
+
+OUTPUT         : result has (num_limbs1 + num_limbs2) limbs
+
+NOTE           : each limb is a coefficient. For each prime, product coefficients are found by forward NTT of both operands,
+                 pointwise multiplication and inverse NTT, and then are combined by Garner's CRT, and carries are propagated.
+                 If limbs2_ptr is same as limbs1_ptr, operand is transformed only once for squaring.
+                 Coeffs are in Montgomery form upto pointwise multiplication, and is removed by scaling with 1 / transform_len.
+                 Roots are in normal form with their Shoup quotients, so that butterflies keep form of coeffs.
+                 Every stage is split into parallel tasks by Ntt_Par_Stage(). As all stages are exact modulo prime, and CRT
+                 carries of tasks are added after, product is same for any num of tasks.
+
+Func ID        : 03.43
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Limbs_Mul_Ntt(big_num_limb_t *const result_ptr, const big_num_limb_t *const limbs1_ptr, const size_t num_limbs1, const big_num_limb_t *const limbs2_ptr, const size_t num_limbs2)
+{
+	ntt_prime_t ntt_primes[NTT_NUM_PRIMES];
+	ntt_par_t ntt_par;
+	big_num_limb_t *residues_ptr, *coeffs_ptr, *coeffs2_ptr = NULL_DATA_PTR, *roots_ptr;
+	const uint8_t square_flag = (limbs1_ptr == limbs2_ptr && num_limbs1 == num_limbs2);
+	size_t num_coeffs = num_limbs1 + num_limbs2 - 1, transform_len = 2, coeff_pos, prime_index, task_index;
+
+	while(transform_len < num_coeffs)
+	{
+		transform_len <<= 1;
+	}
+	if((big_num_limb_t)transform_len > NTT_MAX_TRANSFORM_LEN)
+	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("mul - NTT transform length exceeds max \n");
+		#endif
+		return FAILURE;
+	}
+	residues_ptr = Scratch_Alloc((NTT_NUM_PRIMES + 1) * transform_len);
+	if(residues_ptr == NULL_DATA_PTR || (!square_flag && (coeffs2_ptr = Scratch_Alloc(transform_len)) == NULL_DATA_PTR))
+	{
+		Scratch_Free(residues_ptr);
+		#ifdef TRACE_ERROR
+		   Trace_Error("mul - memory alloc failed \n");
+		#endif
+		return FAILURE;
+	}
+	roots_ptr = residues_ptr + NTT_NUM_PRIMES * transform_len;
+	ntt_par.ntt_primes_ptr = ntt_primes;
+	ntt_par.residues_ptr = residues_ptr;
+	ntt_par.roots_ptr = roots_ptr;
+	ntt_par.result_ptr = result_ptr;
+	ntt_par.transform_len = transform_len;
+	ntt_par.num_coeffs = num_coeffs;
+	for(prime_index = 0; prime_index < NTT_NUM_PRIMES; ++prime_index)
+	{
+		const ntt_prime_t *const ntt_prime_ptr = &ntt_primes[prime_index];
+
+		Ntt_Init_Prime(&ntt_primes[prime_index], ntt_prime_datas[prime_index][0], ntt_prime_datas[prime_index][1]);
+		coeffs_ptr = residues_ptr + prime_index * transform_len;
+		ntt_par.ntt_prime_ptr = ntt_prime_ptr;
+		ntt_par.root = Ntt_Pow_Mod(Limb_Mont_Mul(ntt_prime_ptr->generator, ntt_prime_ptr->mont_r2, ntt_prime_ptr), (ntt_prime_ptr->prime - 1) / transform_len, ntt_prime_ptr);
+		Ntt_Par_Stage(&ntt_par, NTT_STAGE_ROOTS, transform_len / 2, PAR_MIN_GRAIN);
+		ntt_par.coeffs_ptr = coeffs_ptr;
+		ntt_par.limbs_ptr = limbs1_ptr;
+		ntt_par.num_limbs = num_limbs1;
+		Ntt_Par_Stage(&ntt_par, NTT_STAGE_TO_MONT, transform_len, PAR_MIN_GRAIN);
+		Ntt_Forward(&ntt_par);
+		ntt_par.coeffs2_ptr = coeffs_ptr;
+		if(!square_flag)
+		{
+			ntt_par.coeffs_ptr = coeffs2_ptr;
+			ntt_par.limbs_ptr = limbs2_ptr;
+			ntt_par.num_limbs = num_limbs2;
+			Ntt_Par_Stage(&ntt_par, NTT_STAGE_TO_MONT, transform_len, PAR_MIN_GRAIN);
+			Ntt_Forward(&ntt_par);
+			ntt_par.coeffs_ptr = coeffs_ptr;
+			ntt_par.coeffs2_ptr = coeffs2_ptr;
+		}
+		Ntt_Par_Stage(&ntt_par, NTT_STAGE_POINTWISE, transform_len, PAR_MIN_GRAIN);
+		Ntt_Inverse(&ntt_par);
+		/* coeff is (value * transform_len) in Montgomery form, so Montgomery multiplication with 1 / transform_len gives value */
+		ntt_par.scale = Limb_Mont_Mul(Ntt_Pow_Mod(Limb_Mont_Mul(transform_len, ntt_prime_ptr->mont_r2, ntt_prime_ptr), ntt_prime_ptr->prime - 2, ntt_prime_ptr), 1, ntt_prime_ptr);
+		Ntt_Par_Stage(&ntt_par, NTT_STAGE_SCALE, num_coeffs, PAR_MIN_GRAIN);
+	}
+	Scratch_Free(coeffs2_ptr);
+
+	ntt_par.inverse1_mod2 = Ntt_Pow_Mod(Limb_Mont_Mul(ntt_primes[0].prime, ntt_primes[1].mont_r2, &ntt_primes[1]), ntt_primes[1].prime - 2, &ntt_primes[1]);
+	ntt_par.prime1_mod3 = Limb_Mont_Mul(ntt_primes[0].prime, ntt_primes[2].mont_r2, &ntt_primes[2]);
+	ntt_par.inverse12_mod3 = Limb_Mont_Mul(Limb_Mont_Mul(ntt_primes[1].prime, ntt_par.prime1_mod3, &ntt_primes[2]), ntt_primes[2].mont_r2, &ntt_primes[2]);
+	ntt_par.inverse12_mod3 = Ntt_Pow_Mod(ntt_par.inverse12_mod3, ntt_primes[2].prime - 2, &ntt_primes[2]);
+	ntt_par.prime12_limbs[0] = Limb_Mul_Full(ntt_primes[0].prime, ntt_primes[1].prime, &ntt_par.prime12_limbs[1]);
+	Ntt_Par_Stage(&ntt_par, NTT_STAGE_CRT, num_coeffs, PAR_MIN_GRAIN);
+	/* carry out of last task is most significant limb of product, and carry out of each other task is added from first coeff of next task */
+	result_ptr[num_coeffs] = ntt_par.crt_carries[3 * (ntt_par.num_tasks - 1)];
+	for(task_index = 0; task_index + 1 < ntt_par.num_tasks; ++task_index)
+	{
+		coeff_pos = num_coeffs * (task_index + 1) / ntt_par.num_tasks;
+		Limbs_Add(result_ptr + coeff_pos, result_ptr + coeff_pos, num_coeffs + 1 - coeff_pos, &ntt_par.crt_carries[3 * task_index],
+		   (num_coeffs + 1 - coeff_pos < 3) ? num_coeffs + 1 - coeff_pos : 3);
+	}
+	Scratch_Free(residues_ptr);
+	return SUCCESS;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Divmod_1
+
+DESCRIPTION    : quot = limbs / divisor
+
+INPUT          :
+
+OUTPUT         : returns remainder. quot has num_limbs limbs, if quot_ptr is not NULL
+
+NOTE           : quot_ptr can be same as limbs_ptr
+
+Func ID        : 03.19
+
+BUGS           :
+-*------------------------------------------------------------*/
+big_num_limb_t Limbs_Divmod_1(big_num_limb_t *const quot_ptr, const big_num_limb_t *const limbs_ptr, const size_t num_limbs, const big_num_limb_t divisor)
+{
+	big_num_limb_t rem = 0, quot;
+	size_t limb_pos;
+
+	for(limb_pos = num_limbs; limb_pos > 0; --limb_pos)
+	{
+		quot = Limb_Div_2by1(rem, limbs_ptr[limb_pos - 1], divisor, &rem);
+		if(quot_ptr != NULL_DATA_PTR)
+		{
+			quot_ptr[limb_pos - 1] = quot;
+		}
+	}
+	return rem;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Mod_1
+
+DESCRIPTION    : returns limbs % divisor
+
+INPUT          : divisor is not 0
+
+OUTPUT         :
+
+NOTE           : one 128 / 64 bits division per limb, and no quotient is stored. If most significant limb is less than
+                 divisor, it is taken as initial remainder, saving one division.
+
+Func ID        : 03.50
+
+BUGS           :
+-*------------------------------------------------------------*/
+big_num_limb_t Limbs_Mod_1(const big_num_limb_t *const limbs_ptr, const size_t num_limbs, const big_num_limb_t divisor)
+{
+	big_num_limb_t rem = 0;
+	size_t limb_pos = num_limbs;
+
+	if(limb_pos > 0 && limbs_ptr[limb_pos - 1] < divisor)
+	{
+		rem = limbs_ptr[--limb_pos];
+	}
+	for(; limb_pos > 0; --limb_pos)
+	{
+		Limb_Div_2by1(rem, limbs_ptr[limb_pos - 1], divisor, &rem);
+	}
+	return rem;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Mod
+
+DESCRIPTION    : rem = rem % divisor, in place
+
+INPUT          : rem has (num_rem_limbs + 1) limbs of space, num_rem_limbs >= num_divisor_limbs >= 1 and most significant limb of divisor is not 0.
+
+OUTPUT         : rem has num_divisor_limbs limbs.
+
+NOTE           : quotient is not stored. rem is shifted in place, and only a shifted copy of divisor is allocated. Quotient limbs of
+                 a block, as needed by Limbs_Div_Bz() and Limbs_Div_Newton() for correction, are kept in scratch of num_divisor_limbs.
+
+Func ID        : 03.51
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Limbs_Mod(big_num_limb_t *const rem_ptr, const size_t num_rem_limbs, const big_num_limb_t *const divisor_ptr, const size_t num_divisor_limbs)
+{
+	big_num_limb_t *norm_divisor_ptr;
+	const size_t num_quot_limbs = num_rem_limbs - num_divisor_limbs + 1;
+	unsigned int shift_bits;
+	uint16_t ret_status = SUCCESS;
+
+	if(num_divisor_limbs == 1)
+	{
+		rem_ptr[0] = Limbs_Mod_1(rem_ptr, num_rem_limbs, divisor_ptr[0]);
+		return SUCCESS;
+	}
+	shift_bits = Limb_Count_Leading_Zeros(divisor_ptr[num_divisor_limbs - 1]);
+	if(shift_bits == 0)
+	{
+		norm_divisor_ptr = (big_num_limb_t *)divisor_ptr;
+		rem_ptr[num_rem_limbs] = 0;
+	}
+	else
+	{
+		if((norm_divisor_ptr = Scratch_Alloc(num_divisor_limbs)) == NULL_DATA_PTR)
+		{
+			#ifdef TRACE_ERROR
+			   Trace_Error("mod - memory alloc failed \n");
+			#endif
+			return FAILURE;
+		}
+		Limbs_Lshift(norm_divisor_ptr, divisor_ptr, num_divisor_limbs, shift_bits);
+		rem_ptr[num_rem_limbs] = Limbs_Lshift(rem_ptr, rem_ptr, num_rem_limbs, shift_bits);
+	}
+	if(num_divisor_limbs < bz_div_threshold || num_quot_limbs < bz_div_threshold)
+	{
+		Limbs_Div_Knuth(NULL_DATA_PTR, rem_ptr, num_rem_limbs + 1, norm_divisor_ptr, num_divisor_limbs);
+	}
+	else if(num_divisor_limbs < newton_div_threshold || num_quot_limbs < newton_div_threshold)
+	{
+		ret_status = Limbs_Div_Bz(NULL_DATA_PTR, rem_ptr, num_rem_limbs + 1, norm_divisor_ptr, num_divisor_limbs);
+	}
+	else
+	{
+		ret_status = Limbs_Div_Newton(NULL_DATA_PTR, rem_ptr, num_rem_limbs + 1, norm_divisor_ptr, num_divisor_limbs, NULL_DATA_PTR);
+	}
+	if(shift_bits != 0)
+	{
+		Limbs_Rshift(rem_ptr, rem_ptr, num_divisor_limbs, shift_bits);
+		Scratch_Free(norm_divisor_ptr);
+	}
+	return ret_status;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Divrem
+
+DESCRIPTION    : quot = dividend / divisor, rem = dividend % divisor
+
+INPUT          :
+
+OUTPUT         : quot has (num_dividend_limbs - num_divisor_limbs + 1) limbs, if quot_ptr is not NULL.
+                 rem has num_divisor_limbs limbs, if rem_ptr is not NULL.
+
+NOTE           : num_dividend_limbs >= num_divisor_limbs >= 1 and most significant limb of divisor is not 0.
+                 quot and rem must not overlap dividend or divisor. Use Limbs_Mod(), if only rem is required, and dividend can be changed.
+                 Divisor and dividend are shifted, so that most significant bit of divisor is set, as needed by Limbs_Div_Knuth(),
+                 Limbs_Div_Bz() and Limbs_Div_Newton(), which is selected by num of limbs of divisor and quotient.
+                 Normalized copies and scratch of division methods are taken from scratch arena of calling thread.
+                 divisor_inverse_ptr is NULL, or has (num_divisor_limbs + 1) limbs of Limbs_Invert() of normalized divisor, as of
+                 Big_Num_Pow10_Level_Inverse(), so that Limbs_Div_Newton() is used from bz_div_threshold limbs, without inverting divisor.
+
+Func ID        : 03.20
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Limbs_Divrem(big_num_limb_t *const quot_ptr, big_num_limb_t *const rem_ptr, const big_num_limb_t *const dividend_ptr, const size_t num_dividend_limbs,
+   const big_num_limb_t *const divisor_ptr, const size_t num_divisor_limbs, const big_num_limb_t *const divisor_inverse_ptr)
+{
+	big_num_limb_t *norm_dividend_ptr, *norm_divisor_ptr, rem;
+	const size_t num_quot_limbs = num_dividend_limbs - num_divisor_limbs + 1;
+	unsigned int shift_bits;
+	uint16_t ret_status = SUCCESS;
+
+	if(num_divisor_limbs == 1)
+	{
+		rem = Limbs_Divmod_1(quot_ptr, dividend_ptr, num_dividend_limbs, divisor_ptr[0]);
+		if(rem_ptr != NULL_DATA_PTR)
+		{
+			rem_ptr[0] = rem;
+		}
+		return SUCCESS;
+	}
+	norm_dividend_ptr = Scratch_Alloc(num_dividend_limbs + 1 + num_divisor_limbs);
+	if(norm_dividend_ptr == NULL_DATA_PTR)
+	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("divrem - memory alloc failed \n");
+		#endif
+		return FAILURE;
+	}
+	norm_divisor_ptr = norm_dividend_ptr + num_dividend_limbs + 1;
+	shift_bits = Limb_Count_Leading_Zeros(divisor_ptr[num_divisor_limbs - 1]);
+	if(shift_bits == 0)
+	{
+		memcpy(norm_divisor_ptr, divisor_ptr, num_divisor_limbs * sizeof(big_num_limb_t));
+		memcpy(norm_dividend_ptr, dividend_ptr, num_dividend_limbs * sizeof(big_num_limb_t));
+		norm_dividend_ptr[num_dividend_limbs] = 0;
+	}
+	else
+	{
+		Limbs_Lshift(norm_divisor_ptr, divisor_ptr, num_divisor_limbs, shift_bits);
+		norm_dividend_ptr[num_dividend_limbs] = Limbs_Lshift(norm_dividend_ptr, dividend_ptr, num_dividend_limbs, shift_bits);
+	}
+	if(num_divisor_limbs < bz_div_threshold || num_quot_limbs < bz_div_threshold)
+	{
+		Limbs_Div_Knuth(quot_ptr, norm_dividend_ptr, num_dividend_limbs + 1, norm_divisor_ptr, num_divisor_limbs);
+	}
+	else if(divisor_inverse_ptr == NULL_DATA_PTR && (num_divisor_limbs < newton_div_threshold || num_quot_limbs < newton_div_threshold))
+	{
+		ret_status = Limbs_Div_Bz(quot_ptr, norm_dividend_ptr, num_dividend_limbs + 1, norm_divisor_ptr, num_divisor_limbs);
+	}
+	else
+	{
+		ret_status = Limbs_Div_Newton(quot_ptr, norm_dividend_ptr, num_dividend_limbs + 1, norm_divisor_ptr, num_divisor_limbs, divisor_inverse_ptr);
+	}
+	if(ret_status == SUCCESS && rem_ptr != NULL_DATA_PTR)
+	{
+		if(shift_bits == 0)
+		{
+			memcpy(rem_ptr, norm_dividend_ptr, num_divisor_limbs * sizeof(big_num_limb_t));
+		}
+		else
+		{
+			Limbs_Rshift(rem_ptr, norm_dividend_ptr, num_divisor_limbs, shift_bits);
+		}
+	}
+	Scratch_Free(norm_dividend_ptr);
+	return ret_status;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Div_Knuth
+
+DESCRIPTION    : quot = rem / divisor, rem = rem % divisor, by Knuth's Algorithm D (TAOCP Vol 2, 4.3.1)
+
+INPUT          : most significant bit of divisor is set, num_divisor_limbs >= 2, and most significant num_divisor_limbs limbs of rem
+                 are less than divisor
+
+OUTPUT         : quot has (num_rem_limbs - num_divisor_limbs) limbs, if quot_ptr is not NULL. rem is in least significant
+                 num_divisor_limbs limbs of rem, and other limbs of rem are 0
+
+NOTE           : each quotient limb is estimated from top two limbs of partial remainder and top limb of divisor, corrected by
+                 second limb of divisor, so that estimate is atmost one more than exact, which is then fixed by adding back divisor.
+
+Func ID        : 03.44
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Limbs_Div_Knuth(big_num_limb_t *const quot_ptr, big_num_limb_t *const rem_ptr, const size_t num_rem_limbs, const big_num_limb_t *const divisor_ptr, const size_t num_divisor_limbs)
+{
+	const big_num_limb_t divisor_top = divisor_ptr[num_divisor_limbs - 1], divisor_second = divisor_ptr[num_divisor_limbs - 2];
+	big_num_limb_t *partial_rem_ptr, quot_limb, rhat, product_low, product_high, borrow, top_limb;
+	size_t quot_pos;
+	uint8_t rhat_overflow_flag;
+
+	for(quot_pos = num_rem_limbs - num_divisor_limbs; quot_pos > 0; --quot_pos)
+	{
+		// partial rem has (num_divisor_limbs + 1) limbs, and is less than (divisor * 2 ^ BIG_NUM_LIMB_BITS)
+		partial_rem_ptr = rem_ptr + quot_pos - 1;
+		top_limb = partial_rem_ptr[num_divisor_limbs];
+		if(top_limb >= divisor_top)
+		{
+			quot_limb = BIG_NUM_LIMB_MAX;
+			rhat = partial_rem_ptr[num_divisor_limbs - 1] + divisor_top;
+			rhat_overflow_flag = (rhat < divisor_top);
+		}
+		else
+		{
+			quot_limb = Limb_Div_2by1(top_limb, partial_rem_ptr[num_divisor_limbs - 1], divisor_top, &rhat);
+			rhat_overflow_flag = STATE_NO;
+		}
+		while(rhat_overflow_flag == STATE_NO)
+		{
+			product_low = Limb_Mul_Full(quot_limb, divisor_second, &product_high);
+			if(product_high < rhat || (product_high == rhat && product_low <= partial_rem_ptr[num_divisor_limbs - 2]))
+			{
+				break;
+			}
+			--quot_limb;
+			rhat += divisor_top;
+			rhat_overflow_flag = (rhat < divisor_top);
+		}
+		borrow = Limbs_Submul_1(partial_rem_ptr, divisor_ptr, num_divisor_limbs, quot_limb);
+		partial_rem_ptr[num_divisor_limbs] = top_limb - borrow;
+		if(top_limb < borrow)
+		{
+			// estimate was one more than exact quotient limb
+			--quot_limb;
+			partial_rem_ptr[num_divisor_limbs] += Limbs_Add_N(partial_rem_ptr, partial_rem_ptr, divisor_ptr, num_divisor_limbs);
+		}
+		if(quot_ptr != NULL_DATA_PTR)
+		{
+			quot_ptr[quot_pos - 1] = quot_limb;
+		}
+	}
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Invert
+
+DESCRIPTION    : inverse = approximate 2 ^ (2 * BIG_NUM_LIMB_BITS * num_limbs) / divisor, by Newton iteration with doubling precision
+
+INPUT          : most significant bit of divisor is set
+
+OUTPUT         : inverse has (num_limbs + 1) limbs
+
+NOTE           : upto NEWTON_INV_BASE_LEN limbs, inverse is floor((B ^ (2 * num_limbs) - 1) / divisor) by Knuth division,
+                 where B = 2 ^ BIG_NUM_LIMB_BITS. Otherwise, inverse X of top half limbs of divisor D is found recursively,
+                 scaled to num_limbs, and refined as X + X * (B ^ (2 * num_limbs) - D * X) / B ^ (2 * num_limbs).
+                 Inverse is within a few units of exact, which callers fix by correcting their remainder.
+
+Func ID        : 03.45
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Limbs_Invert(big_num_limb_t *const inverse_ptr, const big_num_limb_t *const divisor_ptr, const size_t num_limbs)
+{
+	big_num_limb_t *temp_ptr, *half_inverse_ptr, *error_ptr, *correction_ptr;
+	size_t half_len, error_len, correction_len;
+	uint8_t too_big_flag;
+	uint16_t ret_status;
+
+	if(num_limbs <= NEWTON_INV_BASE_LEN)
+	{
+		if((temp_ptr = Scratch_Alloc(2 * num_limbs + 1)) == NULL_DATA_PTR)
+		{
+			#ifdef TRACE_ERROR
+			   Trace_Error("invert - memory alloc failed \n");
+			#endif
+			return FAILURE;
+		}
+		memset(temp_ptr, 0xFF, 2 * num_limbs * sizeof(big_num_limb_t));
+		temp_ptr[2 * num_limbs] = 0;
+		Limbs_Div_Knuth(inverse_ptr, temp_ptr, 2 * num_limbs + 1, divisor_ptr, num_limbs);
+		Scratch_Free(temp_ptr);
+		return SUCCESS;
+	}
+	/* one more limb than half, so that error of truncated divisor is within precision of num_limbs */
+	half_len = (num_limbs + 1) / 2 + 1;
+	if((temp_ptr = Scratch_Alloc(half_len + 1 + 2 * num_limbs + 1 + half_len + 1 + num_limbs + 2)) == NULL_DATA_PTR)
+	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("invert - memory alloc failed \n");
+		#endif
+		return FAILURE;
+	}
+	half_inverse_ptr = temp_ptr;
+	error_ptr = half_inverse_ptr + half_len + 1;
+	correction_ptr = error_ptr + 2 * num_limbs + 1;
+	if((ret_status = Limbs_Invert(half_inverse_ptr, divisor_ptr + num_limbs - half_len, half_len)) == SUCCESS)
+	{
+		/* X = half inverse * B ^ (num_limbs - half_len), error = D * X - B ^ (2 * num_limbs) */
+		memset(error_ptr, 0, (num_limbs - half_len) * sizeof(big_num_limb_t));
+		ret_status = Limbs_Mul(error_ptr + num_limbs - half_len, divisor_ptr, num_limbs, half_inverse_ptr, half_len + 1);
+	}
+	if(ret_status == SUCCESS)
+	{
+		if(error_ptr[2 * num_limbs] != 0)
+		{
+			--error_ptr[2 * num_limbs];
+			too_big_flag = STATE_YES;
+		}
+		else
+		{
+			Limbs_Twos_Neg(error_ptr, 2 * num_limbs);
+			too_big_flag = STATE_NO;
+		}
+		memset(inverse_ptr, 0, (num_limbs - half_len) * sizeof(big_num_limb_t));
+		memcpy(inverse_ptr + num_limbs - half_len, half_inverse_ptr, (half_len + 1) * sizeof(big_num_limb_t));
+		/* correction = X * error / B ^ (2 * num_limbs) = half inverse * error / B ^ (num_limbs + half_len). Limbs of error below
+		   (num_limbs - 1) change correction by less than one, so only upper limbs of error are multiplied */
+		error_len = Limbs_Normalized_Len(error_ptr + num_limbs - 1, num_limbs + 2);
+		if(error_len > 0)
+		{
+			ret_status = Limbs_Mul(correction_ptr, half_inverse_ptr, half_len + 1, error_ptr + num_limbs - 1, error_len);
+			correction_len = Limbs_Normalized_Len(correction_ptr + half_len + 1, error_len);
+			if(ret_status == SUCCESS && correction_len > 0)
+			{
+				if(too_big_flag == STATE_YES)
+				{
+					Limbs_Sub(inverse_ptr, inverse_ptr, num_limbs + 1, correction_ptr + half_len + 1, correction_len);
+				}
+				else
+				{
+					Limbs_Add(inverse_ptr, inverse_ptr, num_limbs + 1, correction_ptr + half_len + 1, correction_len);
+				}
+			}
+		}
+	}
+	Scratch_Free(temp_ptr);
+	return ret_status;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Div_Reciprocal
+
+DESCRIPTION    : quot = rem / divisor, rem = rem % divisor, by multiplying with reciprocal of divisor
+
+INPUT          : as of Limbs_Div_Knuth(), and num of quot limbs (num_rem_limbs - num_divisor_limbs) is atmost num_divisor_limbs
+
+OUTPUT         : as of Limbs_Div_Knuth()
+
+NOTE           : only top (num quot limbs + 2) limbs of divisor and top (num quot limbs + 1) limbs of rem are used for estimate
+                 of quot, and then rem = rem - quot * divisor is corrected, by adding or subtracting divisor, till it is in [0, divisor).
+                 If divisor_inverse_ptr is not NULL, it has (num_divisor_limbs + 1) limbs of Limbs_Invert() of divisor, whose top limbs
+                 are used as inverse of top limbs of divisor, instead of inverting them.
+
+Func ID        : 03.46
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Limbs_Div_Reciprocal(big_num_limb_t *const quot_ptr, big_num_limb_t *const rem_ptr, const size_t num_rem_limbs, const big_num_limb_t *const divisor_ptr, const size_t num_divisor_limbs,
+   const big_num_limb_t *const divisor_inverse_ptr)
+{
+	const size_t num_quot_limbs = num_rem_limbs - num_divisor_limbs;
+	const size_t num_inverse_limbs = (num_quot_limbs + 2 < num_divisor_limbs) ? num_quot_limbs + 2 : num_divisor_limbs;
+	const size_t num_top_limbs = num_quot_limbs + 1;
+	const big_num_limb_t *inverse_ptr;
+	big_num_limb_t *temp_ptr, *product_ptr, borrow;
+	uint16_t ret_status = SUCCESS;
+
+	if((temp_ptr = Scratch_Alloc(num_inverse_limbs + 1 + num_top_limbs + num_inverse_limbs + 1 + num_rem_limbs)) == NULL_DATA_PTR)
+	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("div - memory alloc failed \n");
+		#endif
+		return FAILURE;
+	}
+	product_ptr = temp_ptr + num_inverse_limbs + 1;
+	if(divisor_inverse_ptr != NULL_DATA_PTR)
+	{
+		inverse_ptr = divisor_inverse_ptr + num_divisor_limbs - num_inverse_limbs;
+	}
+	else
+	{
+		inverse_ptr = temp_ptr;
+		ret_status = Limbs_Invert(temp_ptr, divisor_ptr + num_divisor_limbs - num_inverse_limbs, num_inverse_limbs);
+	}
+	if(ret_status == SUCCESS)
+	{
+		/* quot = top limbs of rem * inverse / B ^ (num_inverse_limbs + 1), limited to num_quot_limbs */
+		ret_status = Limbs_Mul(product_ptr, rem_ptr + num_rem_limbs - num_top_limbs, num_top_limbs, inverse_ptr, num_inverse_limbs + 1);
+	}
+	if(ret_status == SUCCESS)
+	{
+		if(product_ptr[num_top_limbs + num_inverse_limbs] != 0)
+		{
+			memset(quot_ptr, 0xFF, num_quot_limbs * sizeof(big_num_limb_t));
+		}
+		else
+		{
+			memcpy(quot_ptr, product_ptr + num_inverse_limbs + 1, num_quot_limbs * sizeof(big_num_limb_t));
+		}
+		ret_status = Limbs_Mul(product_ptr, divisor_ptr, num_divisor_limbs, quot_ptr, num_quot_limbs);
+	}
+	if(ret_status == SUCCESS)
+	{
+		borrow = Limbs_Sub_N(rem_ptr, rem_ptr, product_ptr, num_rem_limbs);
+		while(borrow != 0)
+		{
+			// quot was too big
+			Limbs_Sub_1(quot_ptr, quot_ptr, num_quot_limbs, 1);
+			borrow -= Limbs_Add(rem_ptr, rem_ptr, num_rem_limbs, divisor_ptr, num_divisor_limbs);
+		}
+		while(Limbs_Normalized_Len(rem_ptr + num_divisor_limbs, num_quot_limbs) != 0 || Limbs_Cmp(rem_ptr, divisor_ptr, num_divisor_limbs) >= 0)
+		{
+			// quot was too small
+			Limbs_Add_1(quot_ptr, quot_ptr, num_quot_limbs, 1);
+			Limbs_Sub(rem_ptr, rem_ptr, num_rem_limbs, divisor_ptr, num_divisor_limbs);
+		}
+	}
+	Scratch_Free(temp_ptr);
+	return ret_status;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Div_Newton
+
+DESCRIPTION    : quot = rem / divisor, rem = rem % divisor, by Newton reciprocal of divisor
+
+INPUT          : as of Limbs_Div_Knuth()
+
+OUTPUT         : as of Limbs_Div_Knuth()
+
+NOTE           : if quot has more limbs than divisor, rem is divided in blocks of num_divisor_limbs quot limbs, from most significant
+                 block, where partial remainder of a block is top limbs of next block. Blocks with less than newton_div_threshold
+                 quot limbs use Limbs_Div_Bz(), unless divisor_inverse_ptr, as of Limbs_Div_Reciprocal(), is not NULL.
+                 If quot_ptr is NULL, quot of a block is kept in scratch.
+
+Func ID        : 03.47
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Limbs_Div_Newton(big_num_limb_t *const quot_ptr, big_num_limb_t *const rem_ptr, const size_t num_rem_limbs, const big_num_limb_t *const divisor_ptr, const size_t num_divisor_limbs,
+   const big_num_limb_t *const divisor_inverse_ptr)
+{
+	big_num_limb_t *block_quot_scratch_ptr = NULL_DATA_PTR;
+	size_t num_quot_limbs = num_rem_limbs - num_divisor_limbs, block_len;
+	uint16_t ret_status = SUCCESS;
+
+	if(quot_ptr == NULL_DATA_PTR && (block_quot_scratch_ptr = Scratch_Alloc(num_divisor_limbs)) == NULL_DATA_PTR)
+	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("div - memory alloc failed \n");
+		#endif
+		return FAILURE;
+	}
+	while(num_quot_limbs > 0 && ret_status == SUCCESS)
+	{
+		block_len = (num_quot_limbs > num_divisor_limbs) ? num_divisor_limbs : num_quot_limbs;
+		num_quot_limbs -= block_len;
+		if(block_len < newton_div_threshold && divisor_inverse_ptr == NULL_DATA_PTR)
+		{
+			ret_status = Limbs_Div_Bz((quot_ptr != NULL_DATA_PTR) ? quot_ptr + num_quot_limbs : NULL_DATA_PTR, rem_ptr + num_quot_limbs,
+			   num_divisor_limbs + block_len, divisor_ptr, num_divisor_limbs);
+		}
+		else
+		{
+			ret_status = Limbs_Div_Reciprocal((quot_ptr != NULL_DATA_PTR) ? quot_ptr + num_quot_limbs : block_quot_scratch_ptr, rem_ptr + num_quot_limbs,
+			   num_divisor_limbs + block_len, divisor_ptr, num_divisor_limbs, divisor_inverse_ptr);
+		}
+	}
+	Scratch_Free(block_quot_scratch_ptr);
+	return ret_status;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Div_Bz_N
+
+DESCRIPTION    : quot_high * B ^ num_limbs + quot = rem / divisor, rem = rem % divisor, where B = 2 ^ BIG_NUM_LIMB_BITS,
+                 by Burnikel-Ziegler recursive division
+
+INPUT          : rem has 2 * num_limbs limbs, divisor has num_limbs limbs with most significant bit set, num_limbs >= 2.
+                 scratch has num_limbs limbs.
+
+OUTPUT         : quot has num_limbs limbs and quot_high is 0 or 1. rem is in least significant num_limbs limbs of rem.
+
+NOTE           : upper half of quot is found by recursively dividing top limbs of rem by top half limbs of divisor, and
+                 then product of that quot and low half limbs of divisor is subtracted from rem. Partial quot is atmost
+                 two more than exact, which is fixed by adding back divisor. Lower half of quot is found in same way,
+                 from remainder of upper half.
+
+Func ID        : 03.48
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Limbs_Div_Bz_N(big_num_limb_t *const quot_ptr, big_num_limb_t *const quot_high_ptr, big_num_limb_t *const rem_ptr,
+   const big_num_limb_t *const divisor_ptr, const size_t num_limbs, big_num_limb_t *const scratch_ptr)
+{
+	const size_t low_len = num_limbs / 2, high_len = num_limbs - low_len;
+	big_num_limb_t quot_high, quot_low_high, borrow;
+
+	if(num_limbs < bz_div_threshold || num_limbs < 4)
+	{
+		quot_high = 0;
+		if(Limbs_Cmp(rem_ptr + num_limbs, divisor_ptr, num_limbs) >= 0)
+		{
+			Limbs_Sub_N(rem_ptr + num_limbs, rem_ptr + num_limbs, divisor_ptr, num_limbs);
+			quot_high = 1;
+		}
+		Limbs_Div_Knuth(quot_ptr, rem_ptr, 2 * num_limbs, divisor_ptr, num_limbs);
+		*quot_high_ptr = quot_high;
+		return SUCCESS;
+	}
+	/* upper high_len limbs of quot, from top 2 * high_len limbs of rem and top high_len limbs of divisor */
+	if(Limbs_Div_Bz_N(quot_ptr + low_len, &quot_high, rem_ptr + 2 * low_len, divisor_ptr + low_len, high_len, scratch_ptr) != SUCCESS
+	   || Limbs_Mul(scratch_ptr, quot_ptr + low_len, high_len, divisor_ptr, low_len) != SUCCESS)
+	{
+		return FAILURE;
+	}
+	borrow = Limbs_Sub_N(rem_ptr + low_len, rem_ptr + low_len, scratch_ptr, num_limbs);
+	if(quot_high != 0)
+	{
+		borrow += Limbs_Sub_N(rem_ptr + num_limbs, rem_ptr + num_limbs, divisor_ptr, low_len);
+	}
+	while(borrow != 0)
+	{
+		quot_high -= Limbs_Sub_1(quot_ptr + low_len, quot_ptr + low_len, high_len, 1);
+		borrow -= Limbs_Add_N(rem_ptr + low_len, rem_ptr + low_len, divisor_ptr, num_limbs);
+	}
+	/* lower low_len limbs of quot, from top 2 * low_len limbs of partial rem and top low_len limbs of divisor */
+	if(Limbs_Div_Bz_N(quot_ptr, &quot_low_high, rem_ptr + high_len, divisor_ptr + high_len, low_len, scratch_ptr) != SUCCESS
+	   || Limbs_Mul(scratch_ptr, quot_ptr, low_len, divisor_ptr, high_len) != SUCCESS)
+	{
+		return FAILURE;
+	}
+	borrow = Limbs_Sub_N(rem_ptr, rem_ptr, scratch_ptr, num_limbs);
+	if(quot_low_high != 0)
+	{
+		borrow += Limbs_Sub_N(rem_ptr + low_len, rem_ptr + low_len, divisor_ptr, high_len);
+	}
+	while(borrow != 0)
+	{
+		// quot_low_high is cancelled by wrap around of lower quot limbs
+		Limbs_Sub_1(quot_ptr, quot_ptr, low_len, 1);
+		borrow -= Limbs_Add_N(rem_ptr, rem_ptr, divisor_ptr, num_limbs);
+	}
+	*quot_high_ptr = quot_high;
+	return SUCCESS;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_Div_Bz
+
+DESCRIPTION    : quot = rem / divisor, rem = rem % divisor, by Burnikel-Ziegler recursive division
+
+INPUT          : as of Limbs_Div_Knuth()
+
+OUTPUT         : as of Limbs_Div_Knuth()
+
+NOTE           : rem is divided in blocks of num_divisor_limbs quot limbs, from most significant block, as in Limbs_Div_Newton().
+                 Block of fewer quot limbs is estimated by Limbs_Div_Bz_N() from top limbs of divisor and then corrected,
+                 and block with less than bz_div_threshold quot limbs uses Limbs_Div_Knuth(). If quot_ptr is NULL, quot of a block
+                 is kept in scratch.
+
+Func ID        : 03.49
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Limbs_Div_Bz(big_num_limb_t *const quot_ptr, big_num_limb_t *const rem_ptr, const size_t num_rem_limbs, const big_num_limb_t *const divisor_ptr, const size_t num_divisor_limbs)
+{
+	big_num_limb_t *scratch_ptr, *block_rem_ptr, *block_quot_ptr, quot_high, borrow;
+	size_t num_quot_limbs = num_rem_limbs - num_divisor_limbs, block_len;
+	uint16_t ret_status = SUCCESS;
+
+	if((scratch_ptr = Scratch_Alloc((quot_ptr != NULL_DATA_PTR) ? num_divisor_limbs : 2 * num_divisor_limbs)) == NULL_DATA_PTR)
+	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("div - memory alloc failed \n");
+		#endif
+		return FAILURE;
+	}
+	while(num_quot_limbs > 0 && ret_status == SUCCESS)
+	{
+		block_len = (num_quot_limbs > num_divisor_limbs) ? num_divisor_limbs : num_quot_limbs;
+		num_quot_limbs -= block_len;
+		block_rem_ptr = rem_ptr + num_quot_limbs;
+		block_quot_ptr = (quot_ptr != NULL_DATA_PTR) ? quot_ptr + num_quot_limbs : scratch_ptr + num_divisor_limbs;
+		if(block_len < bz_div_threshold || block_len < 4)
+		{
+			Limbs_Div_Knuth((quot_ptr != NULL_DATA_PTR) ? block_quot_ptr : NULL_DATA_PTR, block_rem_ptr, num_divisor_limbs + block_len, divisor_ptr, num_divisor_limbs);
+			continue;
+		}
+		ret_status = Limbs_Div_Bz_N(block_quot_ptr, &quot_high, block_rem_ptr + num_divisor_limbs - block_len,
+		   divisor_ptr + num_divisor_limbs - block_len, block_len, scratch_ptr);
+		if(ret_status != SUCCESS || block_len == num_divisor_limbs)
+		{
+			continue;
+		}
+		/* subtract product of block quot and low limbs of divisor, not used in estimate */
+		ret_status = Limbs_Mul(scratch_ptr, block_quot_ptr, block_len, divisor_ptr, num_divisor_limbs - block_len);
+		borrow = Limbs_Sub_N(block_rem_ptr, block_rem_ptr, scratch_ptr, num_divisor_limbs);
+		if(quot_high != 0)
+		{
+			borrow += Limbs_Sub_N(block_rem_ptr + block_len, block_rem_ptr + block_len, divisor_ptr, num_divisor_limbs - block_len);
+		}
+		while(borrow != 0)
+		{
+			Limbs_Sub_1(block_quot_ptr, block_quot_ptr, block_len, 1);
+			borrow -= Limbs_Add_N(block_rem_ptr, block_rem_ptr, divisor_ptr, num_divisor_limbs);
+		}
+	}
+	Scratch_Free(scratch_ptr);
+	return ret_status;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Scratch_Arena_Resize
+
+DESCRIPTION    : reallocates scratch arena of calling thread with num_limbs limbs
+
+INPUT          : no scratch of calling thread is in use
+
+OUTPUT         :
+
+NOTE           : on failure, arena is left without limbs, so that scratch is allocated from heap.
+
+Func ID        : 03.61
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Scratch_Arena_Resize(const size_t num_limbs)
+{
+	Scratch_Unmap(scratch_arena.limb_ptr, scratch_arena.alloc_limbs);
+	scratch_arena.alloc_limbs = 0;
+	if((scratch_arena.limb_ptr = Scratch_Map(num_limbs)) == NULL_DATA_PTR)
+	{
+		return FAILURE;
+	}
+	scratch_arena.alloc_limbs = num_limbs;
+	return SUCCESS;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Scratch_Map
+
+DESCRIPTION    : allocates num_limbs limbs for scratch arena or scratch from heap
+
+INPUT          :
+
+OUTPUT         : returns NULL, if alloc failed
+
+NOTE           : atleast SCRATCH_MAP_MIN_LIMBS limbs are mapped, as malloc keeps large freed blocks in its heap after its
+                 mmap threshold grew, so that scratch freed after parse of operands, is still resident during format of result.
+
+Func ID        : 03.82
+
+BUGS           :
+-*------------------------------------------------------------*/
+big_num_limb_t *Scratch_Map(const size_t num_limbs)
+{
+	#ifdef BIG_NUM_MMAP
+	void *map_ptr;
+
+	if(num_limbs >= SCRATCH_MAP_MIN_LIMBS)
+	{
+		if((map_ptr = mmap(NULL_DATA_PTR, num_limbs * sizeof(big_num_limb_t), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)) == MAP_FAILED)
+		{
+			return NULL_DATA_PTR;
+		}
+		return (big_num_limb_t *)map_ptr;
+	}
+	#endif
+	return malloc(num_limbs * sizeof(big_num_limb_t));
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Scratch_Unmap
+
+DESCRIPTION    : frees limbs allocated by Scratch_Map()
+
+INPUT          : num_limbs is same num of limbs, which was passed to Scratch_Map()
+
+OUTPUT         :
+
+NOTE           :
+
+Func ID        : 03.83
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Scratch_Unmap(big_num_limb_t *const limb_ptr, const size_t num_limbs)
+{
+	if(limb_ptr == NULL_DATA_PTR)
+	{
+		return;
+	}
+	#ifdef BIG_NUM_MMAP
+	if(num_limbs >= SCRATCH_MAP_MIN_LIMBS)
+	{
+		munmap(limb_ptr, num_limbs * sizeof(big_num_limb_t));
+		return;
+	}
+	#endif
+	free(limb_ptr);
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Scratch_Alloc
+
+DESCRIPTION    : allocates num_limbs scratch limbs from scratch arena of calling thread
+
+INPUT          :
+
+OUTPUT         : returns NULL, if alloc failed
+
+NOTE           : scratch must be freed by Scratch_Free() in reverse order of its alloc, which is O(1) as arena only moves its top back.
+                 Scratch, that does not fit in arena, is allocated from heap, with its num of limbs in limb before it.
+                 When no scratch is in use, arena grows to high water mark of scratch, if it is within scratch_arena_max_bytes,
+                 so that scratch of next operation of same size fits in arena. Returned scratch is below top of arena,
+                 so that Scratch_Free() finds scratch of arena by its address.
+
+Func ID        : 03.62
+
+BUGS           :
+-*------------------------------------------------------------*/
+big_num_limb_t *Scratch_Alloc(const size_t num_limbs)
+{
+	big_num_limb_t *scratch_ptr;
+	size_t num_arena_limbs;
+
+	++scratch_arena.num_allocs;
+	if(scratch_arena.num_used_limbs == 0 && scratch_arena.num_heap_limbs == 0)
+	{
+		num_arena_limbs = ((scratch_arena.peak_limbs > num_limbs) ? scratch_arena.peak_limbs : num_limbs) + 1;
+		if(num_arena_limbs < SCRATCH_ARENA_MIN_LIMBS)
+		{
+			num_arena_limbs = SCRATCH_ARENA_MIN_LIMBS;
+		}
+		if(num_arena_limbs > scratch_arena.alloc_limbs && num_arena_limbs <= scratch_arena_max_bytes / sizeof(big_num_limb_t))
+		{
+			Scratch_Arena_Resize(num_arena_limbs);
+		}
+	}
+	if(num_limbs < scratch_arena.alloc_limbs - scratch_arena.num_used_limbs)
+	{
+		scratch_ptr = scratch_arena.limb_ptr + scratch_arena.num_used_limbs;
+		scratch_arena.num_used_limbs += num_limbs;
+	}
+	else
+	{
+		if((scratch_ptr = Scratch_Map(num_limbs + 1)) == NULL_DATA_PTR)
+		{
+			return NULL_DATA_PTR;
+		}
+		*scratch_ptr++ = num_limbs;
+		scratch_arena.num_heap_limbs += num_limbs;
+		++scratch_arena.num_heap_allocs;
+	}
+	if(scratch_arena.num_used_limbs + scratch_arena.num_heap_limbs > scratch_arena.peak_limbs)
+	{
+		scratch_arena.peak_limbs = scratch_arena.num_used_limbs + scratch_arena.num_heap_limbs;
+	}
+	return scratch_ptr;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Scratch_Free
+
+DESCRIPTION    : frees scratch allocated by Scratch_Alloc()
+
+INPUT          : scratch_ptr is last scratch allocated by calling thread, which is not yet freed, or NULL
+
+OUTPUT         :
+
+NOTE           : scratch of arena is freed by moving top of arena back to scratch_ptr, and scratch from heap is freed.
+
+Func ID        : 03.63
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Scratch_Free(big_num_limb_t *const scratch_ptr)
+{
+	if(scratch_ptr == NULL_DATA_PTR)
+	{
+		return;
+	}
+	if(scratch_arena.alloc_limbs != 0 && (uintptr_t)scratch_ptr >= (uintptr_t)scratch_arena.limb_ptr &&
+	   (uintptr_t)scratch_ptr < (uintptr_t)(scratch_arena.limb_ptr + scratch_arena.alloc_limbs))
+	{
+		scratch_arena.num_used_limbs = (size_t)(scratch_ptr - scratch_arena.limb_ptr);
+	}
+	else
+	{
+		scratch_arena.num_heap_limbs -= scratch_ptr[-1];
+		Scratch_Unmap(scratch_ptr - 1, scratch_ptr[-1] + 1);
+	}
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_Init
+
+DESCRIPTION    : initialise big num to 0, without any limbs memory
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           :
+
+Func ID        : 04.01
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Big_Num_Init(big_num_t *const num_ptr)
+{
+	num_ptr->limb_ptr = NULL_DATA_PTR;
+	num_ptr->num_limbs = 0;
+	num_ptr->alloc_limbs = 0;
+	num_ptr->precision_digits = 0;
+	num_ptr->sign_flag = BIG_NUM_SIGN_POSITIVE;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_Free
+
+DESCRIPTION    : frees limbs memory of big num, and big num is set to 0
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           :
+
+Func ID        : 04.02
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Big_Num_Free(big_num_t *const num_ptr)
+{
+	if(num_ptr->limb_ptr != NULL_DATA_PTR)
+	{
+		free(num_ptr->limb_ptr);
+	}
+	Big_Num_Init(num_ptr);
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_Reserve
+
+DESCRIPTION    : make sure that big num has memory for atleast num_limbs limbs
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           : existing limbs are preserved
+
+Func ID        : 04.03
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Big_Num_Reserve(big_num_t *const num_ptr, const size_t num_limbs)
+{
+	big_num_limb_t *temp_limb_ptr;
+
+	if(num_ptr->alloc_limbs >= num_limbs)
+	{
+		return SUCCESS;
+	}
+	temp_limb_ptr = realloc(num_ptr->limb_ptr, num_limbs * sizeof(big_num_limb_t));
+	if(temp_limb_ptr == NULL_DATA_PTR)
+	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("big num - memory alloc failed for %lu limbs \n", (unsigned long)num_limbs);
+		#endif
+		return FAILURE;
+	}
+	num_ptr->limb_ptr = temp_limb_ptr;
+	num_ptr->alloc_limbs = num_limbs;
+	return SUCCESS;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_Normalize
+
+DESCRIPTION    : removes zero limbs at most significant end. Zero is always positive.
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           :
+
+Func ID        : 04.04
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Big_Num_Normalize(big_num_t *const num_ptr)
+{
+	num_ptr->num_limbs = Limbs_Normalized_Len(num_ptr->limb_ptr, num_ptr->num_limbs);
+	if(num_ptr->num_limbs == 0)
+	{
+		num_ptr->sign_flag = BIG_NUM_SIGN_POSITIVE;
+	}
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_Swap
+
+DESCRIPTION    :
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           :
+
+Func ID        : 04.05
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Big_Num_Swap(big_num_t *const num1_ptr, big_num_t *const num2_ptr)
+{
+	big_num_t temp_num;
+
+	temp_num = *num1_ptr;
+	*num1_ptr = *num2_ptr;
+	*num2_ptr = temp_num;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_Copy
+
+DESCRIPTION    :
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           :
+
+Func ID        : 04.06
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Big_Num_Copy(big_num_t *const dest_num_ptr, const big_num_t *const src_num_ptr)
+{
+	if(dest_num_ptr == src_num_ptr)
+	{
+		return SUCCESS;
+	}
+	if((Big_Num_Reserve(dest_num_ptr, src_num_ptr->num_limbs)) != SUCCESS)
+	{
+		return FAILURE;
+	}
+	if(src_num_ptr->num_limbs != 0)
+	{
+	    memcpy(dest_num_ptr->limb_ptr, src_num_ptr->limb_ptr, src_num_ptr->num_limbs * sizeof(big_num_limb_t));
+	}
+	dest_num_ptr->num_limbs = src_num_ptr->num_limbs;
+	dest_num_ptr->precision_digits = src_num_ptr->precision_digits;
+	dest_num_ptr->sign_flag = src_num_ptr->sign_flag;
+	return SUCCESS;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_Is_Zero
+
+DESCRIPTION    :
+
+INPUT          :
+
+OUTPUT         : returns STATE_YES if big num is 0, else STATE_NO
+
+NOTE           :
+
+Func ID        : 04.07
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Big_Num_Is_Zero(const big_num_t *const num_ptr)
+{
+	return (num_ptr->num_limbs == 0) ? STATE_YES : STATE_NO;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_From_Str
+
+DESCRIPTION    : converts big num in str, into limbs based big num.
+
+INPUT          : num_str has optional sign '-' or '+' char, followed by decimal digits with atmost one '.' char
+
+OUTPUT         :
+
+NOTE           : converted by Big_Num_From_Chars().
+
+Func ID        : 04.08
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Big_Num_From_Str(big_num_t *const num_ptr, const char *const num_str)
+{
+	if(num_ptr == NULL_DATA_PTR || num_str == NULL_DATA_PTR)
+	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("big num or str is null \n");
+		#endif
+		return FAILURE;
+	}
+	return Big_Num_From_Chars(num_ptr, num_str, strlen(num_str));
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_From_Chars
+
+DESCRIPTION    : converts big num in num_str_chars chars of num_str, into limbs based big num.
+
+INPUT          : num_str has optional sign '-' or '+' char, followed by decimal digits with atmost one '.' char. num_str need
+                 not be null terminated, as in operand file mapped into memory.
+
+OUTPUT         :
+
+NOTE           : chars are validated by Dec_Str_Scan(), and digits are packed in chunks of BIG_NUM_LIMB_DEC_DIGITS digits by
+                 Dec_Digits_To_Chunks(), which are converted by Limbs_From_Dec_Chunks(). Limbs of num are reused, if they are enough.
+
+Func ID        : 04.38
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Big_Num_From_Chars(big_num_t *const num_ptr, const char *const num_str, const size_t num_str_chars)
+{
+	return Big_Num_From_Mapped_Chars(num_ptr, num_str, num_str_chars, NULL_DATA_PTR);
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_From_Mapped_Chars
+
+DESCRIPTION    : converts big num in num_str_chars chars of num_str, which can be in mapping of operand file, into limbs based big num.
+
+INPUT          : operand_file_ptr is NULL, or num_str is in its mapping
+
+OUTPUT         :
+
+NOTE           : as of Big_Num_From_Chars(), where chars are validated and packed in blocks of STR_CONV_BLOCK_CHARS chars, from
+                 first char. After each block, mapped pages of operand file upto block are dropped by Operand_File_Drop(), so that
+                 only pages of a block are in memory, besides chunks of BIG_NUM_LIMB_DEC_DIGITS digits, which are 0.42 bytes per digit.
+
+Func ID        : 04.53
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Big_Num_From_Mapped_Chars(big_num_t *const num_ptr, const char *const num_str, const size_t num_str_chars, operand_file_t *const operand_file_ptr)
+{
+	const char *digits_str;
+	big_num_limb_t *chunk_ptr, chunk_value, stack_chunks[BIG_NUM_STACK_LIMBS];
+	size_t str_pos = 0, num_chars, point_pos, num_digits, num_precision_digits, chunk_digits_left, num_chunks, chunk_pos, num_run_chunks;
+	size_t block_pos, block_len, block_point_pos;
+	uint16_t ret_status;
+	uint8_t sign_flag = BIG_NUM_SIGN_POSITIVE;
+
+	if(num_ptr == NULL_DATA_PTR || num_str == NULL_DATA_PTR)
+	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("big num or str is null \n");
+		#endif
+		return FAILURE;
+	}
+	if(num_str_chars != 0 && (num_str[0] == '-' || num_str[0] == '+'))
+	{
+		if(num_str[0] == '-')
+		{
+			sign_flag = BIG_NUM_SIGN_NEGATIVE;
+		}
+		str_pos = 1;
+	}
+	digits_str = num_str + str_pos;
+	num_chars = num_str_chars - str_pos;
+	point_pos = num_chars;
+	for(block_pos = 0; block_pos < num_chars; block_pos += block_len)
+	{
+		block_len = (num_chars - block_pos < STR_CONV_BLOCK_CHARS) ? num_chars - block_pos : STR_CONV_BLOCK_CHARS;
+		str_pos = block_pos + Dec_Str_Scan(digits_str + block_pos, block_len, &block_point_pos);
+		if(block_point_pos != block_len)
+		{
+			if(point_pos != num_chars)
+			{
+				// second '.' char is invalid char, which is before first invalid char of block
+				str_pos = block_pos + block_point_pos;
+			}
+			point_pos = block_pos + block_point_pos;
+		}
+		if(str_pos != block_pos + block_len)
+		{
+			#ifdef TRACE_ERROR
+		       Trace_Error("big num str has invalid char : %c at pos : %lu \n", digits_str[str_pos], (unsigned long)(digits_str - num_str + str_pos));
+		    #endif
+			return FAILURE;
+		}
+		if(operand_file_ptr != NULL_DATA_PTR)
+		{
+			Operand_File_Drop(operand_file_ptr, digits_str + block_pos + block_len);
+		}
+	}
+	num_digits = (point_pos == num_chars) ? num_chars : num_chars - 1;
+	num_precision_digits = (point_pos == num_chars) ? 0 : num_chars - point_pos - 1;
+	if(num_digits == 0)
+	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("big num str has only non numeric char \n");
+		#endif
+		return FAILURE;
+	}
+	// every chunk of BIG_NUM_LIMB_DEC_DIGITS digits is less than 10 ^ BIG_NUM_LIMB_DEC_DIGITS, which fits in a limb
+	num_chunks = (num_digits + BIG_NUM_LIMB_DEC_DIGITS - 1) / BIG_NUM_LIMB_DEC_DIGITS;
+	if((Big_Num_Reserve(num_ptr, num_chunks)) != SUCCESS)
+	{
+		return FAILURE;
+	}
+	chunk_ptr = stack_chunks;
+	if(num_chunks > BIG_NUM_STACK_LIMBS && (chunk_ptr = Scratch_Alloc(num_chunks)) == NULL_DATA_PTR)
+	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("from str - memory alloc failed \n");
+		#endif
+		return FAILURE;
+	}
+	// chunks are stored from least significant chunk, and most significant chunk has remaining digits
+	chunk_digits_left = num_digits - (num_chunks - 1) * BIG_NUM_LIMB_DEC_DIGITS;
+	for(str_pos = 0, chunk_pos = num_chunks; chunk_pos > 0; )
+	{
+		if(str_pos == point_pos)
+		{
+			++str_pos;
+		}
+		if(chunk_digits_left == BIG_NUM_LIMB_DEC_DIGITS && (str_pos > point_pos || str_pos + BIG_NUM_LIMB_DEC_DIGITS <= point_pos))
+		{
+			// run of whole chunks before or after '.' char, has contiguous digits, and is packed in blocks
+			num_run_chunks = ((str_pos > point_pos) ? num_chars - str_pos : point_pos - str_pos) / BIG_NUM_LIMB_DEC_DIGITS;
+			if(num_run_chunks > STR_CONV_BLOCK_CHARS / BIG_NUM_LIMB_DEC_DIGITS)
+			{
+				num_run_chunks = STR_CONV_BLOCK_CHARS / BIG_NUM_LIMB_DEC_DIGITS;
+			}
+			chunk_pos -= num_run_chunks;
+			Dec_Digits_To_Chunks(chunk_ptr + chunk_pos, digits_str + str_pos, num_run_chunks);
+			str_pos += num_run_chunks * BIG_NUM_LIMB_DEC_DIGITS;
+			if(operand_file_ptr != NULL_DATA_PTR)
+			{
+				Operand_File_Drop(operand_file_ptr, digits_str + str_pos);
+			}
+			continue;
+		}
+		// most significant chunk with remaining digits, or chunk having '.' char, is packed digit by digit
+		for(chunk_value = 0; chunk_digits_left != 0; ++str_pos)
+		{
+			if(str_pos == point_pos)
+			{
+				continue;
+			}
+			chunk_value = (chunk_value * 10) + (big_num_limb_t)(digits_str[str_pos] - '0');
+			--chunk_digits_left;
+		}
+		chunk_ptr[--chunk_pos] = chunk_value;
+		chunk_digits_left = BIG_NUM_LIMB_DEC_DIGITS;
+	}
+	ret_status = Limbs_From_Dec_Chunks(num_ptr->limb_ptr, &num_ptr->num_limbs, chunk_ptr, num_chunks);
+	if(chunk_ptr != stack_chunks)
+	{
+		Scratch_Free(chunk_ptr);
+	}
+	if(ret_status != SUCCESS)
+	{
+		return FAILURE;
+	}
+	num_ptr->precision_digits = num_precision_digits;
+	num_ptr->sign_flag = sign_flag;
+	Big_Num_Normalize(num_ptr);
+	return SUCCESS;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Dec_Str_Scan
+
+DESCRIPTION    : validates num_chars chars of digits_str as decimal digits with atmost one '.' char, and locates '.' char
+
+INPUT          :
+
+OUTPUT         : returns pos of first invalid char, or num_chars if all chars are valid. point_pos_ptr has pos of '.' char,
+                 or num_chars if there is no '.' char
+
+NOTE           : second '.' char is invalid char. On x86-64, Dec_Str_Scan_Avx2() is used from DEC_STR_SIMD_MIN_LEN chars.
+
+Func ID        : 03.56
+
+BUGS           :
+-*------------------------------------------------------------*/
+size_t Dec_Str_Scan(const char *const digits_str, const size_t num_chars, size_t *const point_pos_ptr)
+{
+	size_t str_pos;
+
+	#ifdef BIG_NUM_X86_64_KERNELS
+	   if(num_chars >= DEC_STR_SIMD_MIN_LEN && Cpu_Has_Avx2() == STATE_YES)
+	   {
+		   return Dec_Str_Scan_Avx2(digits_str, num_chars, point_pos_ptr);
+	   }
+	#endif
+	*point_pos_ptr = num_chars;
+	for(str_pos = 0; str_pos < num_chars; ++str_pos)
+	{
+		if(digits_str[str_pos] >= '0' && digits_str[str_pos] <= '9')
+		{
+			continue;
+		}
+		if(digits_str[str_pos] == '.' && *point_pos_ptr == num_chars)
+		{
+			*point_pos_ptr = str_pos;
+			continue;
+		}
+		break;
+	}
+	return str_pos;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Dec_Digits8_To_Value
+
+DESCRIPTION    : converts 8 decimal digit chars in digits_str, into its value
+
+INPUT          :
+
+OUTPUT         : returns value, which is less than 10 ^ 8
+
+NOTE           : on little endian, 8 chars are loaded in a limb, and adjacent digits are combined in parallel by multiply and add,
+                 into 4 values of 2 digits, then 2 values of 4 digits, then value of 8 digits.
+
+Func ID        : 03.57
+
+BUGS           :
+-*------------------------------------------------------------*/
+static inline uint32_t Dec_Digits8_To_Value(const char *const digits_str)
+{
+	#ifdef BIG_NUM_SWAR_DIGITS
+	   uint64_t value;
+
+	   memcpy(&value, digits_str, sizeof(value));
+	   value -= 0x3030303030303030ULL;
+	   /* first char is in least significant byte, so byte of more significant digit is multiplied by 10 */
+	   value = (value * 10) + (value >> 8);
+	   value = (((value & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) + (((value >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >> 32;
+	   return (uint32_t)value;
+	#else
+	   uint32_t value = 0;
+	   size_t char_pos;
+
+	   for(char_pos = 0; char_pos < 8; ++char_pos)
+	   {
+		   value = (value * 10) + (uint32_t)(digits_str[char_pos] - '0');
+	   }
+	   return value;
+	#endif
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Dec_Digits_To_Chunks
+
+DESCRIPTION    : packs (num_chunks * BIG_NUM_LIMB_DEC_DIGITS) decimal digit chars in digits_str, into num_chunks chunks
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           : chunk_ptr is stored from least significant chunk, ie chunk_ptr[num_chunks - 1] has first BIG_NUM_LIMB_DEC_DIGITS digits.
+                 chunk is made of 8 + 8 + 3 digits. On x86-64, Dec_Digits_To_Chunks_Avx2() is used for 2 or more chunks,
+                 which gives same chunks.
+
+Func ID        : 03.58
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Dec_Digits_To_Chunks(big_num_limb_t *const chunk_ptr, const char *const digits_str, const size_t num_chunks)
+{
+	const char *chunk_str = digits_str;
+	size_t chunk_pos;
+
+	#ifdef BIG_NUM_X86_64_KERNELS
+	   if(num_chunks >= 2 && Cpu_Has_Avx2() == STATE_YES)
+	   {
+		   Dec_Digits_To_Chunks_Avx2(chunk_ptr, digits_str, num_chunks);
+		   return;
+	   }
+	#endif
+	for(chunk_pos = num_chunks; chunk_pos > 0; chunk_str += BIG_NUM_LIMB_DEC_DIGITS)
+	{
+		chunk_ptr[--chunk_pos] = ((big_num_limb_t)Dec_Digits8_To_Value(chunk_str) * 100000000000ULL) + ((big_num_limb_t)Dec_Digits8_To_Value(chunk_str + 8) * 1000)
+		   + (big_num_limb_t)((chunk_str[16] - '0') * 100 + (chunk_str[17] - '0') * 10 + (chunk_str[18] - '0'));
+	}
+}
+
+#ifdef BIG_NUM_X86_64_KERNELS
+/*------------------------------------------------------------*
+FUNCTION NAME  : Dec_Str_Scan_Avx2
+
+DESCRIPTION    : as of Dec_Str_Scan(), by AVX2 for 32 chars per iteration
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           : char is digit, if (char - '0') as unsigned byte is atmost 9. In masks of 32 chars, invalid chars are neither digit
+                 nor '.', and every '.' char after first '.' char is also invalid. Remaining chars are checked one by one.
+
+Func ID        : 03.59
+
+BUGS           :
+-*------------------------------------------------------------*/
+__attribute__((target("avx2")))
+size_t Dec_Str_Scan_Avx2(const char *const digits_str, const size_t num_chars, size_t *const point_pos_ptr)
+{
+	const __m256i zero_chars = _mm256_set1_epi8('0'), nine_values = _mm256_set1_epi8(9), point_chars = _mm256_set1_epi8('.');
+	__m256i chars, values;
+	uint32_t digit_mask, point_mask, invalid_mask;
+	size_t str_pos;
+
+	*point_pos_ptr = num_chars;
+	for(str_pos = 0; str_pos + 32 <= num_chars; str_pos += 32)
+	{
+		chars = _mm256_loadu_si256((const __m256i *)(digits_str + str_pos));
+		values = _mm256_sub_epi8(chars, zero_chars);
+		digit_mask = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_max_epu8(values, nine_values), nine_values));
+		point_mask = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(chars, point_chars));
+		invalid_mask = ~(digit_mask | point_mask);
+		/* only first '.' char is valid, which is lowest bit of point_mask, if '.' char is not yet found */
+		invalid_mask |= (*point_pos_ptr == num_chars) ? (point_mask & (point_mask - 1)) : point_mask;
+		if(invalid_mask != 0)
+		{
+			return str_pos + (size_t)__builtin_ctz(invalid_mask);
+		}
+		if(point_mask != 0)
+		{
+			*point_pos_ptr = str_pos + (size_t)__builtin_ctz(point_mask);
+		}
+	}
+	for(; str_pos < num_chars; ++str_pos)
+	{
+		if(digits_str[str_pos] >= '0' && digits_str[str_pos] <= '9')
+		{
+			continue;
+		}
+		if(digits_str[str_pos] == '.' && *point_pos_ptr == num_chars)
+		{
+			*point_pos_ptr = str_pos;
+			continue;
+		}
+		break;
+	}
+	return str_pos;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Dec_Digits_To_Chunks_Avx2
+
+DESCRIPTION    : as of Dec_Digits_To_Chunks(), by AVX2 for 2 chunks per iteration
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           : first 16 digits of 2 chunks are loaded in 2 lanes. Adjacent digits are combined by multiply and add of
+                 _mm256_maddubs_epi16() into values of 2 digits, and by _mm256_madd_epi16() into values of 4 digits, then
+                 after pack into 16 bits, into values of 8 digits. Last 3 digits of chunk are added as of Dec_Digits_To_Chunks().
+
+Func ID        : 03.60
+
+BUGS           :
+-*------------------------------------------------------------*/
+__attribute__((target("avx2")))
+void Dec_Digits_To_Chunks_Avx2(big_num_limb_t *const chunk_ptr, const char *const digits_str, const size_t num_chunks)
+{
+	const __m256i zero_chars = _mm256_set1_epi8('0'), weights_10_1 = _mm256_set1_epi16(0x010A), weights_100_1 = _mm256_set1_epi32(0x00010064),
+	   weights_10000_1 = _mm256_set1_epi32(0x00012710);
+	__m256i values;
+	uint32_t values_8[8];
+	const char *chunk_str = digits_str;
+	size_t chunk_pos;
+
+	for(chunk_pos = num_chunks; chunk_pos >= 2; chunk_pos -= 2, chunk_str += 2 * BIG_NUM_LIMB_DEC_DIGITS)
+	{
+		values = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)chunk_str)),
+		   _mm_loadu_si128((const __m128i *)(chunk_str + BIG_NUM_LIMB_DEC_DIGITS)), 1);
+		values = _mm256_maddubs_epi16(_mm256_sub_epi8(values, zero_chars), weights_10_1);
+		values = _mm256_madd_epi16(values, weights_100_1);
+		values = _mm256_madd_epi16(_mm256_packus_epi32(values, values), weights_10000_1);
+		/* 8 digits values of first chunk are in 32 bits elements 0 and 1, and of second chunk are in elements 4 and 5 */
+		_mm256_storeu_si256((__m256i *)values_8, values);
+		chunk_ptr[chunk_pos - 1] = ((big_num_limb_t)values_8[0] * 100000000000ULL) + ((big_num_limb_t)values_8[1] * 1000)
+		   + (big_num_limb_t)((chunk_str[16] - '0') * 100 + (chunk_str[17] - '0') * 10 + (chunk_str[18] - '0'));
+		chunk_ptr[chunk_pos - 2] = ((big_num_limb_t)values_8[4] * 100000000000ULL) + ((big_num_limb_t)values_8[5] * 1000)
+		   + (big_num_limb_t)((chunk_str[35] - '0') * 100 + (chunk_str[36] - '0') * 10 + (chunk_str[37] - '0'));
+	}
+	if(chunk_pos != 0)
+	{
+		chunk_ptr[0] = ((big_num_limb_t)Dec_Digits8_To_Value(chunk_str) * 100000000000ULL) + ((big_num_limb_t)Dec_Digits8_To_Value(chunk_str + 8) * 1000)
+		   + (big_num_limb_t)((chunk_str[16] - '0') * 100 + (chunk_str[17] - '0') * 10 + (chunk_str[18] - '0'));
+	}
+}
+#endif
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_From_Dec_Chunks
+
+DESCRIPTION    : converts chunks of BIG_NUM_LIMB_DEC_DIGITS decimal digits, into limbs
+
+INPUT          : chunk_ptr has num_chunks chunks from least significant chunk, and each chunk is less than 10 ^ BIG_NUM_LIMB_DEC_DIGITS
+
+OUTPUT         : result has atmost num_chunks limbs, and num of limbs without leading zero limbs is stored in num_result_limbs_ptr
+
+NOTE           : upto STR_CONV_DC_THRESHOLD chunks, result is accumulated by (result * 10 ^ BIG_NUM_LIMB_DEC_DIGITS) + chunk.
+                 Otherwise, chunks are split at largest power of 2 (2 ^ level) chunks, less than num_chunks. Both parts are converted
+                 recursively, and result = high part * Big_Num_Pow10_Level(level) + low part, so that conversion costs about one
+                 multiplication of num_chunks limbs.
+
+Func ID        : 03.54
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Limbs_From_Dec_Chunks(big_num_limb_t *const result_ptr, size_t *const num_result_limbs_ptr, const big_num_limb_t *const chunk_ptr, const size_t num_chunks)
+{
+	const big_num_t *power_num_ptr;
+	big_num_limb_t *low_ptr, *high_ptr, carry;
+	size_t chunk_pos, num_limbs = 0, num_low_chunks = 1, num_low_limbs, num_high_limbs, level = 0;
+	uint16_t ret_status;
+
+	if(num_chunks <= STR_CONV_DC_THRESHOLD)
+	{
+		for(chunk_pos = num_chunks; chunk_pos > 0; --chunk_pos)
+		{
+			carry = Limbs_Mul_1(result_ptr, result_ptr, num_limbs, BIG_NUM_LIMB_DEC_BASE);
+			if(carry != 0)
+			{
+				result_ptr[num_limbs++] = carry;
+			}
+			carry = Limbs_Add_1(result_ptr, result_ptr, num_limbs, chunk_ptr[chunk_pos - 1]);
+			if(carry != 0)
+			{
+				result_ptr[num_limbs++] = carry;
+			}
+		}
+		*num_result_limbs_ptr = Limbs_Normalized_Len(result_ptr, num_limbs);
+		return SUCCESS;
+	}
+	while(2 * num_low_chunks < num_chunks)
+	{
+		num_low_chunks *= 2;
+		++level;
+	}
+	if((power_num_ptr = Big_Num_Pow10_Level(level)) == NULL_DATA_PTR)
+	{
+		return FAILURE;
+	}
+	if((low_ptr = Scratch_Alloc(num_chunks)) == NULL_DATA_PTR)
+	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("from str - memory alloc failed \n");
+		#endif
+		return FAILURE;
+	}
+	high_ptr = low_ptr + num_low_chunks;
+	ret_status = Limbs_From_Dec_Chunks(low_ptr, &num_low_limbs, chunk_ptr, num_low_chunks);
+	if(ret_status == SUCCESS)
+	{
+		ret_status = Limbs_From_Dec_Chunks(high_ptr, &num_high_limbs, chunk_ptr + num_low_chunks, num_chunks - num_low_chunks);
+	}
+	if(ret_status == SUCCESS)
+	{
+		num_limbs = 0;
+		if(num_high_limbs != 0)
+		{
+			// high part * 10 ^ (BIG_NUM_LIMB_DEC_DIGITS * num_low_chunks) is less than 2 ^ (BIG_NUM_LIMB_BITS * num_chunks)
+			ret_status = Limbs_Mul(result_ptr, high_ptr, num_high_limbs, power_num_ptr->limb_ptr, power_num_ptr->num_limbs);
+			num_limbs = num_high_limbs + power_num_ptr->num_limbs;
+		}
+		if(ret_status == SUCCESS && num_low_limbs != 0)
+		{
+			if(num_limbs == 0)
+			{
+				memcpy(result_ptr, low_ptr, num_low_limbs * sizeof(big_num_limb_t));
+				num_limbs = num_low_limbs;
+			}
+			else
+			{
+				// low part is less than power, so it has atmost num_limbs limbs
+				carry = Limbs_Add(result_ptr, result_ptr, num_limbs, low_ptr, num_low_limbs);
+				if(carry != 0)
+				{
+					result_ptr[num_limbs++] = carry;
+				}
+			}
+		}
+		*num_result_limbs_ptr = Limbs_Normalized_Len(result_ptr, num_limbs);
+	}
+	Scratch_Free(low_ptr);
+	return ret_status;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Limbs_To_Dec_Chunks
+
+DESCRIPTION    : converts limbs into num_chunks chunks of BIG_NUM_LIMB_DEC_DIGITS decimal digits
+
+INPUT          : limbs is less than 10 ^ (BIG_NUM_LIMB_DEC_DIGITS * num_chunks). num_limbs can be 0.
+
+OUTPUT         : chunk_ptr has num_chunks chunks from least significant chunk, padded with zero chunks
+
+NOTE           : upto STR_CONV_DC_THRESHOLD chunks, limbs are repeatedly divided by 10 ^ BIG_NUM_LIMB_DEC_DIGITS. Otherwise, limbs
+                 are divided by Big_Num_Pow10_Level(level) for largest power of 2 (2 ^ level) chunks less than num_chunks, and
+                 remainder and quotient are converted recursively into low and high chunks. From bz_div_threshold limbs of power,
+                 division multiplies by cached Big_Num_Pow10_Level_Inverse(level), which is found once for all divisions of a level.
+
+Func ID        : 03.55
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Limbs_To_Dec_Chunks(big_num_limb_t *const chunk_ptr, const size_t num_chunks, const big_num_limb_t *const limbs_ptr, const size_t num_limbs)
+{
+	const big_num_t *power_num_ptr;
+	const big_num_limb_t *inverse_ptr = NULL_DATA_PTR;
+	big_num_limb_t *temp_limb_ptr, stack_limbs[BIG_NUM_STACK_LIMBS];
+	size_t chunk_pos, num_temp_limbs, num_low_chunks = 1, num_quot_limbs, num_rem_limbs, level = 0;
+	uint16_t ret_status = SUCCESS;
+
+	num_temp_limbs = Limbs_Normalized_Len(limbs_ptr, num_limbs);
+	if(num_temp_limbs == 0)
+	{
+		memset(chunk_ptr, 0, num_chunks * sizeof(big_num_limb_t));
+		return SUCCESS;
+	}
+	if(num_chunks <= STR_CONV_DC_THRESHOLD)
+	{
+		temp_limb_ptr = stack_limbs;
+		if(num_temp_limbs > BIG_NUM_STACK_LIMBS && (temp_limb_ptr = Scratch_Alloc(num_temp_limbs)) == NULL_DATA_PTR)
+		{
+			#ifdef TRACE_ERROR
+			   Trace_Error("to str - memory alloc failed \n");
+			#endif
+			return FAILURE;
+		}
+		memcpy(temp_limb_ptr, limbs_ptr, num_temp_limbs * sizeof(big_num_limb_t));
+		for(chunk_pos = 0; chunk_pos < num_chunks; ++chunk_pos)
+		{
+			chunk_ptr[chunk_pos] = Limbs_Divmod_1(temp_limb_ptr, temp_limb_ptr, num_temp_limbs, BIG_NUM_LIMB_DEC_BASE);
+			if(num_temp_limbs > 0 && temp_limb_ptr[num_temp_limbs - 1] == 0)
+			{
+				--num_temp_limbs;
+			}
+		}
+		if(temp_limb_ptr != stack_limbs)
+		{
+			Scratch_Free(temp_limb_ptr);
+		}
+		return SUCCESS;
+	}
+	while(2 * num_low_chunks < num_chunks)
+	{
+		num_low_chunks *= 2;
+		++level;
+	}
+	if((power_num_ptr = Big_Num_Pow10_Level(level)) == NULL_DATA_PTR)
+	{
+		return FAILURE;
+	}
+	if(num_temp_limbs < power_num_ptr->num_limbs)
+	{
+		// limbs is less than power, so high chunks are 0
+		memset(chunk_ptr + num_low_chunks, 0, (num_chunks - num_low_chunks) * sizeof(big_num_limb_t));
+		return Limbs_To_Dec_Chunks(chunk_ptr, num_low_chunks, limbs_ptr, num_temp_limbs);
+	}
+	if(power_num_ptr->num_limbs >= bz_div_threshold && (inverse_ptr = Big_Num_Pow10_Level_Inverse(level)) == NULL_DATA_PTR)
+	{
+		return FAILURE;
+	}
+	num_quot_limbs = num_temp_limbs - power_num_ptr->num_limbs + 1;
+	num_rem_limbs = power_num_ptr->num_limbs;
+	if((temp_limb_ptr = Scratch_Alloc(num_quot_limbs + num_rem_limbs)) == NULL_DATA_PTR)
+	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("to str - memory alloc failed \n");
+		#endif
+		return FAILURE;
+	}
+	ret_status = Limbs_Divrem(temp_limb_ptr, temp_limb_ptr + num_quot_limbs, limbs_ptr, num_temp_limbs, power_num_ptr->limb_ptr, power_num_ptr->num_limbs, inverse_ptr);
+	if(ret_status == SUCCESS)
+	{
+		ret_status = Limbs_To_Dec_Chunks(chunk_ptr, num_low_chunks, temp_limb_ptr + num_quot_limbs, num_rem_limbs);
+	}
+	if(ret_status == SUCCESS)
+	{
+		ret_status = Limbs_To_Dec_Chunks(chunk_ptr + num_low_chunks, num_chunks - num_low_chunks, temp_limb_ptr, num_quot_limbs);
+	}
+	Scratch_Free(temp_limb_ptr);
+	return ret_status;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_Pow10_Level
+
+DESCRIPTION    : returns cached big num of 10 ^ (BIG_NUM_LIMB_DEC_DIGITS * 2 ^ level)
+
+INPUT          : level < POW10_CACHE_MAX_LEVELS
+
+OUTPUT         : returns NULL on failure
+
+NOTE           : levels are computed on first use, by squaring previous level, and kept in pow10_cache till end of program or
+                 Big_Num_Pow10_Cache_Clear(). Cache is locked, while levels are computed.
+
+Func ID        : 04.20
+
+BUGS           :
+-*------------------------------------------------------------*/
+const big_num_t *Big_Num_Pow10_Level(const size_t level)
+{
+	big_num_t *power_num_ptr;
+
+	if(level >= POW10_CACHE_MAX_LEVELS)
+	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("pow10 - level %lu exceeds cache \n", (unsigned long)level);
+		#endif
+		return NULL_DATA_PTR;
+	}
+	Pow10_Cache_Lock();
+	while(pow10_cache_num_levels <= level)
+	{
+		power_num_ptr = &pow10_cache[pow10_cache_num_levels];
+		Big_Num_Init(power_num_ptr);
+		if(pow10_cache_num_levels == 0)
+		{
+			if((Big_Num_Reserve(power_num_ptr, 1)) != SUCCESS)
+			{
+				Pow10_Cache_Unlock();
+				return NULL_DATA_PTR;
+			}
+			power_num_ptr->limb_ptr[0] = BIG_NUM_LIMB_DEC_BASE;
+			power_num_ptr->num_limbs = 1;
+		}
+		else if((Big_Num_Multiply(power_num_ptr, power_num_ptr - 1, power_num_ptr - 1)) != SUCCESS)
+		{
+			Big_Num_Free(power_num_ptr);
+			Pow10_Cache_Unlock();
+			return NULL_DATA_PTR;
+		}
+		++pow10_cache_num_levels;
+		pow10_cache_stats.cache_bytes += power_num_ptr->alloc_limbs * sizeof(big_num_limb_t);
+		if(pow10_cache_stats.cache_bytes > pow10_cache_stats.peak_cache_bytes)
+		{
+			pow10_cache_stats.peak_cache_bytes = pow10_cache_stats.cache_bytes;
+		}
+	}
+	Pow10_Cache_Unlock();
+	return &pow10_cache[level];
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_Pow10_Level_Inverse
+
+DESCRIPTION    : returns cached Limbs_Invert() of normalized Big_Num_Pow10_Level(level)
+
+INPUT          : level < POW10_CACHE_MAX_LEVELS
+
+OUTPUT         : returns (num_limbs + 1) limbs of inverse, where num_limbs is of Big_Num_Pow10_Level(level), or NULL on failure
+
+NOTE           : power is shifted, so that its most significant bit is set, as of Limbs_Divrem(). Inverse is computed on first use,
+                 and kept in pow10_cache_inverses with level, so that Limbs_To_Dec_Chunks() does not invert power for each division.
+
+Func ID        : 04.52
+
+BUGS           :
+-*------------------------------------------------------------*/
+const big_num_limb_t *Big_Num_Pow10_Level_Inverse(const size_t level)
+{
+	const big_num_t *power_num_ptr;
+	big_num_limb_t *inverse_ptr, *norm_power_ptr;
+	unsigned int shift_bits;
+
+	if((power_num_ptr = Big_Num_Pow10_Level(level)) == NULL_DATA_PTR)
+	{
+		return NULL_DATA_PTR;
+	}
+	Pow10_Cache_Lock();
+	if((inverse_ptr = pow10_cache_inverses[level]) == NULL_DATA_PTR)
+	{
+		inverse_ptr = malloc((power_num_ptr->num_limbs + 1) * sizeof(big_num_limb_t));
+		if(inverse_ptr == NULL_DATA_PTR || (norm_power_ptr = Scratch_Alloc(power_num_ptr->num_limbs)) == NULL_DATA_PTR)
+		{
+			free(inverse_ptr);
+			Pow10_Cache_Unlock();
+			#ifdef TRACE_ERROR
+			   Trace_Error("pow10 - memory alloc failed \n");
+			#endif
+			return NULL_DATA_PTR;
+		}
+		shift_bits = Limb_Count_Leading_Zeros(power_num_ptr->limb_ptr[power_num_ptr->num_limbs - 1]);
+		if(shift_bits == 0)
+		{
+			memcpy(norm_power_ptr, power_num_ptr->limb_ptr, power_num_ptr->num_limbs * sizeof(big_num_limb_t));
+		}
+		else
+		{
+			Limbs_Lshift(norm_power_ptr, power_num_ptr->limb_ptr, power_num_ptr->num_limbs, shift_bits);
+		}
+		if((Limbs_Invert(inverse_ptr, norm_power_ptr, power_num_ptr->num_limbs)) != SUCCESS)
+		{
+			Scratch_Free(norm_power_ptr);
+			free(inverse_ptr);
+			Pow10_Cache_Unlock();
+			return NULL_DATA_PTR;
+		}
+		Scratch_Free(norm_power_ptr);
+		pow10_cache_inverses[level] = inverse_ptr;
+		pow10_cache_stats.cache_bytes += (power_num_ptr->num_limbs + 1) * sizeof(big_num_limb_t);
+		if(pow10_cache_stats.cache_bytes > pow10_cache_stats.peak_cache_bytes)
+		{
+			pow10_cache_stats.peak_cache_bytes = pow10_cache_stats.cache_bytes;
+		}
+	}
+	Pow10_Cache_Unlock();
+	return inverse_ptr;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Pow10_Cache_Lock
+
+DESCRIPTION    : locks pow10 cache, which is shared by all threads
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           :
+
+Func ID        : 04.22
+
+BUGS           :
+-*------------------------------------------------------------*/
+static inline void Pow10_Cache_Lock(void)
+{
+	#ifdef BIG_NUM_PTHREADS
+	   pthread_mutex_lock(&pow10_cache_mutex);
+	#endif
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Pow10_Cache_Unlock
+
+DESCRIPTION    : unlocks pow10 cache
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           :
+
+Func ID        : 04.23
+
+BUGS           :
+-*------------------------------------------------------------*/
+static inline void Pow10_Cache_Unlock(void)
+{
+	#ifdef BIG_NUM_PTHREADS
+	   pthread_mutex_unlock(&pow10_cache_mutex);
+	#endif
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Pow10_Cache_Evict
+
+DESCRIPTION    : evicts least recently used entries of 10 ^ power, till num_bytes more bytes and num_new_entries more entries fit in pow10 cache
+
+INPUT          : pow10 cache must be locked
+
+OUTPUT         : returns SUCCESS, if num_bytes fits in max_cache_bytes after eviction
+
+NOTE           : levels are not evicted, as every str conversion of that size needs them again.
+
+Func ID        : 04.24
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Pow10_Cache_Evict(const size_t num_bytes, const size_t num_new_entries)
+{
+	size_t entry_pos, lru_entry_pos;
+
+	while(pow10_cache_num_entries != 0 && (pow10_cache_num_entries + num_new_entries > POW10_CACHE_MAX_ENTRIES
+	   || pow10_cache_stats.cache_bytes + num_bytes > pow10_cache_stats.max_cache_bytes))
+	{
+		lru_entry_pos = 0;
+		for(entry_pos = 1; entry_pos < pow10_cache_num_entries; ++entry_pos)
+		{
+			if(pow10_cache_entries[entry_pos].last_use < pow10_cache_entries[lru_entry_pos].last_use)
+			{
+				lru_entry_pos = entry_pos;
+			}
+		}
+		pow10_cache_stats.cache_bytes -= pow10_cache_entries[lru_entry_pos].power_num.alloc_limbs * sizeof(big_num_limb_t);
+		Big_Num_Free(&pow10_cache_entries[lru_entry_pos].power_num);
+		pow10_cache_entries[lru_entry_pos] = pow10_cache_entries[--pow10_cache_num_entries];
+		++pow10_cache_stats.num_evictions;
+	}
+	return (pow10_cache_stats.cache_bytes + num_bytes <= pow10_cache_stats.max_cache_bytes) ? SUCCESS : FAILURE;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_Pow10
+
+DESCRIPTION    : result = 10 ^ power
+
+INPUT          :
+
+OUTPUT         : precision digits and sign of result are 0 and positive
+
+NOTE           : result is copied from pow10 cache. On miss, 10 ^ power = 10 ^ (power % BIG_NUM_LIMB_DEC_DIGITS) * product of
+                 Big_Num_Pow10_Level(level) for set bits of (power / BIG_NUM_LIMB_DEC_DIGITS), which is then cached, if it fits
+                 in max cache bytes after least recently used entries are evicted. Cache is not locked while 10 ^ power is computed.
+
+Func ID        : 04.25
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Big_Num_Pow10(big_num_t *const result_num_ptr, const size_t power)
+{
+	const big_num_t *level_num_ptr;
+	big_num_t power_num;
+	big_num_limb_t carry;
+	size_t entry_pos, num_base_powers, level;
+	uint16_t ret_status = SUCCESS;
+
+	Pow10_Cache_Lock();
+	for(entry_pos = 0; entry_pos < pow10_cache_num_entries; ++entry_pos)
+	{
+		if(pow10_cache_entries[entry_pos].power == power)
+		{
+			pow10_cache_entries[entry_pos].last_use = ++pow10_cache_use_count;
+			++pow10_cache_stats.num_hits;
+			ret_status = Big_Num_Copy(result_num_ptr, &pow10_cache_entries[entry_pos].power_num);
+			Pow10_Cache_Unlock();
+			return ret_status;
+		}
+	}
+	++pow10_cache_stats.num_misses;
+	Pow10_Cache_Unlock();
+
+	Big_Num_Init(&power_num);
+	if((Big_Num_Reserve(&power_num, 1)) != SUCCESS)
+	{
+		return FAILURE;
+	}
+	power_num.limb_ptr[0] = limb_power_of_10[power % BIG_NUM_LIMB_DEC_DIGITS];
+	power_num.num_limbs = 1;
+	for(num_base_powers = power / BIG_NUM_LIMB_DEC_DIGITS, level = 0; num_base_powers != 0 && ret_status == SUCCESS; num_base_powers >>= 1, ++level)
+	{
+		if((num_base_powers & 1) == 0)
+		{
+			continue;
+		}
+		if((level_num_ptr = Big_Num_Pow10_Level(level)) == NULL_DATA_PTR)
+		{
+			ret_status = FAILURE;
+			break;
+		}
+		if(power_num.num_limbs == 1)
+		{
+			// power num of one limb is multiplied into level as limb
+			carry = power_num.limb_ptr[0];
+			if((ret_status = Big_Num_Copy(&power_num, level_num_ptr)) != SUCCESS || (ret_status = Big_Num_Reserve(&power_num, power_num.num_limbs + 1)) != SUCCESS)
+			{
+				break;
+			}
+			carry = Limbs_Mul_1(power_num.limb_ptr, power_num.limb_ptr, power_num.num_limbs, carry);
+			power_num.limb_ptr[power_num.num_limbs++] = carry;
+			Big_Num_Normalize(&power_num);
+			continue;
+		}
+		ret_status = Big_Num_Multiply(&power_num, &power_num, level_num_ptr);
+	}
+	if(ret_status == SUCCESS)
+	{
+		ret_status = Big_Num_Copy(result_num_ptr, &power_num);
+	}
+	if(ret_status != SUCCESS)
+	{
+		Big_Num_Free(&power_num);
+		return FAILURE;
+	}
+
+	Pow10_Cache_Lock();
+	// other thread might have cached same power, while it was computed
+	for(entry_pos = 0; entry_pos < pow10_cache_num_entries; ++entry_pos)
+	{
+		if(pow10_cache_entries[entry_pos].power == power)
+		{
+			break;
+		}
+	}
+	if(entry_pos == pow10_cache_num_entries && (Pow10_Cache_Evict(power_num.alloc_limbs * sizeof(big_num_limb_t), 1)) == SUCCESS)
+	{
+		// eviction moves last entry into evicted entry
+		entry_pos = pow10_cache_num_entries;
+		pow10_cache_entries[entry_pos].power = power;
+		pow10_cache_entries[entry_pos].last_use = ++pow10_cache_use_count;
+		// limbs of power num are moved into entry
+		pow10_cache_entries[entry_pos].power_num = power_num;
+		Big_Num_Init(&power_num);
+		++pow10_cache_num_entries;
+		pow10_cache_stats.cache_bytes += pow10_cache_entries[entry_pos].power_num.alloc_limbs * sizeof(big_num_limb_t);
+		if(pow10_cache_stats.cache_bytes > pow10_cache_stats.peak_cache_bytes)
+		{
+			pow10_cache_stats.peak_cache_bytes = pow10_cache_stats.cache_bytes;
+		}
+	}
+	Pow10_Cache_Unlock();
+	Big_Num_Free(&power_num);
+	return SUCCESS;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_Pow10_Cache_Stats
+
+DESCRIPTION    : gets statistics of pow10 cache
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           :
+
+Func ID        : 04.26
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Big_Num_Pow10_Cache_Stats(pow10_cache_stats_t *const stats_ptr)
+{
+	Pow10_Cache_Lock();
+	*stats_ptr = pow10_cache_stats;
+	stats_ptr->num_levels = pow10_cache_num_levels;
+	stats_ptr->num_entries = pow10_cache_num_entries;
+	Pow10_Cache_Unlock();
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_Pow10_Cache_Clear
+
+DESCRIPTION    : frees all levels, inverses of levels and entries of pow10 cache
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           : must not be called, while other threads use big nums. Statistics except max cache bytes are reset.
+
+Func ID        : 04.27
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Big_Num_Pow10_Cache_Clear(void)
+{
+	size_t pos;
+
+	Pow10_Cache_Lock();
+	for(pos = 0; pos < pow10_cache_num_levels; ++pos)
+	{
+		Big_Num_Free(&pow10_cache[pos]);
+		free(pow10_cache_inverses[pos]);
+		pow10_cache_inverses[pos] = NULL_DATA_PTR;
+	}
+	for(pos = 0; pos < pow10_cache_num_entries; ++pos)
+	{
+		Big_Num_Free(&pow10_cache_entries[pos].power_num);
+	}
+	pow10_cache_num_levels = 0;
+	pow10_cache_num_entries = 0;
+	pos = pow10_cache_stats.max_cache_bytes;
+	memset(&pow10_cache_stats, 0, sizeof(pow10_cache_stats));
+	pow10_cache_stats.max_cache_bytes = pos;
+	Pow10_Cache_Unlock();
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_Scratch_Stats
+
+DESCRIPTION    : gets statistics of scratch arena of calling thread
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           : peak bytes is high water mark of scratch of multiplication, division, modulus and str conversion since
+                 Big_Num_Scratch_Release(), which can be given to Big_Num_Scratch_Reserve() to size arena.
+
+Func ID        : 04.35
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Big_Num_Scratch_Stats(scratch_arena_stats_t *const stats_ptr)
+{
+	stats_ptr->arena_bytes = scratch_arena.alloc_limbs * sizeof(big_num_limb_t);
+	stats_ptr->used_bytes = (scratch_arena.num_used_limbs + scratch_arena.num_heap_limbs) * sizeof(big_num_limb_t);
+	stats_ptr->peak_bytes = scratch_arena.peak_limbs * sizeof(big_num_limb_t);
+	stats_ptr->num_allocs = scratch_arena.num_allocs;
+	stats_ptr->num_heap_allocs = scratch_arena.num_heap_allocs;
+	stats_ptr->max_arena_bytes = scratch_arena_max_bytes;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_Scratch_Reserve
+
+DESCRIPTION    : make sure that scratch arena of calling thread has atleast num_bytes bytes
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           : must not be called within a big num operation. num_bytes more than scratch_arena_max_bytes is allowed.
+
+Func ID        : 04.36
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Big_Num_Scratch_Reserve(const size_t num_bytes)
+{
+	const size_t num_limbs = (num_bytes + sizeof(big_num_limb_t) - 1) / sizeof(big_num_limb_t) + 1;
+
+	if(num_limbs <= scratch_arena.alloc_limbs)
+	{
+		return SUCCESS;
+	}
+	if(scratch_arena.num_used_limbs != 0 || scratch_arena.num_heap_limbs != 0 || (Scratch_Arena_Resize(num_limbs)) != SUCCESS)
+	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("scratch - arena of %lu bytes not reserved \n", (unsigned long)num_bytes);
+		#endif
+		return FAILURE;
+	}
+	return SUCCESS;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_Scratch_Release
+
+DESCRIPTION    : frees scratch arena of calling thread, and resets its statistics
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           : must not be called within a big num operation. A thread, that used big nums, calls it before exit,
+                 as thread local arena is not freed at thread exit.
+
+Func ID        : 04.37
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Big_Num_Scratch_Release(void)
+{
+	if(scratch_arena.num_used_limbs != 0 || scratch_arena.num_heap_limbs != 0)
+	{
+		return;
+	}
+	Scratch_Unmap(scratch_arena.limb_ptr, scratch_arena.alloc_limbs);
+	memset(&scratch_arena, 0, sizeof(scratch_arena));
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_Format
+
+DESCRIPTION    : converts limbs based big num, into big num in str, which is result_buf_ptr or allocated str
+
+INPUT          : if result_buf_ptr is NULL, str is allocated for exact num of chars
+
+OUTPUT         : returns str as of Dec_Chunks_Format(). Returns NULL on failure, or if result_buf_size is less than num of
+                 chars + 1, in which case result_len_ptr has num of chars still.
+
+NOTE           : magnitude is converted into chunks of BIG_NUM_LIMB_DEC_DIGITS digits by Limbs_To_Dec_Chunks(), which are
+                 written by Dec_Chunks_Format().
+
+Func ID        : 04.28
+
+BUGS           :
+-*------------------------------------------------------------*/
+char *Big_Num_Format(const big_num_t *const num_ptr, char *const result_buf_ptr, const size_t result_buf_size, size_t *const result_len_ptr)
+{
+	big_num_limb_t *chunk_ptr = NULL_DATA_PTR, stack_chunks[BIG_NUM_STACK_LIMBS];
+	char *result_ptr;
+	size_t num_limbs, num_chunks = 0;
+
+	if(num_ptr == NULL_DATA_PTR || result_len_ptr == NULL_DATA_PTR)
+	{
+		return NULL_DATA_PTR;
+	}
+	num_limbs = num_ptr->num_limbs;
+	if(num_limbs != 0)
+	{
+		// a limb has atmost 19.27 decimal digits
+		num_chunks = num_limbs + num_limbs / 64 + 2;
+		chunk_ptr = stack_chunks;
+		if(num_chunks > BIG_NUM_STACK_LIMBS && (chunk_ptr = Scratch_Alloc(num_chunks)) == NULL_DATA_PTR)
+		{
+			#ifdef TRACE_ERROR
+			   Trace_Error("to str - memory alloc failed \n");
+			#endif
+			return NULL_DATA_PTR;
+		}
+		if((Limbs_To_Dec_Chunks(chunk_ptr, num_chunks, num_ptr->limb_ptr, num_limbs)) != SUCCESS)
+		{
+			if(chunk_ptr != stack_chunks)
+			{
+				Scratch_Free(chunk_ptr);
+			}
+			return NULL_DATA_PTR;
+		}
+	}
+	result_ptr = Dec_Chunks_Format(chunk_ptr, num_chunks, num_ptr->precision_digits, num_ptr->sign_flag, result_buf_ptr, result_buf_size, result_len_ptr);
+	if(chunk_ptr != stack_chunks)
+	{
+		Scratch_Free(chunk_ptr);
+	}
+	return result_ptr;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Dec_Chunks_Format
+
+DESCRIPTION    : converts chunks of BIG_NUM_LIMB_DEC_DIGITS decimal digits with precision_digits digits after '.' char,
+                 into big num in str, which is result_buf_ptr or allocated str
+
+INPUT          : chunk_ptr has num_chunks chunks from least significant chunk, which can have zero chunks at most significant end.
+                 If result_buf_ptr is NULL, str is allocated for exact num of chars.
+
+OUTPUT         : returns str with optional '-' char, integer part without leading 0 (atleast one digit),
+                 and if precision_digits != 0, '.' char followed by precision_digits digits. result_len_ptr has num of chars of
+                 str, without null char. Returns NULL on failure, or if result_buf_size is less than num of chars + 1, in which
+                 case result_len_ptr has num of chars still.
+
+NOTE           : Digits, '.' char, leading '0' and sign are written in one pass from least significant digit. Zero has no sign.
+
+Func ID        : 03.77
+
+BUGS           :
+-*------------------------------------------------------------*/
+char *Dec_Chunks_Format(const big_num_limb_t *const chunk_ptr, size_t num_chunks, const size_t precision_digits, const uint8_t sign_flag,
+   char *const result_buf_ptr, const size_t result_buf_size, size_t *const result_len_ptr)
+{
+	big_num_limb_t chunk_value;
+	char *result_ptr = NULL_DATA_PTR;
+	size_t num_digits = 0, num_padded_digits, num_emitted_digits = 0, result_alloc_size, result_ptr_pos, chunk_pos, i;
+
+	while(num_chunks != 0 && chunk_ptr[num_chunks - 1] == 0)
+	{
+		--num_chunks;
+	}
+	if(num_chunks != 0)
+	{
+		num_digits = (num_chunks - 1) * BIG_NUM_LIMB_DEC_DIGITS;
+		for(chunk_value = chunk_ptr[num_chunks - 1]; chunk_value != 0; chunk_value /= 10)
+		{
+			++num_digits;
+		}
+	}
+	// digits are padded with leading 0, so that atleast one digit is before '.' char
+	num_padded_digits = (num_digits > precision_digits) ? num_digits : precision_digits + 1;
+	result_alloc_size = num_padded_digits + 1;
+	if(precision_digits != 0)
+	{
+		++result_alloc_size;
+	}
+	if(sign_flag == BIG_NUM_SIGN_NEGATIVE && num_digits != 0)
+	{
+		++result_alloc_size;
+	}
+	*result_len_ptr = result_alloc_size - 1;
+	if(result_buf_ptr == NULL_DATA_PTR)
+	{
+		result_ptr = malloc(result_alloc_size);
+	}
+	else if(result_buf_size >= result_alloc_size)
+	{
+		result_ptr = result_buf_ptr;
+	}
+	if(result_ptr == NULL_DATA_PTR)
+	{
+		#ifdef TRACE_ERROR
+		   if(result_buf_ptr == NULL_DATA_PTR)
+		   {
+			   Trace_Error("to str - memory alloc failed \n");
+		   }
+		   else
+		   {
+			   Trace_Error("to str - buf size %lu is less than %lu \n", (unsigned long)result_buf_size, (unsigned long)result_alloc_size);
+		   }
+		#endif
+		return NULL_DATA_PTR;
+	}
+	result_ptr[result_alloc_size - 1] = NULL_CHAR;
+	result_ptr_pos = result_alloc_size - 1;
+	// digits are written from least significant digit, and '.' char is placed after precision_digits digits
+	for(chunk_pos = 0; num_emitted_digits < num_padded_digits; ++chunk_pos)
+	{
+		chunk_value = (chunk_pos < num_chunks) ? chunk_ptr[chunk_pos] : 0;
+		for(i = 0; i < BIG_NUM_LIMB_DEC_DIGITS && num_emitted_digits < num_padded_digits; ++i)
+		{
+			if(num_emitted_digits == precision_digits && num_emitted_digits != 0)
+			{
+				result_ptr[--result_ptr_pos] = '.';
+			}
+			result_ptr[--result_ptr_pos] = (char)('0' + (chunk_value % 10));
+			chunk_value /= 10;
+			++num_emitted_digits;
+		}
+	}
+	if(result_ptr_pos == 1)
+	{
+		result_ptr[0] = '-';
+	}
+	return result_ptr;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Dec_Chunks_Shift_Right
+
+DESCRIPTION    : divides chunks of BIG_NUM_LIMB_DEC_DIGITS decimal digits by 10 ^ shift_digits, ie drops shift_digits least
+                 significant digits
+
+INPUT          : shift_digits is 1 to BIG_NUM_LIMB_DEC_DIGITS - 1. result_ptr can be same as chunk_ptr.
+
+OUTPUT         : result_ptr has num_chunks chunks
+
+NOTE           : low digits of next chunk become high digits of chunk, so that digits are moved in one pass, without limbs.
+
+Func ID        : 03.78
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Dec_Chunks_Shift_Right(big_num_limb_t *const result_ptr, const big_num_limb_t *const chunk_ptr, const size_t num_chunks, const size_t shift_digits)
+{
+	const big_num_limb_t shift_power = limb_power_of_10[shift_digits], high_power = limb_power_of_10[BIG_NUM_LIMB_DEC_DIGITS - shift_digits];
+	size_t chunk_pos;
+
+	for(chunk_pos = 0; chunk_pos < num_chunks; ++chunk_pos)
+	{
+		result_ptr[chunk_pos] = (chunk_ptr[chunk_pos] / shift_power) + ((chunk_pos + 1 < num_chunks) ? (chunk_ptr[chunk_pos + 1] % shift_power) * high_power : 0);
+	}
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Dec_Chunks_Add_Lazy
+
+DESCRIPTION    : adds chunks of BIG_NUM_LIMB_DEC_DIGITS decimal digits into redundant chunks, without propagating carries
+
+INPUT          : redundant chunk is low_ptr[] + carries_ptr[] * 2 ^ BIG_NUM_LIMB_BITS
+
+OUTPUT         :
+
+NOTE           : overflow of low limb is counted in its carry count, so that chunks are independent, and loop has no branch.
+
+Func ID        : 03.79
+
+BUGS           :
+-*------------------------------------------------------------*/
+static inline void Dec_Chunks_Add_Lazy(big_num_limb_t *const low_ptr, big_num_limb_t *const carries_ptr, const big_num_limb_t *const chunk_ptr, const size_t num_chunks)
+{
+	size_t chunk_pos;
+
+	for(chunk_pos = 0; chunk_pos < num_chunks; ++chunk_pos)
+	{
+		low_ptr[chunk_pos] += chunk_ptr[chunk_pos];
+		carries_ptr[chunk_pos] += (low_ptr[chunk_pos] < chunk_ptr[chunk_pos]);
+	}
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Dec_Chunks_Normalize
+
+DESCRIPTION    : propagates carries of redundant chunks, so that every chunk is less than 10 ^ BIG_NUM_LIMB_DEC_DIGITS
+
+INPUT          : redundant chunk is low_ptr[] + carries_ptr[] * 2 ^ BIG_NUM_LIMB_BITS, and every carry count is less than
+                 BIG_NUM_ACC_MAX_PENDING
+
+OUTPUT         : returns carry out of most significant chunk. low_ptr has chunks, and carries_ptr has zeros.
+
+NOTE           : chunk without carry count is atmost 2 ^ BIG_NUM_LIMB_BITS, which is less than 2 * 10 ^ BIG_NUM_LIMB_DEC_DIGITS,
+                 so that only chunk with carry count needs division by Limb_Div_2by1().
+
+Func ID        : 03.80
+
+BUGS           :
+-*------------------------------------------------------------*/
+big_num_limb_t Dec_Chunks_Normalize(big_num_limb_t *const low_ptr, big_num_limb_t *const carries_ptr, const size_t num_chunks)
+{
+	big_num_limb_t carry = 0, low_limb, high_limb;
+	size_t chunk_pos;
+
+	for(chunk_pos = 0; chunk_pos < num_chunks; ++chunk_pos)
+	{
+		low_limb = low_ptr[chunk_pos] + carry;
+		high_limb = carries_ptr[chunk_pos] + (low_limb < carry);
+		if(high_limb == 0)
+		{
+			carry = (low_limb >= BIG_NUM_LIMB_DEC_BASE) ? 1 : 0;
+			low_ptr[chunk_pos] = low_limb - (carry * BIG_NUM_LIMB_DEC_BASE);
+		}
+		else
+		{
+			carry = Limb_Div_2by1(high_limb, low_limb, BIG_NUM_LIMB_DEC_BASE, &low_ptr[chunk_pos]);
+			carries_ptr[chunk_pos] = 0;
+		}
+	}
+	return carry;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_To_Str
+
+DESCRIPTION    : converts limbs based big num, into big num in str
+
+INPUT          :
+
+OUTPUT         : returns allocated str, as of Big_Num_Format()
+
+NOTE           : Caller is responsible for freeing result memory.
+
+Func ID        : 04.09
+
+BUGS           :
+-*------------------------------------------------------------*/
+char *Big_Num_To_Str(const big_num_t *const num_ptr)
+{
+	size_t result_len;
+
+	return Big_Num_Format(num_ptr, NULL_DATA_PTR, 0, &result_len);
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_To_Buf
+
+DESCRIPTION    : converts limbs based big num, into big num in str in caller's buf of result_buf_size chars
+
+INPUT          :
+
+OUTPUT         : result_len_ptr has num of chars of str, without null char. On failure as buf is small, result_len_ptr still
+                 has num of chars, so that buf of (num of chars + 1) can be given again.
+
+NOTE           : no memory is allocated, for num upto BIG_NUM_STACK_LIMBS limbs.
+
+Func ID        : 04.29
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Big_Num_To_Buf(const big_num_t *const num_ptr, char *const result_buf_ptr, const size_t result_buf_size, size_t *const result_len_ptr)
+{
+	if(result_buf_ptr == NULL_DATA_PTR)
+	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("to buf - buf is null \n");
+		#endif
+		return FAILURE;
+	}
+	return (Big_Num_Format(num_ptr, result_buf_ptr, result_buf_size, result_len_ptr) != NULL_DATA_PTR) ? SUCCESS : FAILURE;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_Write
+
+DESCRIPTION    : writes limbs based big num in str, as of Big_Num_Format(), into out file
+
+INPUT          :
+
+OUTPUT         : returns FAILURE, if conversion or write failed
+
+NOTE           : magnitude is converted into chunks of BIG_NUM_LIMB_DEC_DIGITS digits by Limbs_To_Dec_Chunks(), which are
+                 written by Dec_Chunks_Write(), so that str of num is never in memory. No newline is written.
+
+Func ID        : 04.39
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Big_Num_Write(const big_num_t *const num_ptr, FILE *const out_file_ptr)
+{
+	big_num_limb_t *chunk_ptr = NULL_DATA_PTR, stack_chunks[BIG_NUM_STACK_LIMBS];
+	size_t num_limbs, num_chunks = 0;
+	uint16_t ret_status;
+
+	if(num_ptr == NULL_DATA_PTR || out_file_ptr == NULL_DATA_PTR)
+	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("write - big num or out file is null \n");
+		#endif
+		return FAILURE;
+	}
+	num_limbs = num_ptr->num_limbs;
+	if(num_limbs != 0)
+	{
+		// a limb has atmost 19.27 decimal digits
+		num_chunks = num_limbs + num_limbs / 64 + 2;
+		chunk_ptr = stack_chunks;
+		if(num_chunks > BIG_NUM_STACK_LIMBS && (chunk_ptr = Scratch_Alloc(num_chunks)) == NULL_DATA_PTR)
+		{
+			#ifdef TRACE_ERROR
+			   Trace_Error("write - memory alloc failed \n");
+			#endif
+			return FAILURE;
+		}
+		if((Limbs_To_Dec_Chunks(chunk_ptr, num_chunks, num_ptr->limb_ptr, num_limbs)) != SUCCESS)
+		{
+			if(chunk_ptr != stack_chunks)
+			{
+				Scratch_Free(chunk_ptr);
+			}
+			return FAILURE;
+		}
+	}
+	ret_status = Dec_Chunks_Write(chunk_ptr, num_chunks, num_ptr->precision_digits, num_ptr->sign_flag, out_file_ptr);
+	if(chunk_ptr != stack_chunks && chunk_ptr != NULL_DATA_PTR)
+	{
+		Scratch_Free(chunk_ptr);
+	}
+	return ret_status;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Dec_Chunks_Write
+
+DESCRIPTION    : writes num_chunks chunks of BIG_NUM_LIMB_DEC_DIGITS digits from least significant chunk, with precision_digits
+                 digits after '.' char, as of Dec_Chunks_Format(), into out file
+
+INPUT          : chunks can have leading zero chunks, and num_chunks can be 0
+
+OUTPUT         : returns FAILURE, if write failed
+
+NOTE           : digits are written from most significant chunk through buffer of BIG_NUM_WRITE_BUF_SIZE chars. No newline is written.
+
+Func ID        : 03.81
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Dec_Chunks_Write(const big_num_limb_t *const chunk_ptr, size_t num_chunks, const size_t precision_digits, const uint8_t sign_flag, FILE *const out_file_ptr)
+{
+	big_num_limb_t chunk_value;
+	char write_buf[BIG_NUM_WRITE_BUF_SIZE], chunk_digits[BIG_NUM_LIMB_DEC_DIGITS];
+	size_t num_digits = 0, num_padded_digits, digit_pos, chunk_pos, write_buf_len = 0, i;
+	uint16_t ret_status = SUCCESS;
+
+	while(num_chunks != 0 && chunk_ptr[num_chunks - 1] == 0)
+	{
+		--num_chunks;
+	}
+	if(num_chunks != 0)
+	{
+		num_digits = (num_chunks - 1) * BIG_NUM_LIMB_DEC_DIGITS;
+		for(chunk_value = chunk_ptr[num_chunks - 1]; chunk_value != 0; chunk_value /= 10)
+		{
+			++num_digits;
+		}
+	}
+	// digits are padded with leading 0, so that atleast one digit is before '.' char
+	num_padded_digits = (num_digits > precision_digits) ? num_digits : precision_digits + 1;
+	if(sign_flag == BIG_NUM_SIGN_NEGATIVE && num_digits != 0)
 	{
-		#ifdef TRACE_ERROR
-		   printf("ERR: memory allocation failed \n");
-		#endif
-		return FAILURE;
+		write_buf[write_buf_len++] = '-';
 	}
-	strcpy(big_num_datas_ptr->proc_str1_ptr, str1_ptr);
-    big_num_datas_ptr->proc_str1_precision_digits = 0;
-    proc_str1_ptr_pos = 0;
-	while (proc_str1_ptr_pos < big_num_datas_ptr->proc_str1_len)
+	// digit_pos is num of digits, that are not written yet, and '.' char is written after digit at pos precision_digits
+	for(digit_pos = num_padded_digits; digit_pos > 0 && ret_status == SUCCESS; )
 	{
-	   if(big_num_datas_ptr->proc_str1_ptr[proc_str1_ptr_pos] >= '0' && big_num_datas_ptr->proc_str1_ptr[proc_str1_ptr_pos] <= '9')
-	   {
-	   	   big_num_datas_ptr->proc_str1_ptr[proc_str1_ptr_pos] -= '0';
-		   ++proc_str1_ptr_pos;
-		   continue;
-	   }
-	   if(big_num_datas_ptr->proc_str1_precision_digits == 0 && big_num_datas_ptr->proc_str1_ptr[proc_str1_ptr_pos] == '.' )
+		chunk_pos = (digit_pos - 1) / BIG_NUM_LIMB_DEC_DIGITS;
+		chunk_value = (chunk_pos < num_chunks) ? chunk_ptr[chunk_pos] : 0;
+		for(i = BIG_NUM_LIMB_DEC_DIGITS; i > 0; --i)
+		{
+			chunk_digits[i - 1] = (char)('0' + (chunk_value % 10));
+			chunk_value /= 10;
+		}
+		for(i = BIG_NUM_LIMB_DEC_DIGITS - (digit_pos - chunk_pos * BIG_NUM_LIMB_DEC_DIGITS); i < BIG_NUM_LIMB_DEC_DIGITS; ++i)
+		{
+			write_buf[write_buf_len++] = chunk_digits[i];
+			if(--digit_pos == precision_digits && digit_pos != 0)
+			{
+				write_buf[write_buf_len++] = '.';
+			}
+		}
+		// buf has room for digits and '.' char of next chunk
+		if(write_buf_len > BIG_NUM_WRITE_BUF_SIZE - BIG_NUM_LIMB_DEC_DIGITS - 1 || digit_pos == 0)
+		{
+			if(fwrite(write_buf, 1, write_buf_len, out_file_ptr) != write_buf_len)
+			{
+				#ifdef TRACE_ERROR
+				   Trace_Error("write - out file write failed \n");
+				#endif
+				ret_status = FAILURE;
+			}
+			write_buf_len = 0;
+		}
+	}
+	return ret_status;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Bin_Put_Limb
+
+DESCRIPTION    : stores limb as 8 bytes little endian at bin_ptr
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           : bin_ptr need not be aligned
+
+Func ID        : 03.74
+
+BUGS           :
+-*------------------------------------------------------------*/
+static inline void Bin_Put_Limb(uint8_t *const bin_ptr, const big_num_limb_t limb)
+{
+	#ifdef BIG_NUM_LITTLE_ENDIAN
+	   memcpy(bin_ptr, &limb, sizeof(big_num_limb_t));
+	#else
+	   size_t byte_pos;
+
+	   for(byte_pos = 0; byte_pos < sizeof(big_num_limb_t); ++byte_pos)
 	   {
-		    --big_num_datas_ptr->proc_str1_len;
-            memmove(big_num_datas_ptr->proc_str1_ptr + proc_str1_ptr_pos , big_num_datas_ptr->proc_str1_ptr + proc_str1_ptr_pos + 1, (big_num_datas_ptr->proc_str1_len - proc_str1_ptr_pos));
-          	big_num_datas_ptr->proc_str1_ptr[big_num_datas_ptr->proc_str1_len] = NULL_CHAR;
-          	#ifdef TRACE_DATA
-          	   printf("TRA: decimal_pos: %u, frac_str1 = %s \n", proc_str1_ptr_pos, big_num_datas_ptr->proc_str1_ptr + proc_str1_ptr_pos);
-          	#endif
-            big_num_datas_ptr->proc_str1_precision_digits = big_num_datas_ptr->proc_str1_len - proc_str1_ptr_pos;
-            continue;
+		   bin_ptr[byte_pos] = (uint8_t)(limb >> (8 * byte_pos));
 	   }
-	   #ifdef TRACE_ERROR
-	      printf("ERR: str_1 has invalid char : %c at pos : %u \n", big_num_datas_ptr->proc_str1_ptr[proc_str1_ptr_pos], proc_str1_ptr_pos);
-	   #endif
-	   big_num_datas_ptr->proc_str1_precision_digits = 0;
-	   if(big_num_datas_ptr->proc_str1_ptr)
+	#endif
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Bin_Get_Limb
+
+DESCRIPTION    : loads limb from 8 bytes little endian at bin_ptr
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           : bin_ptr need not be aligned
+
+Func ID        : 03.75
+
+BUGS           :
+-*------------------------------------------------------------*/
+static inline big_num_limb_t Bin_Get_Limb(const uint8_t *const bin_ptr)
+{
+	big_num_limb_t limb = 0;
+
+	#ifdef BIG_NUM_LITTLE_ENDIAN
+	   memcpy(&limb, bin_ptr, sizeof(big_num_limb_t));
+	#else
+	   size_t byte_pos;
+
+	   for(byte_pos = sizeof(big_num_limb_t); byte_pos > 0; --byte_pos)
 	   {
-	       free(big_num_datas_ptr->proc_str1_ptr);
-	       big_num_datas_ptr->proc_str1_ptr = NULL_DATA_PTR;
+		   limb = (limb << 8) | bin_ptr[byte_pos - 1];
 	   }
-	   return FAILURE;
+	#endif
+	return limb;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Bin_Checksum_Mix
+
+DESCRIPTION    : mixes 64 bit word of binary big num into checksum
+
+INPUT          : checksum starts at BIG_NUM_BIN_CHECKSUM_SEED
+
+OUTPUT         : returns new checksum
+
+NOTE           : word is xored in, and is spread by multiply and xorshift, so that a changed bit or swapped words
+                 change checksum.
+
+Func ID        : 03.76
+
+BUGS           :
+-*------------------------------------------------------------*/
+static inline big_num_limb_t Bin_Checksum_Mix(big_num_limb_t checksum, const big_num_limb_t word)
+{
+	checksum = (checksum ^ word) * 0x9E3779B97F4A7C15ULL;
+	return checksum ^ (checksum >> 29);
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_Bin_Size
+
+DESCRIPTION    : num of bytes of big num in binary format
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           : binary format is header of BIG_NUM_BIN_HEADER_SIZE bytes, limbs and checksum, as of Big_Num_To_Bin().
+
+Func ID        : 04.40
+
+BUGS           :
+-*------------------------------------------------------------*/
+size_t Big_Num_Bin_Size(const big_num_t *const num_ptr)
+{
+	return BIG_NUM_BIN_HEADER_SIZE + (num_ptr->num_limbs * sizeof(big_num_limb_t)) + BIG_NUM_BIN_CHECKSUM_SIZE;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_To_Bin
+
+DESCRIPTION    : converts limbs based big num, into big num in binary format, which is result_buf_ptr or allocated bin
+
+INPUT          : if result_buf_ptr is NULL, bin is allocated for exact num of bytes
+
+OUTPUT         : returns bin of magic BIG_NUM_BIN_MAGIC, version BIG_NUM_BIN_VERSION, sign flag, 2 zero bytes, precision_digits,
+                 num_limbs, limbs from least significant limb and checksum, where each of last four is 64 bit little endian.
+                 result_len_ptr has num of bytes of bin. Returns NULL on failure, or if result_buf_size is less than num of
+                 bytes, in which case result_len_ptr has num of bytes still.
+
+NOTE           : checksum is of header and limbs by Bin_Checksum_Mix(), which is found, while limbs are stored. Binary big
+                 num is normalized, ie zero has no limbs and positive sign, and most significant limb is not zero.
+
+Func ID        : 04.41
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint8_t *Big_Num_To_Bin(const big_num_t *const num_ptr, uint8_t *const result_buf_ptr, const size_t result_buf_size, size_t *const result_len_ptr)
+{
+	uint8_t *result_ptr = NULL_DATA_PTR, *bin_ptr;
+	big_num_limb_t checksum = BIG_NUM_BIN_CHECKSUM_SEED;
+	size_t limb_pos, word_pos;
+
+	if(num_ptr == NULL_DATA_PTR || result_len_ptr == NULL_DATA_PTR)
+	{
+		return NULL_DATA_PTR;
 	}
-	big_num_datas_ptr->proc_str2_ptr = malloc(big_num_datas_ptr->proc_str2_len + 1);
-	if(big_num_datas_ptr->proc_str2_ptr == NULL_DATA_PTR)
+	*result_len_ptr = Big_Num_Bin_Size(num_ptr);
+	if(result_buf_ptr == NULL_DATA_PTR)
 	{
-	   if(big_num_datas_ptr->proc_str1_ptr)
-	   {
-	      free(big_num_datas_ptr->proc_str1_ptr);
-	      big_num_datas_ptr->proc_str1_ptr = NULL_DATA_PTR;
-	   }
-	   return FAILURE;
+		result_ptr = malloc(*result_len_ptr);
 	}
-	strcpy(big_num_datas_ptr->proc_str2_ptr, str2_ptr);
-	big_num_datas_ptr->proc_str2_precision_digits = 0;
-	proc_str2_ptr_pos = 0;
-	while( proc_str2_ptr_pos < big_num_datas_ptr->proc_str2_len )
+	else if(result_buf_size >= *result_len_ptr)
 	{
-	   if(big_num_datas_ptr->proc_str2_ptr[proc_str2_ptr_pos] >= '0' && big_num_datas_ptr->proc_str2_ptr[proc_str2_ptr_pos] <= '9')
-	   {
-	   	   big_num_datas_ptr->proc_str2_ptr[proc_str2_ptr_pos] -= '0';
-	   	   ++proc_str2_ptr_pos;
-		   continue;
-	   }
-	   if(big_num_datas_ptr->proc_str2_precision_digits == 0 && big_num_datas_ptr->proc_str2_ptr[proc_str2_ptr_pos] == '.' )
-	   {
-		   --big_num_datas_ptr->proc_str2_len;
-		   memmove(big_num_datas_ptr->proc_str2_ptr + proc_str2_ptr_pos , big_num_datas_ptr->proc_str2_ptr + proc_str2_ptr_pos + 1, (big_num_datas_ptr->proc_str2_len - proc_str2_ptr_pos));
-		   big_num_datas_ptr->proc_str2_ptr[big_num_datas_ptr->proc_str2_len] = NULL_CHAR;
-		   	#ifdef TRACE_DATA
-          	   printf("TRA: decimal_pos: %u, frac_str2 = %s \n", proc_str2_ptr_pos, big_num_datas_ptr->proc_str2_ptr + proc_str2_ptr_pos);
-          	#endif
-	    	big_num_datas_ptr->proc_str2_precision_digits = big_num_datas_ptr->proc_str2_len - proc_str2_ptr_pos;
-		   continue;
-	   }
-	   #ifdef TRACE_ERROR
-	      printf("ERR: str_2 has invalid char : %c at pos : %u \n", big_num_datas_ptr->proc_str2_ptr[proc_str2_ptr_pos], proc_str2_ptr_pos);
-	   #endif
-	   if(big_num_datas_ptr->proc_str1_ptr)
-	   {
-	      free(big_num_datas_ptr->proc_str1_ptr);
-	      big_num_datas_ptr->proc_str1_ptr = NULL_DATA_PTR;
-	   }
-	   if(big_num_datas_ptr->proc_str2_ptr)
-	   {
-	      free(big_num_datas_ptr->proc_str2_ptr);
-	      big_num_datas_ptr->proc_str2_ptr = NULL_DATA_PTR;
-	   }
-	   return FAILURE;
+		result_ptr = result_buf_ptr;
 	}
-	switch(big_num_arithmetic_oper)
+	if(result_ptr == NULL_DATA_PTR)
 	{
-		case BIG_NUMS_SUM_OPER:
-		case BIG_NUMS_SUBTRACT_OPER:
-		  for(proc_str1_ptr_pos = 0; proc_str1_ptr_pos < big_num_datas_ptr->proc_str1_len; ++proc_str1_ptr_pos)
-	       {
-			   if(big_num_datas_ptr->proc_str1_ptr[proc_str1_ptr_pos] != 0)
-			   {
-				   break;
-			   }
-		   }
-		   if(proc_str1_ptr_pos < big_num_datas_ptr->proc_str1_len)
-		   {
-			    break;
-		   }
-		   proc_bit_field |= (1 << 1);
-           for(proc_str2_ptr_pos = 0; proc_str2_ptr_pos < big_num_datas_ptr->proc_str2_len; ++proc_str2_ptr_pos)
-	       {
-			   if(big_num_datas_ptr->proc_str2_ptr[proc_str2_ptr_pos] != 0)
-			   {
-				   break;
-			   }
-		   }
-		   if(proc_str2_ptr_pos < big_num_datas_ptr->proc_str2_len)
-		   {
-			   break;
-		   }
-           if((proc_bit_field & (1 << 1)))
-		   {
-			   proc_bit_field |= (1 << 2);
-			   req_num_0_char_digits = 2;
-			   goto big_num_result_proc;
-		   }
-		break;
-		case BIG_NUMS_MULTIPLY_OPER:
-		   for(proc_str1_ptr_pos = 0; proc_str1_ptr_pos < big_num_datas_ptr->proc_str1_len; ++proc_str1_ptr_pos)
-	       {
-			   if(big_num_datas_ptr->proc_str1_ptr[proc_str1_ptr_pos] != 0)
-			   {
-				   break;
-			   }
-		   }
-		   if(proc_str1_ptr_pos == big_num_datas_ptr->proc_str1_len)
-		   {
-			   proc_bit_field |= (1 << 2);
-			   req_num_0_char_digits = 2;
-			   goto big_num_result_proc;
-	       }
-		   for(proc_str2_ptr_pos = 0; proc_str2_ptr_pos < big_num_datas_ptr->proc_str2_len; ++proc_str2_ptr_pos)
-	       {
-			   if(big_num_datas_ptr->proc_str2_ptr[proc_str2_ptr_pos] != 0)
-			   {
-				   break;
-			   }
-		   }
-		   if(proc_str2_ptr_pos == big_num_datas_ptr->proc_str2_len)
-		   {
-		       proc_bit_field |= (1 << 2);
-			   req_num_0_char_digits = 2;
-			   goto big_num_result_proc;
-	       }
-		break;
-		case BIG_NUMS_DIVISION_OPER:
-		case BIG_NUMS_MODULUS_OPER:
-		   if(big_num_arithmetic_oper == BIG_NUMS_MODULUS_OPER)
+		#ifdef TRACE_ERROR
+		   if(result_buf_ptr == NULL_DATA_PTR)
 		   {
-			   if(big_num_datas_ptr->proc_str1_precision_digits != 0 || big_num_datas_ptr->proc_str2_precision_digits != 0)
-			   {
-				   #ifdef TRACE_ERROR
-			         printf("ERR: %s or %s are non integer \n", big_num_datas_ptr->operand_str1, big_num_datas_ptr->operand_str2);
-			       #endif
-				   if(big_num_datas_ptr->proc_str1_ptr)
-	               {
-	                   free(big_num_datas_ptr->proc_str1_ptr);
-	                   big_num_datas_ptr->proc_str1_ptr = NULL_DATA_PTR;
-	               }
-	               if(big_num_datas_ptr->proc_str2_ptr)
-	               {
-	                   free(big_num_datas_ptr->proc_str2_ptr);
-	                   big_num_datas_ptr->proc_str2_ptr = NULL_DATA_PTR;
-	               }
-	                return FAILURE;
-			   }
-		   }
-		   for(proc_str2_ptr_pos = 0; proc_str2_ptr_pos < big_num_datas_ptr->proc_str2_len; ++proc_str2_ptr_pos)
-	       {
-			   if(big_num_datas_ptr->proc_str2_ptr[proc_str2_ptr_pos] != 0)
-			   {
-				   break;
-			   }
+			   Trace_Error("to bin - memory alloc failed \n");
 		   }
-		   if(proc_str2_ptr_pos == big_num_datas_ptr->proc_str2_len)
-		   {
-		      proc_bit_field = (1 << 0);
-	       }
 		   else
 		   {
-		       proc_str1_ptr_pos = proc_str2_ptr_pos;
-		       for(proc_str2_ptr_pos = 0; proc_str2_ptr_pos < big_num_datas_ptr->proc_str2_len; ++proc_str2_ptr_pos)
-	           {
-			       big_num_datas_ptr->proc_str2_ptr[proc_str2_ptr_pos] += '0';
-		       }
-               big_num_datas_ptr->proc_str2_ptr[proc_str2_ptr_pos] = NULL_CHAR;
-		       big_num_datas_ptr->proc_str2_len -= proc_str1_ptr_pos;
-               memmove(big_num_datas_ptr->proc_str2_ptr, big_num_datas_ptr->proc_str2_ptr + proc_str1_ptr_pos, big_num_datas_ptr->proc_str2_len + 1 );
-               for(proc_str2_ptr_pos = 0; proc_str2_ptr_pos < big_num_datas_ptr->proc_str2_len; ++proc_str2_ptr_pos)
-	           {
-			       big_num_datas_ptr->proc_str2_ptr[proc_str2_ptr_pos] -= '0';
-		       }
-		       big_num_datas_ptr->proc_str2_ptr[proc_str2_ptr_pos] = NULL_CHAR;
-		   }
-		   for(proc_str1_ptr_pos = 0; proc_str1_ptr_pos < big_num_datas_ptr->proc_str1_len; ++proc_str1_ptr_pos)
-	       {
-			   if(big_num_datas_ptr->proc_str1_ptr[proc_str1_ptr_pos] != 0)
-			   {
-				   break;
-			   }
-		   }
-		   if(proc_str1_ptr_pos == big_num_datas_ptr->proc_str1_len)
-		   {
-			   if((proc_bit_field & (1 << 0)))
-			   {
-				    printf("ERR: 0 / 0 = indetermined \n");
-					if(big_num_datas_ptr->proc_str1_ptr)
-			        {
-			           free(big_num_datas_ptr->proc_str1_ptr);
-			           big_num_datas_ptr->proc_str1_ptr = NULL_DATA_PTR;
-			        }
-			        if(big_num_datas_ptr->proc_str2_ptr)
-			        {
-	                    free(big_num_datas_ptr->proc_str2_ptr);
-			            big_num_datas_ptr->proc_str2_ptr = NULL_DATA_PTR;
-			        }
-				    return FAILURE;
-			   }
-			   proc_bit_field |= (1 << 2);
-			   req_num_0_char_digits = num_precision_digits + 1;
-			   goto big_num_result_proc;
-		   }
-		   if((proc_bit_field & (1 << 0)))
-		   {
-			    printf("ERR: %s / 0 = ", big_num_datas_ptr->operand_str1);
-				if(big_num_datas_ptr->operand_str1[0] == '-')
-				{
-					printf("negative Infinity \n");
-				}
-				else
-				{
-					printf("positive Infinity \n");
-				}
-				if(big_num_datas_ptr->proc_str1_ptr)
-			    {
-			          free(big_num_datas_ptr->proc_str1_ptr);
-			          big_num_datas_ptr->proc_str1_ptr = NULL_DATA_PTR;
-			    }
-			    if(big_num_datas_ptr->proc_str2_ptr)
-			    {
-	                 free(big_num_datas_ptr->proc_str2_ptr);
-			         big_num_datas_ptr->proc_str2_ptr = NULL_DATA_PTR;
-			    }
-			   return FAILURE;
-		   }
-		   proc_str2_ptr_pos = proc_str1_ptr_pos;
-		   for(proc_str1_ptr_pos = 0; proc_str1_ptr_pos < big_num_datas_ptr->proc_str1_len; ++proc_str1_ptr_pos)
-	       {
-			   big_num_datas_ptr->proc_str1_ptr[proc_str1_ptr_pos] += '0';
-		   }
-           big_num_datas_ptr->proc_str1_ptr[proc_str1_ptr_pos] = NULL_CHAR;
-		   big_num_datas_ptr->proc_str1_len -= proc_str2_ptr_pos;
-           memmove(big_num_datas_ptr->proc_str1_ptr, big_num_datas_ptr->proc_str1_ptr + proc_str2_ptr_pos, big_num_datas_ptr->proc_str1_len + 1 );
-           for(proc_str1_ptr_pos = 0; proc_str1_ptr_pos < big_num_datas_ptr->proc_str1_len; ++proc_str1_ptr_pos)
-	       {
-			   big_num_datas_ptr->proc_str1_ptr[proc_str1_ptr_pos] -= '0';
+			   Trace_Error("to bin - buf size %lu is less than %lu \n", (unsigned long)result_buf_size, (unsigned long)*result_len_ptr);
 		   }
-		   big_num_datas_ptr->proc_str1_ptr[proc_str1_ptr_pos] = NULL_CHAR;
-		break;
+		#endif
+		return NULL_DATA_PTR;
 	}
-	big_num_result_proc:
-	if((proc_bit_field & (1 << 2)))
-	{
-		 // result_alloc_size included for '.' char
-	      big_num_datas_ptr->result_alloc_size = req_num_0_char_digits + 1 + 1;
-	      big_num_datas_ptr->result_ptr = calloc(big_num_datas_ptr->result_alloc_size, sizeof(char));
-	      if(big_num_datas_ptr->result_ptr == NULL_DATA_PTR)
-	      {
-		      	#ifdef TRACE_ERROR
-		             printf("ERR: memory alloc failed \n");
-		        #endif
-    		    if(big_num_datas_ptr->proc_str1_ptr)
-			    {
-			         free(big_num_datas_ptr->proc_str1_ptr);
-			         big_num_datas_ptr->proc_str1_ptr = NULL_DATA_PTR;
-			    }
-			    if(big_num_datas_ptr->proc_str2_ptr)
-			    {
-	                 free(big_num_datas_ptr->proc_str2_ptr);
-			         big_num_datas_ptr->proc_str2_ptr = NULL_DATA_PTR;
-			    }
-			    return FAILURE;
-		  }
-		  for(result_ptr_pos = 0; result_ptr_pos < big_num_datas_ptr->result_alloc_size - 1; ++result_ptr_pos)
-	      {
-	          if(result_ptr_pos == 1)
-		      {
-			       	big_num_datas_ptr->result_ptr[result_ptr_pos] = '.';
-			        continue;
-			  }
-			  big_num_datas_ptr->result_ptr[result_ptr_pos] = '0';
-		 }
-		 big_num_datas_ptr->result_ptr[result_ptr_pos] = NULL_CHAR;
-		 if(big_num_datas_ptr->proc_str1_ptr)
-		 {
-		      free(big_num_datas_ptr->proc_str1_ptr);
-		      big_num_datas_ptr->proc_str1_ptr = NULL_DATA_PTR;
-		 }
-		 if(big_num_datas_ptr->proc_str2_ptr)
-		 {
-	          free(big_num_datas_ptr->proc_str2_ptr);
-		      big_num_datas_ptr->proc_str2_ptr = NULL_DATA_PTR;
-		 }
-		 return SUCCESS;
-	 }
-	#ifdef TRACE_DATA
-	   printf("TRA: proc_str1_len = %u, proc_str2_len = %u \n", big_num_datas_ptr->proc_str1_len, big_num_datas_ptr->proc_str2_len);
-	#endif
-	return SUCCESS;
+	memcpy(result_ptr, BIG_NUM_BIN_MAGIC, 4);
+	result_ptr[4] = BIG_NUM_BIN_VERSION;
+	result_ptr[5] = (num_ptr->num_limbs != 0) ? num_ptr->sign_flag : BIG_NUM_SIGN_POSITIVE;
+	result_ptr[6] = 0;
+	result_ptr[7] = 0;
+	Bin_Put_Limb(result_ptr + 8, (big_num_limb_t)num_ptr->precision_digits);
+	Bin_Put_Limb(result_ptr + 16, (big_num_limb_t)num_ptr->num_limbs);
+	for(word_pos = 0; word_pos < BIG_NUM_BIN_HEADER_SIZE; word_pos += sizeof(big_num_limb_t))
+	{
+		checksum = Bin_Checksum_Mix(checksum, Bin_Get_Limb(result_ptr + word_pos));
+	}
+	bin_ptr = result_ptr + BIG_NUM_BIN_HEADER_SIZE;
+	for(limb_pos = 0; limb_pos < num_ptr->num_limbs; ++limb_pos, bin_ptr += sizeof(big_num_limb_t))
+	{
+		Bin_Put_Limb(bin_ptr, num_ptr->limb_ptr[limb_pos]);
+		checksum = Bin_Checksum_Mix(checksum, num_ptr->limb_ptr[limb_pos]);
+	}
+	Bin_Put_Limb(bin_ptr, checksum);
+	return result_ptr;
 }
 
 /*------------------------------------------------------------*
-FUNCTION NAME  : Big_Nums_Multiply
+FUNCTION NAME  : Big_Num_From_Bin
 
-DESCRIPTION    :  Multiplies str1 and str2, and find result
+DESCRIPTION    : converts big num in bin_len bytes of binary format, into limbs based big num
 
-INPUT          :
+INPUT          : bin is as of Big_Num_To_Bin()
 
 OUTPUT         :
 
-NOTE           :  Caller is responsible for freeing result memory.
+NOTE           : magic, version, sign flag, zero bytes, num of bytes and checksum are validated, before num is changed, so that
+                 num is unchanged on failure. Limbs of num are reused, if they are enough. As of operand str of Validate_Big_Num_Data(), precision_digits is atmost
+                 max_operand_len, and num of limbs is atmost that of max_operand_len digits, so that bin of few bytes cannot
+                 make an operation of unbounded size.
 
-Func ID        : 01.03
+Func ID        : 04.42
 
 BUGS           :
 -*------------------------------------------------------------*/
-char *Big_Nums_Multiply(const char *const mul_str1, const char *const mul_str2)
+uint16_t Big_Num_From_Bin(big_num_t *const num_ptr, const uint8_t *const bin_ptr, const size_t bin_len)
 {
-    big_num_datas_t multiply_big_num_datas;
-	char *temp_ptr;
-	int16_t proc_str1_ptr_pos = 0, proc_str2_ptr_pos = 0, result_ptr_pos = 0;
-	uint8_t i, result_ptr_init_pos;
+	big_num_limb_t checksum = BIG_NUM_BIN_CHECKSUM_SEED, precision_digits, num_limbs;
+	size_t limb_pos, word_pos;
 
-	#ifdef TRACE_FLOW
-	   printf("TRA: In Big num, %s * %s \n", mul_str1, mul_str2);
-	#endif
-	multiply_big_num_datas.operand_str1 = mul_str1;
-	multiply_big_num_datas.operand_str2 = mul_str2;
-	if((Validate_Big_Num_Data(BIG_NUMS_MULTIPLY_OPER, RESULT_BASED_PRECISION_DIGITS, &multiply_big_num_datas)) != SUCCESS)
-    {
-		return NULL_DATA_PTR;
-	}
-	if(multiply_big_num_datas.result_ptr != NULL_DATA_PTR)
+	if(num_ptr == NULL_DATA_PTR || bin_ptr == NULL_DATA_PTR)
 	{
-		return multiply_big_num_datas.result_ptr;
+		#ifdef TRACE_ERROR
+		   Trace_Error("big num or bin is null \n");
+		#endif
+		return FAILURE;
 	}
-	//result_alloc_size is included for NULL_CHAR at end of result_ptr
-	multiply_big_num_datas.result_alloc_size = multiply_big_num_datas.proc_str1_len + multiply_big_num_datas.proc_str2_len + 1;
-	i = 0;
-    if((mul_str1[0] == '-' && mul_str2[0] != '-') || (mul_str1[0] != '-' && mul_str2[0] == '-'))
+	if(bin_len < BIG_NUM_BIN_HEADER_SIZE + BIG_NUM_BIN_CHECKSUM_SIZE || memcmp(bin_ptr, BIG_NUM_BIN_MAGIC, 4) != 0 || bin_ptr[4] != BIG_NUM_BIN_VERSION)
 	{
-		i = 1;
-		++multiply_big_num_datas.result_alloc_size;
+		#ifdef TRACE_ERROR
+		   Trace_Error("bin is short, or has invalid magic or version \n");
+		#endif
+		return FAILURE;
 	}
-	if(multiply_big_num_datas.proc_str1_precision_digits != 0 || multiply_big_num_datas.proc_str2_precision_digits != 0 )
+	precision_digits = Bin_Get_Limb(bin_ptr + 8);
+	num_limbs = Bin_Get_Limb(bin_ptr + 16);
+	// num of max_operand_len digits is less than 10 ^ max_operand_len, which has atmost one limb per BIG_NUM_LIMB_DEC_DIGITS digits
+	if(precision_digits > max_operand_len || num_limbs > max_operand_len / BIG_NUM_LIMB_DEC_DIGITS + 1)
 	{
-		multiply_big_num_datas.result_str_precision_digits = multiply_big_num_datas.proc_str1_precision_digits + multiply_big_num_datas.proc_str2_precision_digits;
-		//result_alloc_size is included for '0' at begin before '.' char and '.' char
-		multiply_big_num_datas.result_alloc_size += 2;
+		#ifdef TRACE_ERROR
+		   Trace_Error("bin precision digits or num of limbs exceeds max operand len : %lu \n", (unsigned long)max_operand_len);
+		#endif
+		return FAILURE;
 	}
-	multiply_big_num_datas.result_ptr = calloc(multiply_big_num_datas.result_alloc_size, sizeof(char));
-	if(multiply_big_num_datas.proc_str1_ptr == NULL_DATA_PTR || multiply_big_num_datas.proc_str2_ptr == NULL_DATA_PTR || multiply_big_num_datas.result_ptr == NULL_DATA_PTR)
+	if(bin_ptr[5] > BIG_NUM_SIGN_NEGATIVE || bin_ptr[6] != 0 || bin_ptr[7] != 0 ||
+	   num_limbs != (bin_len - BIG_NUM_BIN_HEADER_SIZE - BIG_NUM_BIN_CHECKSUM_SIZE) / sizeof(big_num_limb_t) ||
+	   (bin_len - BIG_NUM_BIN_HEADER_SIZE - BIG_NUM_BIN_CHECKSUM_SIZE) % sizeof(big_num_limb_t) != 0)
 	{
 		#ifdef TRACE_ERROR
-		   printf("ERR: mul - memory address is NULL \n");
+		   Trace_Error("bin has invalid header or num of bytes : %lu \n", (unsigned long)bin_len);
 		#endif
-		if(multiply_big_num_datas.proc_str1_ptr)
-		{
-			free(multiply_big_num_datas.proc_str1_ptr);
-		}
-		if(multiply_big_num_datas.proc_str2_ptr)
-		{
-			free(multiply_big_num_datas.proc_str2_ptr);
-		}
-		if(multiply_big_num_datas.result_ptr)
-		{
-			free(multiply_big_num_datas.result_ptr);
-		}
-		return NULL_DATA_PTR;
+		return FAILURE;
 	}
-	#ifdef TRACE_DATA
-	   printf("TRA: mul - result alloc size = %u \n", multiply_big_num_datas.result_alloc_size);
-	#endif
-	if(i == 1)
+	// header and limbs of bin are words, which are all mixed into checksum
+	for(word_pos = 0; word_pos < bin_len - BIG_NUM_BIN_CHECKSUM_SIZE; word_pos += sizeof(big_num_limb_t))
 	{
-		multiply_big_num_datas.result_ptr[0] = '-';
+		checksum = Bin_Checksum_Mix(checksum, Bin_Get_Limb(bin_ptr + word_pos));
 	}
-	/* grade-school method of multiplication */
-	for (proc_str1_ptr_pos = multiply_big_num_datas.proc_str1_len - 1; proc_str1_ptr_pos >= 0; proc_str1_ptr_pos--)
+	if(checksum != Bin_Get_Limb(bin_ptr + bin_len - BIG_NUM_BIN_CHECKSUM_SIZE))
 	{
-		uint32_t carry = 0;
-
-		result_ptr_init_pos = proc_str1_ptr_pos + multiply_big_num_datas.proc_str2_len;
-		if(multiply_big_num_datas.result_ptr[0] == '-')
-		{
-			++result_ptr_init_pos;
-		}
-		for (proc_str2_ptr_pos = multiply_big_num_datas.proc_str2_len - 1, result_ptr_pos = result_ptr_init_pos; proc_str2_ptr_pos >= 0; proc_str2_ptr_pos--, result_ptr_pos--)
-		{
-			uint32_t n = multiply_big_num_datas.proc_str1_ptr[proc_str1_ptr_pos] * multiply_big_num_datas.proc_str2_ptr[proc_str2_ptr_pos] + multiply_big_num_datas.result_ptr[result_ptr_pos] + carry;
-			multiply_big_num_datas.result_ptr[result_ptr_pos] = (n % 10);
-			carry = n / 10;
-			#ifdef TRACE_DATA
-			   printf("TRA: mul - str1[%d] = %u, str2[%d] = %u, result[%d] = %u, carry = %u \n", proc_str1_ptr_pos, multiply_big_num_datas.proc_str1_ptr[proc_str1_ptr_pos],
-			    proc_str2_ptr_pos,  multiply_big_num_datas.proc_str2_ptr[proc_str2_ptr_pos], result_ptr_pos, multiply_big_num_datas.result_ptr[result_ptr_pos], carry);
-			#endif
-		}
-		multiply_big_num_datas.result_ptr[result_ptr_pos] += carry;
-		#ifdef TRACE_DATA
-		   printf("TRA: mul - result[%d] = %u, carry = %u \n", result_ptr_pos, multiply_big_num_datas.result_ptr[result_ptr_pos], carry);
+		#ifdef TRACE_ERROR
+		   Trace_Error("bin checksum mismatch \n");
 		#endif
+		return FAILURE;
 	}
-	if(multiply_big_num_datas.result_ptr[0] != '-')
+	if((Big_Num_Reserve(num_ptr, (size_t)num_limbs)) != SUCCESS)
 	{
-		result_ptr_init_pos = 0;
+		return FAILURE;
 	}
-	else
+	for(limb_pos = 0; limb_pos < num_limbs; ++limb_pos)
 	{
-		result_ptr_init_pos = 1;
+		num_ptr->limb_ptr[limb_pos] = Bin_Get_Limb(bin_ptr + BIG_NUM_BIN_HEADER_SIZE + (limb_pos * sizeof(big_num_limb_t)));
 	}
-    /* convert result from numeric into ASCII string numeric */
-	for (result_ptr_pos = result_ptr_init_pos; result_ptr_pos < multiply_big_num_datas.proc_str1_len + multiply_big_num_datas.proc_str2_len + result_ptr_init_pos; ++result_ptr_pos)
+	num_ptr->num_limbs = (size_t)num_limbs;
+	num_ptr->precision_digits = (size_t)precision_digits;
+	num_ptr->sign_flag = bin_ptr[5];
+	Big_Num_Normalize(num_ptr);
+	return SUCCESS;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_Mul_Pow10
+
+DESCRIPTION    : result magnitude = magnitude * 10 ^ power
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           : precision_digits of result is same as num. result_num_ptr can be same as num_ptr.
+                 From power of karatsuba_threshold limbs, magnitude is multiplied by 10 ^ power from Big_Num_Pow10(), instead
+                 of by 10 ^ BIG_NUM_LIMB_DEC_DIGITS per limb.
+
+Func ID        : 04.10
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Big_Num_Mul_Pow10(big_num_t *const result_num_ptr, const big_num_t *const num_ptr, const size_t power)
+{
+	big_num_t power_num;
+	big_num_limb_t carry;
+	size_t power_left, step_power;
+	uint16_t ret_status;
+
+	if(num_ptr->num_limbs != 0 && power >= karatsuba_threshold * BIG_NUM_LIMB_DEC_DIGITS)
 	{
-		multiply_big_num_datas.result_ptr[result_ptr_pos] += '0';
+		Big_Num_Init(&power_num);
+		if((ret_status = Big_Num_Pow10(&power_num, power)) == SUCCESS)
+		{
+			ret_status = Big_Num_Multiply(result_num_ptr, num_ptr, &power_num);
+		}
+		Big_Num_Free(&power_num);
+		return ret_status;
 	}
-	#ifdef TRACE_DATA
-	   printf("TRA: mul - result: %s before precision \n", multiply_big_num_datas.result_ptr);
-	#endif
-	if(multiply_big_num_datas.result_str_precision_digits != 0)
+	if((Big_Num_Copy(result_num_ptr, num_ptr)) != SUCCESS)
 	{
-		#ifdef TRACE_DATA
-	    	printf("TRA: mul - result num precision width: %u \n", multiply_big_num_datas.result_str_precision_digits);
-	    #endif
-		memmove(&multiply_big_num_datas.result_ptr[multiply_big_num_datas.proc_str1_len + multiply_big_num_datas.proc_str2_len + result_ptr_init_pos - multiply_big_num_datas.result_str_precision_digits + 1],
-		  &multiply_big_num_datas.result_ptr[multiply_big_num_datas.proc_str1_len + multiply_big_num_datas.proc_str2_len + result_ptr_init_pos - multiply_big_num_datas.result_str_precision_digits],
-		   multiply_big_num_datas.result_str_precision_digits);
-	    multiply_big_num_datas.result_ptr[multiply_big_num_datas.proc_str1_len + multiply_big_num_datas.proc_str2_len + result_ptr_init_pos - multiply_big_num_datas.result_str_precision_digits] = '.';
-		multiply_big_num_datas.result_ptr[multiply_big_num_datas.result_alloc_size - 1] = NULL_CHAR;
+		return FAILURE;
 	}
-	#ifdef TRACE_DATA
-	      printf("TRA: mul - result: %s before removing leading 0 \n", multiply_big_num_datas.result_ptr);
-    #endif
-	while(multiply_big_num_datas.result_ptr[result_ptr_init_pos] == '0' && multiply_big_num_datas.result_ptr[result_ptr_init_pos + 1] != '.')
+	if(result_num_ptr->num_limbs == 0 || power == 0)
 	{
-	    memmove(&multiply_big_num_datas.result_ptr[result_ptr_init_pos], &multiply_big_num_datas.result_ptr[result_ptr_init_pos + 1], multiply_big_num_datas.result_alloc_size - 1);
+		return SUCCESS;
 	}
-	if(multiply_big_num_datas.result_ptr[result_ptr_init_pos] == '.')
+	if((Big_Num_Reserve(result_num_ptr, result_num_ptr->num_limbs + power / BIG_NUM_LIMB_DEC_DIGITS + 1)) != SUCCESS)
 	{
-		memmove(multiply_big_num_datas.result_ptr + result_ptr_init_pos + 1, multiply_big_num_datas.result_ptr + result_ptr_init_pos, multiply_big_num_datas.result_alloc_size);
-	    multiply_big_num_datas.result_ptr[result_ptr_init_pos] = '0';
+		return FAILURE;
 	}
-	if(multiply_big_num_datas.proc_str1_ptr)
+	for(power_left = power; power_left > 0; power_left -= step_power)
 	{
-	    free(multiply_big_num_datas.proc_str1_ptr);
+		step_power = (power_left > BIG_NUM_LIMB_DEC_DIGITS) ? BIG_NUM_LIMB_DEC_DIGITS : power_left;
+		carry = Limbs_Mul_1(result_num_ptr->limb_ptr, result_num_ptr->limb_ptr, result_num_ptr->num_limbs, limb_power_of_10[step_power]);
+		if(carry != 0)
+		{
+			result_num_ptr->limb_ptr[result_num_ptr->num_limbs++] = carry;
+		}
 	}
-	if(multiply_big_num_datas.proc_str2_ptr)
+	return SUCCESS;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_Cmp_Mag
+
+DESCRIPTION    : compares magnitudes of num1 and num2, ignoring sign and precision digits
+
+INPUT          :
+
+OUTPUT         : returns 1 if |num1| > |num2|, 0 if equal, -1 if |num1| < |num2|
+
+NOTE           : both big nums must be normalized
+
+Func ID        : 04.11
+
+BUGS           :
+-*------------------------------------------------------------*/
+int Big_Num_Cmp_Mag(const big_num_t *const num1_ptr, const big_num_t *const num2_ptr)
+{
+	if(num1_ptr->num_limbs != num2_ptr->num_limbs)
 	{
-	   free(multiply_big_num_datas.proc_str2_ptr);
+		return (num1_ptr->num_limbs > num2_ptr->num_limbs) ? 1 : -1;
 	}
-	#ifdef TRACE_INFO
-	   printf("TRA: In Big num, %s * %s = %s \n", mul_str1, mul_str2, multiply_big_num_datas.result_ptr);
-	#endif
-	return multiply_big_num_datas.result_ptr;
+	return Limbs_Cmp(num1_ptr->limb_ptr, num2_ptr->limb_ptr, num1_ptr->num_limbs);
 }
 
 /*------------------------------------------------------------*
-FUNCTION NAME  : Big_Nums_Division
+FUNCTION NAME  : Big_Num_Add_With_Sign
 
-DESCRIPTION    :
+DESCRIPTION    : result = num1 + num2, where sign of num2 is taken as num2_sign_flag
 
 INPUT          :
 
 OUTPUT         :
 
-NOTE           :  Caller is responsible for freeing result memory.
+NOTE           : precision digits of result is max of precision digits of num1 and num2.
+                 result_num_ptr can be same as num1_ptr or num2_ptr, and limbs of result are reused, if they are enough.
+                 '.' char of num1 and num2 are aligned by scale offset, ie num with less precision digits is multiplied by
+                 10 ^ (precision digits difference) while it is added or subtracted by Limbs_Addmul_1() or Limbs_Submul_1(),
+                 instead of being padded by zeros. Only the part of scale beyond BIG_NUM_LIMB_DEC_DIGITS is done separately.
 
-Func ID        : 01.04
+Func ID        : 04.12
 
 BUGS           :
 -*------------------------------------------------------------*/
-char *Big_Nums_Division(const char *const dividend_str1, const char *const divisor_str2, const uint8_t num_precision_digits)
+uint16_t Big_Num_Add_With_Sign(big_num_t *const result_num_ptr, const big_num_t *const num1_ptr, const big_num_t *const num2_ptr, const uint8_t num2_sign_flag)
 {
-	big_num_datas_t division_big_num_datas;
-	char *str1 = NULL_DATA_PTR, *str2 = NULL_DATA_PTR, *temp_result = NULL_DATA_PTR, *temp_result2 = NULL_DATA_PTR, digit_str[2];
-	int16_t proc_str_ptr_pos = 0, i, temp, temp2, cmp_result, result_ptr_pos = 0;
-	uint8_t result_max_digits, result_ptr_init_pos = 0;
+	big_num_t scaled_num, temp_result_num;
+	big_num_t *work_num_ptr = result_num_ptr;
+	const big_num_t *big_num_ptr, *small_num_ptr, *scale_num_ptr, *other_num_ptr;
+	big_num_limb_t carry;
+	size_t scale_digits, step_digits, num_result_limbs, num_other_limbs, result_precision_digits;
+	uint8_t big_num_sign_flag, other_sign_flag, same_sign_flag;
+	int cmp_result;
 
-	#ifdef TRACE_FLOW
-	   printf("TRA: In Big num, %s / %s \n", dividend_str1, divisor_str2);
-	#endif
-	division_big_num_datas.operand_str1 = dividend_str1;
-	division_big_num_datas.operand_str2 = divisor_str2;
-	if((Validate_Big_Num_Data(BIG_NUMS_DIVISION_OPER, num_precision_digits, &division_big_num_datas)) != SUCCESS)
-    {
-		return NULL_DATA_PTR;
-	}
-	if(division_big_num_datas.result_ptr != NULL_DATA_PTR)
-	{
-		return division_big_num_datas.result_ptr;
-	}
-	if(division_big_num_datas.proc_str1_ptr == NULL_DATA_PTR || division_big_num_datas.proc_str2_ptr == NULL_DATA_PTR)
+	Big_Num_Init(&scaled_num);
+	Big_Num_Init(&temp_result_num);
+	// result can be same as num1 or num2, so that their fields are read before result is written
+	result_precision_digits = (num1_ptr->precision_digits > num2_ptr->precision_digits) ? num1_ptr->precision_digits : num2_ptr->precision_digits;
+	same_sign_flag = (num1_ptr->sign_flag == num2_sign_flag) ? STATE_YES : STATE_NO;
+	if(num1_ptr->precision_digits == num2_ptr->precision_digits)
 	{
-		#ifdef TRACE_ERROR
-		   printf("ERR: div - memory address is NULL \n");
-		#endif
-		if(division_big_num_datas.proc_str1_ptr != NULL_DATA_PTR)
+		cmp_result = Big_Num_Cmp_Mag(num1_ptr, num2_ptr);
+		if(cmp_result >= 0)
 		{
-		    free(division_big_num_datas.proc_str1_ptr);
+			big_num_ptr = num1_ptr;
+			small_num_ptr = num2_ptr;
+			big_num_sign_flag = num1_ptr->sign_flag;
 		}
-		if(division_big_num_datas.proc_str2_ptr != NULL_DATA_PTR)
+		else
 		{
-	        free(division_big_num_datas.proc_str2_ptr);
+			big_num_ptr = num2_ptr;
+			small_num_ptr = num1_ptr;
+			big_num_sign_flag = num2_sign_flag;
 		}
-		return NULL_DATA_PTR;
+		/* limbs are added or subtracted in place, if result is same as num1 or num2 */
+		if((Big_Num_Reserve(result_num_ptr, big_num_ptr->num_limbs + 1)) != SUCCESS)
+		{
+			return FAILURE;
+		}
+		num_result_limbs = big_num_ptr->num_limbs;
+		if(same_sign_flag == STATE_YES)
+		{
+			carry = Limbs_Add(result_num_ptr->limb_ptr, big_num_ptr->limb_ptr, big_num_ptr->num_limbs, small_num_ptr->limb_ptr, small_num_ptr->num_limbs);
+			result_num_ptr->limb_ptr[num_result_limbs++] = carry;
+		}
+		else
+		{
+			Limbs_Sub(result_num_ptr->limb_ptr, big_num_ptr->limb_ptr, big_num_ptr->num_limbs, small_num_ptr->limb_ptr, small_num_ptr->num_limbs);
+		}
+		result_num_ptr->num_limbs = num_result_limbs;
+		result_num_ptr->sign_flag = big_num_sign_flag;
 	}
-	temp = (division_big_num_datas.proc_str1_len - division_big_num_datas.proc_str1_precision_digits);
-	temp2 = (division_big_num_datas.proc_str2_len - division_big_num_datas.proc_str2_precision_digits);
-	i = (temp > temp2) ? temp : temp2;
-	if(i == temp2)
+	else
 	{
-		//max num interger part digits is divisor, so quotient will be 0.<fraction part of quotient>
-        if(temp == temp2)
+		if(num1_ptr->precision_digits < num2_ptr->precision_digits)
 		{
-            i = 0;
-            if(division_big_num_datas.proc_str1_ptr[0] >= division_big_num_datas.proc_str2_ptr[0])
-			{
-		       ++i;
-			}
+			scale_num_ptr = num1_ptr;
+			other_num_ptr = num2_ptr;
+			other_sign_flag = num2_sign_flag;
 		}
 		else
 		{
-			i = temp - temp2 + 1;
-			if(division_big_num_datas.proc_str1_ptr[0] < division_big_num_datas.proc_str2_ptr[0])
+			scale_num_ptr = num2_ptr;
+			other_num_ptr = num1_ptr;
+			other_sign_flag = num1_ptr->sign_flag;
+		}
+		scale_digits = other_num_ptr->precision_digits - scale_num_ptr->precision_digits;
+		step_digits = (scale_digits - 1) % BIG_NUM_LIMB_DEC_DIGITS + 1;
+		if(scale_digits > step_digits)
+		{
+			if((Big_Num_Mul_Pow10(&scaled_num, scale_num_ptr, scale_digits - step_digits)) != SUCCESS)
 			{
-				--i;
+				Big_Num_Free(&scaled_num);
+				return FAILURE;
 			}
+			scale_num_ptr = &scaled_num;
 		}
-	}
-	else
-	{
-		i = temp - temp2;
-		if(division_big_num_datas.proc_str1_ptr[0] >= division_big_num_datas.proc_str2_ptr[0])
+		/* limbs of other num are used in place, if result is same as other num. Result same as scale num, is found in temp result */
+		if(result_num_ptr == scale_num_ptr)
 		{
-		    ++i;
+			work_num_ptr = &temp_result_num;
 		}
-	}
-    result_max_digits = i + num_precision_digits;
-	if(result_max_digits <= 0)
-	{
-		#ifdef TRACE_INFO
-		   printf("TRA: div - result max digits <= 0 \n");
-		#endif
-		//alloc for 0 char is included before . char and included for .char
-		division_big_num_datas.result_alloc_size = num_precision_digits + 1 + 1 + 1;
-		if((dividend_str1[0] == '-' && divisor_str2[0] != '-') || (dividend_str1[0] != '-' && divisor_str2[0] == '-'))
-	    {
-		    //result is negative, include alloc for sign '-' char at begin of result
-		    result_ptr_init_pos = 1;
-		    ++division_big_num_datas.result_alloc_size;
-	    }
-		division_big_num_datas.result_ptr = calloc(division_big_num_datas.result_alloc_size, sizeof(char));
-		if(division_big_num_datas.result_ptr == NULL_DATA_PTR)
+		/* result = other +/- scale num * 10 ^ step_digits, with a limb more than both for carry */
+		num_other_limbs = other_num_ptr->num_limbs;
+		num_result_limbs = ((num_other_limbs > scale_num_ptr->num_limbs) ? num_other_limbs : scale_num_ptr->num_limbs) + 2;
+		if((Big_Num_Reserve(work_num_ptr, num_result_limbs)) != SUCCESS)
 		{
-			#ifdef TRACE_ERROR
-		       printf("ERR: div - memory alloc failed \n");
-		    #endif
-			temp2 = 1;
-	    	goto div_end_proc;
+			Big_Num_Free(&scaled_num);
+			return FAILURE;
+		}
+		if(work_num_ptr != other_num_ptr && num_other_limbs != 0)
+		{
+			memcpy(work_num_ptr->limb_ptr, other_num_ptr->limb_ptr, num_other_limbs * sizeof(big_num_limb_t));
 		}
-		if(result_ptr_init_pos == 1)
+		memset(work_num_ptr->limb_ptr + num_other_limbs, 0, (num_result_limbs - num_other_limbs) * sizeof(big_num_limb_t));
+		work_num_ptr->num_limbs = num_result_limbs;
+		work_num_ptr->sign_flag = other_sign_flag;
+		if(same_sign_flag == STATE_YES)
 		{
-	    	division_big_num_datas.result_ptr[0] = '-';
+			carry = Limbs_Addmul_1(work_num_ptr->limb_ptr, scale_num_ptr->limb_ptr, scale_num_ptr->num_limbs, limb_power_of_10[step_digits]);
+			Limbs_Add_1(work_num_ptr->limb_ptr + scale_num_ptr->num_limbs, work_num_ptr->limb_ptr + scale_num_ptr->num_limbs,
+			   num_result_limbs - scale_num_ptr->num_limbs, carry);
 		}
-		for(result_ptr_pos = result_ptr_init_pos; result_ptr_pos < num_precision_digits + 1 + 1 + result_ptr_init_pos; ++result_ptr_pos)
+		else
 		{
-			if(result_ptr_pos == result_ptr_init_pos + 1)
+			carry = Limbs_Submul_1(work_num_ptr->limb_ptr, scale_num_ptr->limb_ptr, scale_num_ptr->num_limbs, limb_power_of_10[step_digits]);
+			if(Limbs_Sub_1(work_num_ptr->limb_ptr + scale_num_ptr->num_limbs, work_num_ptr->limb_ptr + scale_num_ptr->num_limbs,
+			   num_result_limbs - scale_num_ptr->num_limbs, carry) != 0)
 			{
-				division_big_num_datas.result_ptr[result_ptr_pos] = '.';
-				continue;
+				/* scaled num has bigger magnitude */
+				Limbs_Twos_Neg(work_num_ptr->limb_ptr, num_result_limbs);
+				work_num_ptr->sign_flag = (other_sign_flag == BIG_NUM_SIGN_POSITIVE) ? BIG_NUM_SIGN_NEGATIVE : BIG_NUM_SIGN_POSITIVE;
 			}
-			division_big_num_datas.result_ptr[result_ptr_pos] = '0';
 		}
-		division_big_num_datas.result_ptr[result_ptr_pos] = NULL_CHAR;
-		temp2 = 0;
-	    goto div_end_proc;
-	}
-	if(result_max_digits <= num_precision_digits)
-	{
-		//alloc for 0 char is included before . char and included for .char
-		division_big_num_datas.result_alloc_size = (num_precision_digits + 1 + 1 + 1);
-	}
-	else
-	{
-	   //result alloc size include for '.' char
-	   division_big_num_datas.result_alloc_size = result_max_digits + 1 + 1;
 	}
-	if((dividend_str1[0] == '-' && divisor_str2[0] != '-') || (dividend_str1[0] != '-' && divisor_str2[0] == '-'))
+	work_num_ptr->precision_digits = result_precision_digits;
+	Big_Num_Normalize(work_num_ptr);
+	if(work_num_ptr != result_num_ptr)
 	{
-		//result is negative, include alloc for sign '-' char at begin of result
-		result_ptr_init_pos = 1;
-		++division_big_num_datas.result_alloc_size;
+		Big_Num_Swap(result_num_ptr, work_num_ptr);
 	}
-	#ifdef TRACE_INFO
-	   printf("TRA: div - result alloc size: %u \n", division_big_num_datas.result_alloc_size);
-	#endif
-	division_big_num_datas.result_ptr = calloc(division_big_num_datas.result_alloc_size, sizeof(char));
-	str1 = calloc(division_big_num_datas.proc_str2_len + 1 + 1, sizeof(char));
-	str2 = calloc(division_big_num_datas.proc_str2_len + 1 + 1, sizeof(char));
-	if(str1 == NULL_DATA_PTR || str2 == NULL_DATA_PTR || division_big_num_datas.result_ptr == NULL_DATA_PTR)
-	{
-		#ifdef TRACE_ERROR
-		   printf("ERR: div - memory alloc failed \n");
-		#endif
-		temp2 = 1;
-		goto div_end_proc;
-	}
-	for(proc_str_ptr_pos = 0; proc_str_ptr_pos < division_big_num_datas.proc_str2_len; ++proc_str_ptr_pos)
+	Big_Num_Free(&temp_result_num);
+	Big_Num_Free(&scaled_num);
+	return SUCCESS;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_Add
+
+DESCRIPTION    : result = num1 + num2
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           : result_num_ptr can be same as num1_ptr or num2_ptr.
+
+Func ID        : 04.13
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Big_Num_Add(big_num_t *const result_num_ptr, const big_num_t *const num1_ptr, const big_num_t *const num2_ptr)
+{
+	return Big_Num_Add_With_Sign(result_num_ptr, num1_ptr, num2_ptr, num2_ptr->sign_flag);
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_Subtract
+
+DESCRIPTION    : result = num1 - num2
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           : result_num_ptr can be same as num1_ptr or num2_ptr.
+
+Func ID        : 04.14
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Big_Num_Subtract(big_num_t *const result_num_ptr, const big_num_t *const num1_ptr, const big_num_t *const num2_ptr)
+{
+	return Big_Num_Add_With_Sign(result_num_ptr, num1_ptr, num2_ptr, (uint8_t)(num2_ptr->sign_flag ^ BIG_NUM_SIGN_NEGATIVE));
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_Multiply
+
+DESCRIPTION    : result = num1 * num2
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           : precision digits of result is sum of precision digits of num1 and num2, but zero product has no precision
+                 digits, so that it is "0". result_num_ptr can be same as num1_ptr or num2_ptr. Equal magnitudes use squaring
+                 path of Limbs_Mul().
+                 Limbs of result are reused, if they are enough and result is not same as num1 or num2. Multiplier of one limb
+                 is multiplied by Limbs_Mul_1(), which is in place, if result is same as other num.
+
+Func ID        : 04.15
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Big_Num_Multiply(big_num_t *const result_num_ptr, const big_num_t *const num1_ptr, const big_num_t *const num2_ptr)
+{
+	big_num_t temp_result_num;
+	big_num_t *work_num_ptr = result_num_ptr;
+	const big_num_t *big_num_ptr = num1_ptr, *small_num_ptr = num2_ptr;
+	size_t result_precision_digits = num1_ptr->precision_digits + num2_ptr->precision_digits;
+	uint8_t result_sign_flag = num1_ptr->sign_flag ^ num2_ptr->sign_flag;
+
+	Big_Num_Init(&temp_result_num);
+	if(num1_ptr->num_limbs != 0 && num2_ptr->num_limbs != 0)
 	{
-		if(proc_str_ptr_pos < division_big_num_datas.proc_str1_len)
+		if(num1_ptr->num_limbs < num2_ptr->num_limbs)
 		{
-		    str1[proc_str_ptr_pos + 1] = division_big_num_datas.proc_str1_ptr[proc_str_ptr_pos] + '0';
+			big_num_ptr = num2_ptr;
+			small_num_ptr = num1_ptr;
 		}
-		else
+		/* equal magnitudes are multiplied as square */
+		if(num1_ptr->num_limbs == num2_ptr->num_limbs && Limbs_Cmp(num1_ptr->limb_ptr, num2_ptr->limb_ptr, num1_ptr->num_limbs) == 0)
 		{
-			str1[proc_str_ptr_pos + 1] = '0';
-		}
-		str2[proc_str_ptr_pos + 1] = division_big_num_datas.proc_str2_ptr[proc_str_ptr_pos] + '0';
-	}
-	str1[0] = '0';
-	str2[0] = '0';
-    result_ptr_pos = 0;
-	i = 0;
-	digit_str[1] = NULL_CHAR;
-	cmp_result = 1;
-	temp2 = 0;
-	while(result_ptr_pos < result_max_digits)
-	{
-		temp = strcmp(str1, str2);
-		#ifdef TRACE_INFO
-		    printf("TRA: div - str1 = %s, str2 = %s, temp = %d \n",str1, str2, temp );
-        #endif
-		if(temp == 0)
-	    {
-	    	division_big_num_datas.result_ptr[result_ptr_pos] = 1;
-			#ifdef TRACE_INFO
-			   printf("TRA: div - temp = 0, result[%d] = %u\n", result_ptr_pos, division_big_num_datas.result_ptr[result_ptr_pos] );
-			#endif
-			++result_ptr_pos;
-	    }
-        else if(temp > 0)
-		{
-			 for(i = 1 ; i < 10; ++i)
-			 {
-				digit_str[0] = i + '0';
-               	temp_result2 = Big_Nums_Multiply(str2, digit_str);
-                if(temp_result2 == NULL_DATA_PTR)
-				{
-					#ifdef TRACE_ERROR
-					     printf("ERR: div - multiplicaton result failed \n");
-					#endif
-					temp2 = 1;
-					goto div_end_proc;
-				}
-				if(strlen(temp_result2) <= division_big_num_datas.proc_str2_len)
-				{
-					temp_result = calloc(division_big_num_datas.proc_str2_len + 1 + 1,sizeof(char));
-					if(temp_result == NULL_DATA_PTR)
-					{
-						#ifdef TRACE_ERROR
-					       printf("ERR: div - memory allocation failed \n");
-					    #endif
-						temp2 = 1;
-					    goto div_end_proc;
-					}
-					memcpy(temp_result + 1, temp_result2, division_big_num_datas.proc_str2_len + 1);
-					temp_result[0] = '0';
-					free(temp_result2);
-					temp_result2 = NULL_DATA_PTR;
-					temp_result2 = temp_result;
-				}
-				cmp_result = strcmp(str1, temp_result2);
-                #ifdef TRACE_INFO
-				   printf("TRA: temp > 0, str1 : %s, mul = %s, cmp = %d \n", str1, temp_result2, cmp_result);
-                #endif
-                if(i == 9 && cmp_result > 0)
-				{
-					temp_result = temp_result2;
-					temp_result2 = NULL_DATA_PTR;
-					cmp_result = -1;
-                    i = 10;
-				}
-				if(cmp_result <= 0 )
-				{
-					if(cmp_result < 0)
-					{
-						division_big_num_datas.result_ptr[result_ptr_pos] = i - 1;
-						#ifdef TRACE_INFO
-			               printf("TRA: cmp < 0, div - result[%d] = %u, ", result_ptr_pos, division_big_num_datas.result_ptr[result_ptr_pos]);
-			            #endif
-						 ++result_ptr_pos;
-						if(i != 10)
-						{
-						   temp_result = Big_Nums_Subtract(temp_result2, str2);
-						   free(temp_result2);
-						   temp_result2 = NULL_DATA_PTR;
-                           if(temp_result == NULL_DATA_PTR)
-						   {
-							   #ifdef TRACE_ERROR
-							      printf("ERR: div - subtract result failed \n");
-							   #endif
-							    temp2 = 1;
-					            goto div_end_proc;
-						   }
-						}
-						else
-						{
-							i = 9;
-							#ifdef TRACE_INFO
-							  printf("TRA: str1 = %s, str2 = %s \n", str1, str2);
-							#endif
-						}
-					    memcpy(str2, temp_result, strlen(temp_result) + 1 );
-						free(temp_result);
-						temp_result = NULL_DATA_PTR;
-						temp_result = Big_Nums_Subtract(str1, str2);
-                        if(temp_result == NULL_DATA_PTR)
-						{
-						    #ifdef TRACE_ERROR
-							     printf("ERR: div - subtract result failed \n");
-							#endif
-							temp2 = 1;
-					        goto div_end_proc;
-						}
-						memcpy(str1, temp_result, strlen(temp_result) + 1);
-			            free(temp_result);
-						temp_result = NULL_DATA_PTR;
-                        str2[division_big_num_datas.proc_str2_len + 1 + 1] = NULL_CHAR;
-		                for(i = division_big_num_datas.proc_str2_len;  i > 0 ; --i)
-	                    {
-	                      str2[i] = division_big_num_datas.proc_str2_ptr[i - 1] + '0';
-	                    }
-                        str2[0] = '0';
-					}
-					else
-					{
-						division_big_num_datas.result_ptr[result_ptr_pos] = i;
-						#ifdef TRACE_INFO
-			               printf("TRA: div - cmp = 0, result[%d] = %u, ", result_ptr_pos, division_big_num_datas.result_ptr[result_ptr_pos]);
-			            #endif
-						++result_ptr_pos;
-						free(temp_result2);
-					}
-					break;
-				}
-				free(temp_result2);
-			}
-			if(i >= 10)
+			small_num_ptr = big_num_ptr;
+		}
+		if(small_num_ptr->num_limbs == 1 && small_num_ptr != result_num_ptr)
+		{
+			/* multiplied by a limb, in place if result is same as big num */
+			if((Big_Num_Reserve(result_num_ptr, big_num_ptr->num_limbs + 1)) != SUCCESS)
 			{
-				#ifdef TRACE_ERROR
-				     printf("ERR: Mul digits >= 10 \n");
-				#endif
-				temp2 = 1;
-				goto div_end_proc;
+				return FAILURE;
 			}
+			result_num_ptr->limb_ptr[big_num_ptr->num_limbs] = Limbs_Mul_1(result_num_ptr->limb_ptr, big_num_ptr->limb_ptr, big_num_ptr->num_limbs, small_num_ptr->limb_ptr[0]);
+			result_num_ptr->num_limbs = big_num_ptr->num_limbs + 1;
 		}
-		if(temp <= 0 || cmp_result <= 0)
+		else
 		{
-			#ifdef TRACE_INFO
-			   printf("TRA: div - temp = %d, cmp = %d \n", temp, cmp_result);
-			#endif
-			if(cmp_result < 0)
+			/* Limbs_Mul() needs result separate from num1 and num2 */
+			if(result_num_ptr == num1_ptr || result_num_ptr == num2_ptr)
 			{
-				i = strlen(str1);
-				if(i < division_big_num_datas.proc_str2_len)
-				{
-				    temp2 = 0;
-				}
-				else
-				{
-					temp2 = 1;
-				}
+				work_num_ptr = &temp_result_num;
 			}
-			else if(temp < 0)
+			if((Big_Num_Reserve(work_num_ptr, big_num_ptr->num_limbs + small_num_ptr->num_limbs)) != SUCCESS)
 			{
-				i = strlen(str1) - 1;
-				memmove(str1, str1 + 1, strlen(str1) - 1);
-				temp2 = 1;
+				return FAILURE;
 			}
-			else
-			{
-				i = 0;
-				temp2 = 0;
-			}
-		    for(; i < division_big_num_datas.proc_str2_len + temp2; ++i, ++proc_str_ptr_pos)
-			{
-			   if((proc_str_ptr_pos) < division_big_num_datas.proc_str1_len)
-		       {
-		              str1[i] = division_big_num_datas.proc_str1_ptr[proc_str_ptr_pos] + '0';
-			    	  #if defined TRACE_INFO
-				           printf("TRA: data1[%d] = %u, ", proc_str_ptr_pos, division_big_num_datas.proc_str1_ptr[proc_str_ptr_pos]);
-				      #endif
-		       }
-		       else
-		       {
-		             str1[i] = '0';
-				     #if defined TRACE_INFO
-				         printf("TRA: pos = %d, ", proc_str_ptr_pos);
-				     #endif
-			   }
-			   if(i < (division_big_num_datas.proc_str2_len + temp2 - 1))
-			   {
-				   division_big_num_datas.result_ptr[result_ptr_pos] = 0;
-			       #ifdef TRACE_INFO
-			            printf("div - i = %u, result[%d] = %u \n", i, result_ptr_pos, division_big_num_datas.result_ptr[result_ptr_pos]);
-			       #endif
-			       ++result_ptr_pos;
-			   }
-		    }
-		    str1[i] = NULL_CHAR;
-			if(strlen(str1) <= division_big_num_datas.proc_str2_len)
-		    {
-			    memmove(str1 + 1, str1, division_big_num_datas.proc_str2_len + 1);
-			    str1[0] = '0';
-		    }
-			#ifdef TRACE_INFO
-			   printf("TRA: temp <= 0  or cmp <= 0, str1 : %s \n", str1);
-			#endif
-			if(cmp_result < 0 || temp < 0)
+			if((Limbs_Mul(work_num_ptr->limb_ptr, big_num_ptr->limb_ptr, big_num_ptr->num_limbs, small_num_ptr->limb_ptr, small_num_ptr->num_limbs)) != SUCCESS)
 			{
-		        temp = strcmp(str1, str2);
-				if(temp < 0)
-				{
-				    division_big_num_datas.result_ptr[result_ptr_pos] = 0;
-			        #ifdef TRACE_INFO
-			           printf("div - temp < 0, i = %u, result[%d] = %u \n", i, result_ptr_pos, division_big_num_datas.result_ptr[result_ptr_pos]);
-			        #endif
-			        ++result_ptr_pos;
-			   }
+				Big_Num_Free(&temp_result_num);
+				return FAILURE;
 			}
-			cmp_result = 1;
-		}
-	}
-	temp2 = 0;
-	for (result_ptr_pos = 0; result_ptr_pos < result_max_digits; ++result_ptr_pos)
-	{
-		division_big_num_datas.result_ptr[result_ptr_pos] += '0';
-	}
-    #ifdef TRACE_INFO
-	    printf("TRA: div - result : %s before add precision char \n", division_big_num_datas.result_ptr);
-    #endif
-    if(result_max_digits <= num_precision_digits)
-	{
-		for(i = num_precision_digits - result_max_digits; i >= 0; --i)
-		{
-		   memmove(division_big_num_datas.result_ptr + 1, division_big_num_datas.result_ptr, strlen(division_big_num_datas.result_ptr) + 1);
-		   division_big_num_datas.result_ptr[0] = '0';
+			work_num_ptr->num_limbs = big_num_ptr->num_limbs + small_num_ptr->num_limbs;
 		}
-		result_max_digits = num_precision_digits + 1;
-	}
-	if(result_ptr_init_pos == 1)
-	{
-		memmove(division_big_num_datas.result_ptr + 1, division_big_num_datas.result_ptr, num_precision_digits + 1);
-		division_big_num_datas.result_ptr[0] = '-';
-	}
-	memmove(division_big_num_datas.result_ptr + result_max_digits - num_precision_digits + result_ptr_init_pos + 1,
-	   division_big_num_datas.result_ptr + result_max_digits - num_precision_digits + result_ptr_init_pos, num_precision_digits + 1);
-	division_big_num_datas.result_ptr[result_max_digits - num_precision_digits + result_ptr_init_pos] = '.';
-    #ifdef TRACE_INFO
-	    printf("TRA: div - result : %s, result_prec: %u before removing 0 \n", division_big_num_datas.result_ptr, num_precision_digits);
-    #endif
-div_end_proc :
-	if(str1)
-	{
-	   	free(str1);
 	}
-	if(str2)
-	{
-	   	free(str2);
-	}
-	if(division_big_num_datas.proc_str1_ptr)
+	else
 	{
-	  	free(division_big_num_datas.proc_str1_ptr);
+		work_num_ptr->num_limbs = 0;
 	}
-	if(division_big_num_datas.proc_str2_ptr)
+	work_num_ptr->sign_flag = result_sign_flag;
+	work_num_ptr->precision_digits = result_precision_digits;
+	Big_Num_Normalize(work_num_ptr);
+	if(work_num_ptr->num_limbs == 0)
 	{
-	      free(division_big_num_datas.proc_str2_ptr);
+		work_num_ptr->precision_digits = 0;
 	}
-	if(temp2 == 1)
+	if(work_num_ptr != result_num_ptr)
 	{
-	   if(division_big_num_datas.result_ptr)
-	   {
-	        free(division_big_num_datas.result_ptr);
-	   }
-	   return NULL_DATA_PTR;
+		Big_Num_Swap(result_num_ptr, work_num_ptr);
 	}
-	#ifdef TRACE_INFO
-	   printf("TRA: In Big num, %s / %s = %s \n", dividend_str1, divisor_str2, division_big_num_datas.result_ptr);
-	#endif
-    return division_big_num_datas.result_ptr;
+	Big_Num_Free(&temp_result_num);
+	return SUCCESS;
 }
 
 /*------------------------------------------------------------*
-FUNCTION NAME  : Big_Nums_Modulus
+FUNCTION NAME  : Big_Num_Divrem_Mag
 
-DESCRIPTION    :
+DESCRIPTION    : quot magnitude = num1 magnitude / num2 magnitude, rem magnitude = num1 magnitude % num2 magnitude
 
 INPUT          :
 
-OUTPUT         :
+OUTPUT         : sign and precision digits of quot and rem are set to positive and 0.
 
-NOTE           :  Caller is responsible for freeing result memory.
+NOTE           : num2 must not be 0. quot_num_ptr or rem_num_ptr can be NULL, if not required.
+                 quot and rem must not be same as num1 or num2.
 
-Func ID        : 01.04
+Func ID        : 04.16
 
 BUGS           :
 -*------------------------------------------------------------*/
-char *Big_Nums_Modulus(const char *const dividend_str1, const char *const divisor_str2)
+uint16_t Big_Num_Divrem_Mag(big_num_t *const quot_num_ptr, big_num_t *const rem_num_ptr, const big_num_t *const num1_ptr, const big_num_t *const num2_ptr)
 {
-	big_num_datas_t modulus_big_num_datas;
-	char *str1 = NULL_DATA_PTR, *str2 = NULL_DATA_PTR, *temp_result = NULL_DATA_PTR, *temp_result2 = NULL_DATA_PTR, digit_str[2];
-	int16_t proc_str1_ptr_pos = 0, i, temp, temp2, cmp_result, result_ptr_pos = 0;
-	uint8_t result_ptr_init_pos = 0, str_cmp_flag = 0;
-
-	#ifdef TRACE_FLOW
-	   printf("TRA: In Big num, %s %% %s \n", dividend_str1, divisor_str2);
-	#endif
-	modulus_big_num_datas.operand_str1 = dividend_str1;
-	modulus_big_num_datas.operand_str2 = divisor_str2;
-	if((Validate_Big_Num_Data(BIG_NUMS_MODULUS_OPER, RESULT_BASED_PRECISION_DIGITS, &modulus_big_num_datas)) != SUCCESS)
-    {
-		return NULL_DATA_PTR;
-	}
-	if(modulus_big_num_datas.result_ptr != NULL_DATA_PTR)
-	{
-		return modulus_big_num_datas.result_ptr;
-	}
-	if(modulus_big_num_datas.proc_str1_ptr == NULL_DATA_PTR || modulus_big_num_datas.proc_str2_ptr == NULL_DATA_PTR)
+	if(num2_ptr->num_limbs == 0)
 	{
 		#ifdef TRACE_ERROR
-		   printf("ERR: mod - memory address is NULL \n");
+		   Trace_Error("divrem - divisor is 0 \n");
 		#endif
-		if(modulus_big_num_datas.proc_str1_ptr != NULL_DATA_PTR)
+		return FAILURE;
+	}
+	if(num1_ptr->num_limbs < num2_ptr->num_limbs)
+	{
+		if(quot_num_ptr != NULL_DATA_PTR)
 		{
-		    free(modulus_big_num_datas.proc_str1_ptr);
+			quot_num_ptr->num_limbs = 0;
 		}
-		if(modulus_big_num_datas.proc_str2_ptr != NULL_DATA_PTR)
+		if(rem_num_ptr != NULL_DATA_PTR && (Big_Num_Copy(rem_num_ptr, num1_ptr)) != SUCCESS)
 		{
-	        free(modulus_big_num_datas.proc_str2_ptr);
+			return FAILURE;
 		}
-		return NULL_DATA_PTR;
-	}
-	if(modulus_big_num_datas.operand_str1[0] == '-')
-	{
-		result_ptr_init_pos = 1;
-		++modulus_big_num_datas.result_alloc_size;
 	}
-	if(modulus_big_num_datas.proc_str1_len < modulus_big_num_datas.proc_str2_len)
+	else
 	{
-		modulus_big_num_datas.result_alloc_size += (modulus_big_num_datas.proc_str1_len + 1);
-		modulus_big_num_datas.result_ptr = calloc(modulus_big_num_datas.result_alloc_size, sizeof(char));
-		if(modulus_big_num_datas.result_ptr == NULL_DATA_PTR)
+		if(quot_num_ptr != NULL_DATA_PTR && (Big_Num_Reserve(quot_num_ptr, num1_ptr->num_limbs - num2_ptr->num_limbs + 1)) != SUCCESS)
 		{
-		  	#ifdef TRACE_ERROR
-		        printf("ERR: mod - memory address is NULL \n");
-		    #endif
-		    if(modulus_big_num_datas.proc_str1_ptr != NULL_DATA_PTR)
-	     	{
-		       free(modulus_big_num_datas.proc_str1_ptr);
-	    	}
-		    if(modulus_big_num_datas.proc_str2_ptr != NULL_DATA_PTR)
-		    {
-	           free(modulus_big_num_datas.proc_str2_ptr);
-	    	}
-		    return NULL_DATA_PTR;
+			return FAILURE;
 		}
-		for(result_ptr_pos = result_ptr_init_pos; result_ptr_pos < modulus_big_num_datas.proc_str1_len + result_ptr_init_pos; ++result_ptr_pos)
+		if(rem_num_ptr != NULL_DATA_PTR && (Big_Num_Reserve(rem_num_ptr, num2_ptr->num_limbs)) != SUCCESS)
 		{
-			modulus_big_num_datas.result_ptr[result_ptr_pos] = modulus_big_num_datas.proc_str1_ptr[result_ptr_pos - result_ptr_init_pos] + '0';
+			return FAILURE;
 		}
-        if(result_ptr_init_pos == 1)
+		if((Limbs_Divrem((quot_num_ptr != NULL_DATA_PTR) ? quot_num_ptr->limb_ptr : NULL_DATA_PTR, (rem_num_ptr != NULL_DATA_PTR) ? rem_num_ptr->limb_ptr : NULL_DATA_PTR,
+		   num1_ptr->limb_ptr, num1_ptr->num_limbs, num2_ptr->limb_ptr, num2_ptr->num_limbs, NULL_DATA_PTR)) != SUCCESS)
 		{
-			modulus_big_num_datas.result_ptr[0] = '-';
+			return FAILURE;
 		}
-        if(modulus_big_num_datas.proc_str1_ptr != NULL_DATA_PTR)
-	   	{
-		      free(modulus_big_num_datas.proc_str1_ptr);
-	    }
-		if(modulus_big_num_datas.proc_str2_ptr != NULL_DATA_PTR)
+		if(quot_num_ptr != NULL_DATA_PTR)
 		{
-	        free(modulus_big_num_datas.proc_str2_ptr);
-	    }
-        return  modulus_big_num_datas.result_ptr;
-	}
-	modulus_big_num_datas.result_alloc_size += (modulus_big_num_datas.proc_str2_len + 2);
-	#ifdef TRACE_INFO
-	   printf("TRA: mod - result alloc size: %u \n", modulus_big_num_datas.result_alloc_size);
-	#endif
-	modulus_big_num_datas.result_ptr = calloc(modulus_big_num_datas.result_alloc_size, sizeof(char));
-	str1 = calloc(modulus_big_num_datas.proc_str2_len + 1 + 1, sizeof(char));
-	str2 = calloc(modulus_big_num_datas.proc_str2_len + 1 + 1, sizeof(char));
-	if(str1 == NULL_DATA_PTR || str2 == NULL_DATA_PTR || modulus_big_num_datas.result_ptr == NULL_DATA_PTR)
-	{
-		#ifdef TRACE_ERROR
-		   printf("ERR: mod - memory alloc failed \n");
-		#endif
-		temp2 = 1;
-		goto mod_end_proc;
-	}
-	for(proc_str1_ptr_pos = 0; proc_str1_ptr_pos < modulus_big_num_datas.proc_str2_len; ++proc_str1_ptr_pos)
-	{
-		str2[proc_str1_ptr_pos + 1] = modulus_big_num_datas.proc_str2_ptr[proc_str1_ptr_pos] + '0';
+			quot_num_ptr->num_limbs = num1_ptr->num_limbs - num2_ptr->num_limbs + 1;
+		}
+		if(rem_num_ptr != NULL_DATA_PTR)
+		{
+			rem_num_ptr->num_limbs = num2_ptr->num_limbs;
+		}
 	}
-	str1[0] = '0';
-	str2[0] = '0';
-	i = 0;
-	digit_str[1] = NULL_CHAR;
-	proc_str1_ptr_pos = 0;
-	cmp_result = 1;
-	temp2 = 0;
-    temp = 0;
-	str_cmp_flag = 0;
-	if(modulus_big_num_datas.proc_str1_len == modulus_big_num_datas.proc_str2_len)
+	if(quot_num_ptr != NULL_DATA_PTR)
 	{
-		str_cmp_flag = 1;
+		quot_num_ptr->sign_flag = BIG_NUM_SIGN_POSITIVE;
+		quot_num_ptr->precision_digits = 0;
+		Big_Num_Normalize(quot_num_ptr);
 	}
-	while(proc_str1_ptr_pos <= modulus_big_num_datas.proc_str1_len + str_cmp_flag)
+	if(rem_num_ptr != NULL_DATA_PTR)
 	{
-		temp = strcmp(str1, str2);
-		#ifdef TRACE_INFO
-		    printf("TRA: mod - str1 = %s, str2 = %s, temp = %d \n",str1, str2, temp );
-        #endif
-		if(temp > 0)
-		{
-			 for(i = 1 ; i < 10; ++i)
-			 {
-				digit_str[0] = i + '0';
-               	temp_result2 = Big_Nums_Multiply(str2, digit_str);
-                if(temp_result2 == NULL_DATA_PTR)
-				{
-					#ifdef TRACE_ERROR
-					     printf("ERR: mod - multiplicaton result failed \n");
-					#endif
-					temp2 = 1;
-					goto mod_end_proc;
-				}
-				if(strlen(temp_result2) <= modulus_big_num_datas.proc_str2_len)
-				{
-					temp_result = calloc(modulus_big_num_datas.proc_str2_len + 1 + 1,sizeof(char));
-					if(temp_result == NULL_DATA_PTR)
-					{
-						#ifdef TRACE_ERROR
-					       printf("ERR: mod - memory allocation failed \n");
-					    #endif
-						temp2 = 1;
-					    goto mod_end_proc;
-					}
-					memcpy(temp_result + 1, temp_result2, modulus_big_num_datas.proc_str2_len + 1);
-					temp_result[0] = '0';
-					free(temp_result2);
-					temp_result2 = NULL_DATA_PTR;
-					temp_result2 = temp_result;
-				}
-				cmp_result = strcmp(str1, temp_result2);
-                #ifdef TRACE_INFO
-				   printf("TRA: mod - temp > 0, str1 : %s, mul = %s, cmp = %d \n", str1, temp_result2, cmp_result);
-                #endif
-                if(i == 9 && cmp_result > 0)
-				{
-					temp_result = temp_result2;
-					temp_result2 = NULL_DATA_PTR;
-					cmp_result = -1;
-                    i = 10;
-				}
-				if(cmp_result <= 0 )
-				{
-					if(cmp_result < 0)
-					{
-						if(i != 10)
-						{
-						   temp_result = Big_Nums_Subtract(temp_result2, str2);
-						   free(temp_result2);
-						   temp_result2 = NULL_DATA_PTR;
-                           if(temp_result == NULL_DATA_PTR)
-						   {
-							   #ifdef TRACE_ERROR
-							      printf("ERR: mod - subtract result failed \n");
-							   #endif
-							    temp2 = 1;
-					            goto mod_end_proc;
-						   }
-						}
-						else
-						{
-							i = 9;
-							#ifdef TRACE_INFO
-							  printf("TRA: mod - str1 = %s, str2 = %s \n", str1, str2);
-							#endif
-						}
-					    memcpy(str2, temp_result, strlen(temp_result) + 1 );
-						free(temp_result);
-						temp_result = NULL_DATA_PTR;
-						temp_result = Big_Nums_Subtract(str1, str2);
-                        if(temp_result == NULL_DATA_PTR)
-						{
-						    #ifdef TRACE_ERROR
-							     printf("ERR: mod - subtract result failed \n");
-							#endif
-							temp2 = 1;
-					        goto mod_end_proc;
-						}
-						memcpy(str1, temp_result, strlen(temp_result) + 1);
-			            free(temp_result);
-						temp_result = NULL_DATA_PTR;
-                        str2[modulus_big_num_datas.proc_str2_len + 1 + 1] = NULL_CHAR;
-		                for(i = modulus_big_num_datas.proc_str2_len;  i > 0 ; --i)
-	                    {
-	                      str2[i] = modulus_big_num_datas.proc_str2_ptr[i - 1] + '0';
-	                    }
-                        str2[0] = '0';
-					}
-					else
-					{
-						free(temp_result2);
-					}
-					break;
-				}
-				free(temp_result2);
-			}
-			if(i >= 10)
-			{
-				#ifdef TRACE_ERROR
-				     printf("ERR: mod - Mul digits >= 10 \n");
-				#endif
-				temp2 = 1;
-				goto mod_end_proc;
-			}
-		}
-		if(temp <= 0 || cmp_result <= 0)
-		{
-			#ifdef TRACE_INFO
-			   printf("TRA: mod - temp = %d, cmp = %d \n", temp, cmp_result);
-			#endif
-			if(cmp_result < 0)
-			{
-				i = strlen(str1);
-				if(i < modulus_big_num_datas.proc_str2_len)
-				{
-				    temp2 = 0;
-				}
-				else
-				{
-					temp2 = 1;
-				}
-			}
-			else if(temp < 0)
-			{
-				i = strlen(str1) - 1;
-				memmove(str1, str1 + 1, strlen(str1) - 1);
-				temp2 = 1;
-			}
-			else
-			{
-				i = 0;
-				temp2 = 0;
-			}
-		    for(; i < modulus_big_num_datas.proc_str2_len + temp2; ++i, ++proc_str1_ptr_pos)
-			{
-			   if((proc_str1_ptr_pos) < modulus_big_num_datas.proc_str1_len)
-		       {
-		           str1[i] = modulus_big_num_datas.proc_str1_ptr[proc_str1_ptr_pos] + '0';
-			       #if defined TRACE_INFO
-				        printf("TRA: mod - data1[%d] = %u \n", proc_str1_ptr_pos, modulus_big_num_datas.proc_str1_ptr[proc_str1_ptr_pos]);
-				   #endif
-		       }
-		       else
-		       {
-				   str1[i] = NULL_CHAR;
-			   }
-		    }
-		    str1[i] = NULL_CHAR;
-			if(strlen(str1) <= modulus_big_num_datas.proc_str2_len)
-		    {
-			    memmove(str1 + 1, str1, modulus_big_num_datas.proc_str2_len + 1);
-			    str1[0] = '0';
-		    }
-			#ifdef TRACE_INFO
-			   printf("TRA: mod - temp <= 0 or cmp <= 0, str1 : %s \n", str1);
-			#endif
-			if(cmp_result < 0 || temp < 0)
-			{
-		        temp = strcmp(str1, str2);
-			}
-			cmp_result = 1;
-		}
+		rem_num_ptr->sign_flag = BIG_NUM_SIGN_POSITIVE;
+		rem_num_ptr->precision_digits = 0;
+		Big_Num_Normalize(rem_num_ptr);
 	}
-	for(proc_str1_ptr_pos = 0; proc_str1_ptr_pos < modulus_big_num_datas.proc_str1_len + 1; ++proc_str1_ptr_pos)
+	return SUCCESS;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_Mod_Mag
+
+DESCRIPTION    : num magnitude = num magnitude % divisor magnitude, in place
+
+INPUT          :
+
+OUTPUT         : sign and precision digits of num are set to positive and 0.
+
+NOTE           : divisor must not be 0 and must not be same as num. Quotient is not found, and limbs of num are reduced by Limbs_Mod().
+
+Func ID        : 04.19
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Big_Num_Mod_Mag(big_num_t *const num_ptr, const big_num_t *const divisor_num_ptr)
+{
+	if(divisor_num_ptr->num_limbs == 0)
 	{
-		modulus_big_num_datas.result_ptr[proc_str1_ptr_pos]	= str1[proc_str1_ptr_pos];
+		#ifdef TRACE_ERROR
+		   Trace_Error("mod - divisor is 0 \n");
+		#endif
+		return FAILURE;
 	}
-	modulus_big_num_datas.result_ptr[proc_str1_ptr_pos] = NULL_CHAR;
-	if(result_ptr_init_pos == 1 && temp != 0)
+	if(num_ptr->num_limbs >= divisor_num_ptr->num_limbs)
 	{
-		modulus_big_num_datas.result_ptr[0] = '-';
+		/* one more limb for bits shifted out in Limbs_Mod() */
+		if((Big_Num_Reserve(num_ptr, num_ptr->num_limbs + 1)) != SUCCESS)
+		{
+			return FAILURE;
+		}
+		if((Limbs_Mod(num_ptr->limb_ptr, num_ptr->num_limbs, divisor_num_ptr->limb_ptr, divisor_num_ptr->num_limbs)) != SUCCESS)
+		{
+			return FAILURE;
+		}
+		num_ptr->num_limbs = divisor_num_ptr->num_limbs;
 	}
-	while(modulus_big_num_datas.result_ptr[result_ptr_init_pos] == '0' && modulus_big_num_datas.result_ptr[result_ptr_init_pos + 1] != NULL_CHAR)
+	num_ptr->sign_flag = BIG_NUM_SIGN_POSITIVE;
+	num_ptr->precision_digits = 0;
+	Big_Num_Normalize(num_ptr);
+	return SUCCESS;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_Division
+
+DESCRIPTION    : quot = num1 / num2, truncated to num_precision_digits digits after '.' char
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           : quot magnitude = (num1 magnitude * 10 ^ (num_precision_digits + num2 precision digits)) / (num2 magnitude * 10 ^ num1 precision digits).
+                 quot_num_ptr can be same as num1_ptr or num2_ptr, and limbs of quot are reused, if they are enough.
+                 num1 or num2, which need no scaling, are not copied.
+
+Func ID        : 04.17
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Big_Num_Division(big_num_t *const quot_num_ptr, const big_num_t *const num1_ptr, const big_num_t *const num2_ptr, const size_t num_precision_digits)
+{
+	big_num_t dividend_num, divisor_num, temp_quot_num;
+	const big_num_t *dividend_num_ptr = num1_ptr, *divisor_num_ptr = num2_ptr;
+	big_num_t *work_num_ptr = quot_num_ptr;
+	uint16_t ret_status = SUCCESS;
+	uint8_t quot_sign_flag = num1_ptr->sign_flag ^ num2_ptr->sign_flag;
+
+	if(num2_ptr->num_limbs == 0)
 	{
-	    memmove(&modulus_big_num_datas.result_ptr[result_ptr_init_pos], &modulus_big_num_datas.result_ptr[result_ptr_init_pos + 1], modulus_big_num_datas.result_alloc_size - 1);
+		#ifdef TRACE_ERROR
+		   Trace_Error("div - divisor is 0 \n");
+		#endif
+		return FAILURE;
 	}
-	temp2 = 0;
-mod_end_proc :
-	if(str1)
+	Big_Num_Init(&dividend_num);
+	Big_Num_Init(&divisor_num);
+	Big_Num_Init(&temp_quot_num);
+	/* num1 and num2 are used as such, if they need no scaling */
+	if(num_precision_digits + num2_ptr->precision_digits != 0)
 	{
-	   	free(str1);
+		ret_status = Big_Num_Mul_Pow10(&dividend_num, num1_ptr, num_precision_digits + num2_ptr->precision_digits);
+		dividend_num_ptr = &dividend_num;
 	}
-	if(str2)
+	if(ret_status == SUCCESS && num1_ptr->precision_digits != 0)
 	{
-	   	free(str2);
+		ret_status = Big_Num_Mul_Pow10(&divisor_num, num2_ptr, num1_ptr->precision_digits);
+		divisor_num_ptr = &divisor_num;
 	}
-	if(modulus_big_num_datas.proc_str1_ptr)
+	/* Big_Num_Divrem_Mag() needs quot separate from dividend and divisor */
+	if(quot_num_ptr == dividend_num_ptr || quot_num_ptr == divisor_num_ptr)
 	{
-	  	free(modulus_big_num_datas.proc_str1_ptr);
+		work_num_ptr = &temp_quot_num;
 	}
-	if(modulus_big_num_datas.proc_str2_ptr)
+	if(ret_status == SUCCESS)
 	{
-	      free(modulus_big_num_datas.proc_str2_ptr);
+		ret_status = Big_Num_Divrem_Mag(work_num_ptr, NULL_DATA_PTR, dividend_num_ptr, divisor_num_ptr);
 	}
-	if(temp2 == 1)
+	if(ret_status == SUCCESS)
 	{
-	   if(modulus_big_num_datas.result_ptr)
-	   {
-	        free(modulus_big_num_datas.result_ptr);
-	   }
-	   return NULL_DATA_PTR;
+		work_num_ptr->sign_flag = quot_sign_flag;
+		work_num_ptr->precision_digits = num_precision_digits;
+		Big_Num_Normalize(work_num_ptr);
+		if(work_num_ptr != quot_num_ptr)
+		{
+			Big_Num_Swap(quot_num_ptr, work_num_ptr);
+		}
 	}
-	#ifdef TRACE_INFO
-	   printf("TRA: In Big num, %s %% %s = %s \n", dividend_str1, divisor_str2, modulus_big_num_datas.result_ptr);
-	#endif
-    return modulus_big_num_datas.result_ptr;
+	Big_Num_Free(&dividend_num);
+	Big_Num_Free(&divisor_num);
+	Big_Num_Free(&temp_quot_num);
+	return ret_status;
 }
 
 /*------------------------------------------------------------*
-FUNCTION NAME  : Big_Nums_Sum
+FUNCTION NAME  : Big_Num_Modulus
 
-DESCRIPTION    :  find sum of two large numbers.
+DESCRIPTION    : rem = num1 % num2. Sign of rem is same as sign of num1.
 
 INPUT          :
 
 OUTPUT         :
 
-NOTE           : Caller is responsible for freeing result memory.
+NOTE           : num1 and num2 are aligned to max precision digits of num1 and num2, which is precision digits of rem.
+                 Aligned copy of num1 is reduced in place by Big_Num_Mod_Mag(), without finding quotient.
+                 rem_num_ptr can be same as num1_ptr or num2_ptr. Aligned copy of num1 is made in rem, so that rem same as num1
+                 is reduced in place, and limbs of rem are reused, if they are enough.
 
-Func ID        : 01.04
+Func ID        : 04.18
 
 BUGS           :
 -*------------------------------------------------------------*/
-char *Big_Nums_Sum(const char *const aug_str1, const char *const add_str2)
+uint16_t Big_Num_Modulus(big_num_t *const rem_num_ptr, const big_num_t *const num1_ptr, const big_num_t *const num2_ptr)
 {
-    big_num_datas_t add_big_num_datas;
-    char *result_ptr, *temp_ptr;
-	int16_t proc_str1_ptr_pos = 0, proc_str2_ptr_pos = 0, result_ptr_pos = 0, i, diff_proc_str_len, carry = 0;
-	uint8_t result_ptr_init_pos, min_proc_str_len = 0, max_proc_str_len, diff_precision_digits = 0, min_precision_digits = 0;
+	big_num_t dividend_num, divisor_num;
+	const big_num_t *divisor_num_ptr = num2_ptr;
+	big_num_t *work_num_ptr = rem_num_ptr;
+	size_t num_precision_digits;
+	uint16_t ret_status;
+	uint8_t rem_sign_flag = num1_ptr->sign_flag;
 
-	#ifdef TRACE_FLOW
-	   printf("TRA: In Big num, %s + %s \n", aug_str1, add_str2);
-	#endif
-	add_big_num_datas.operand_str1 = aug_str1;
-	add_big_num_datas.operand_str2 = add_str2;
-	if((Validate_Big_Num_Data(BIG_NUMS_SUM_OPER, RESULT_BASED_PRECISION_DIGITS, &add_big_num_datas)) != SUCCESS)
-    {
-		return NULL_DATA_PTR;
+	if(num2_ptr->num_limbs == 0)
+	{
+		#ifdef TRACE_ERROR
+		   Trace_Error("mod - divisor is 0 \n");
+		#endif
+		return FAILURE;
 	}
-	if(add_big_num_datas.result_ptr != NULL_DATA_PTR)
+	Big_Num_Init(&dividend_num);
+	Big_Num_Init(&divisor_num);
+	num_precision_digits = (num1_ptr->precision_digits > num2_ptr->precision_digits) ? num1_ptr->precision_digits : num2_ptr->precision_digits;
+	/* aligned num1 is reduced in rem, which must be separate from divisor */
+	if(rem_num_ptr == num2_ptr)
 	{
-		return add_big_num_datas.result_ptr;
+		work_num_ptr = &dividend_num;
 	}
-	if((aug_str1[0] != '-' && add_str2[0] == '-') || (aug_str1[0] == '-' && add_str2[0] != '-'))
+	ret_status = Big_Num_Mul_Pow10(work_num_ptr, num1_ptr, num_precision_digits - num1_ptr->precision_digits);
+	if(ret_status == SUCCESS && num2_ptr->precision_digits != num_precision_digits)
 	{
-		if(add_big_num_datas.proc_str1_ptr)
-		{
-		   free(add_big_num_datas.proc_str1_ptr);
-		}
-		if(add_big_num_datas.proc_str2_ptr)
-		{
-    	    free(add_big_num_datas.proc_str2_ptr);
-		}
-		i = 0;
-		if(aug_str1[0] != '-' && add_str2[0] == '-')
-		{
-			#ifdef TRACE_DATA
-			   printf("TRA: sum - result = '+' and '-' \n");
-			#endif
-			result_ptr = Big_Nums_Subtract(aug_str1, add_str2 + 1);
-		}
-		else
+		ret_status = Big_Num_Mul_Pow10(&divisor_num, num2_ptr, num_precision_digits - num2_ptr->precision_digits);
+		divisor_num_ptr = &divisor_num;
+	}
+	if(ret_status == SUCCESS)
+	{
+		ret_status = Big_Num_Mod_Mag(work_num_ptr, divisor_num_ptr);
+	}
+	if(ret_status == SUCCESS)
+	{
+		work_num_ptr->sign_flag = rem_sign_flag;
+		work_num_ptr->precision_digits = num_precision_digits;
+		Big_Num_Normalize(work_num_ptr);
+		if(work_num_ptr != rem_num_ptr)
 		{
-			#ifdef TRACE_DATA
-			   printf("TRA: sum - result = '-' and '+' \n");
-			#endif
-			result_ptr = Big_Nums_Subtract(add_str2, aug_str1 + 1);
+			Big_Num_Swap(rem_num_ptr, work_num_ptr);
 		}
-		return result_ptr;
 	}
-	min_proc_str_len = (add_big_num_datas.proc_str1_len < add_big_num_datas.proc_str2_len) ? add_big_num_datas.proc_str1_len: add_big_num_datas.proc_str2_len;
-	max_proc_str_len = (add_big_num_datas.proc_str1_len > add_big_num_datas.proc_str2_len) ? add_big_num_datas.proc_str1_len: add_big_num_datas.proc_str2_len;
-	diff_precision_digits = min_precision_digits = 0;
-	//result_alloc_size is included for sign char at begin of result_ptr and NULL_CHAR at end of result_ptr
-	add_big_num_datas.result_alloc_size = max_proc_str_len + 1 + 2;
-	if(aug_str1[0] == '+' && add_str2[0] == '+')
+	Big_Num_Free(&dividend_num);
+	Big_Num_Free(&divisor_num);
+	return ret_status;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_Add_Assign
+
+DESCRIPTION    : num += add_num
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           : limbs of num are added in place, if they are enough, and precision digits of num and add num are same.
+
+Func ID        : 04.30
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Big_Num_Add_Assign(big_num_t *const num_ptr, const big_num_t *const add_num_ptr)
+{
+	return Big_Num_Add(num_ptr, num_ptr, add_num_ptr);
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_Subtract_Assign
+
+DESCRIPTION    : num -= subt_num
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           : as of Big_Num_Add_Assign()
+
+Func ID        : 04.31
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Big_Num_Subtract_Assign(big_num_t *const num_ptr, const big_num_t *const subt_num_ptr)
+{
+	return Big_Num_Subtract(num_ptr, num_ptr, subt_num_ptr);
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_Multiply_Assign
+
+DESCRIPTION    : num *= mul_num
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           : limbs of num are multiplied in place, if mul num has one limb. Otherwise product is found in temp limbs,
+                 as Limbs_Mul() needs result separate from its operands.
+
+Func ID        : 04.32
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Big_Num_Multiply_Assign(big_num_t *const num_ptr, const big_num_t *const mul_num_ptr)
+{
+	return Big_Num_Multiply(num_ptr, num_ptr, mul_num_ptr);
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_Modulus_Assign
+
+DESCRIPTION    : num %= divisor_num. Sign of num is kept.
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           : limbs of num are reduced in place by Big_Num_Mod_Mag(), if precision digits of num is atleast that of divisor num.
+
+Func ID        : 04.33
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Big_Num_Modulus_Assign(big_num_t *const num_ptr, const big_num_t *const divisor_num_ptr)
+{
+	return Big_Num_Modulus(num_ptr, num_ptr, divisor_num_ptr);
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_Oper
+
+DESCRIPTION    : result = num1 oper num2, where oper is one of BIG_NUMS_SUM_OPER to BIG_NUMS_MODULUS_OPER
+
+INPUT          : num_precision_digits is used only by BIG_NUMS_DIVISION_OPER
+
+OUTPUT         :
+
+NOTE           : result_num_ptr can be same as num1_ptr or num2_ptr, and limbs of result are reused, if they are enough.
+
+Func ID        : 04.34
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Big_Num_Oper(big_num_t *const result_num_ptr, const uint8_t big_num_arithmetic_oper, const big_num_t *const num1_ptr, const big_num_t *const num2_ptr,
+   const size_t num_precision_digits)
+{
+	switch(big_num_arithmetic_oper)
+	{
+		case BIG_NUMS_SUM_OPER:
+		   return Big_Num_Add(result_num_ptr, num1_ptr, num2_ptr);
+		case BIG_NUMS_SUBTRACT_OPER:
+		   return Big_Num_Subtract(result_num_ptr, num1_ptr, num2_ptr);
+		case BIG_NUMS_MULTIPLY_OPER:
+		   return Big_Num_Multiply(result_num_ptr, num1_ptr, num2_ptr);
+		case BIG_NUMS_DIVISION_OPER:
+		   return Big_Num_Division(result_num_ptr, num1_ptr, num2_ptr, num_precision_digits);
+		case BIG_NUMS_MODULUS_OPER:
+		   return Big_Num_Modulus(result_num_ptr, num1_ptr, num2_ptr);
+	}
+	#ifdef TRACE_ERROR
+	   Trace_Error("invalid big num oper : %u \n", (unsigned int)big_num_arithmetic_oper);
+	#endif
+	return FAILURE;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_Acc_Init
+
+DESCRIPTION    : initialise accumulator to sum of 0, without any chunks memory
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           :
+
+Func ID        : 04.43
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Big_Num_Acc_Init(big_num_acc_t *const acc_ptr)
+{
+	acc_ptr->chunk_block_ptr = NULL_DATA_PTR;
+	acc_ptr->low_ptr[BIG_NUM_SIGN_POSITIVE] = NULL_DATA_PTR;
+	acc_ptr->low_ptr[BIG_NUM_SIGN_NEGATIVE] = NULL_DATA_PTR;
+	acc_ptr->carries_ptr[BIG_NUM_SIGN_POSITIVE] = NULL_DATA_PTR;
+	acc_ptr->carries_ptr[BIG_NUM_SIGN_NEGATIVE] = NULL_DATA_PTR;
+	acc_ptr->num_chunks = 0;
+	acc_ptr->alloc_chunks = 0;
+	acc_ptr->num_frac_chunks = 0;
+	acc_ptr->precision_digits = 0;
+	acc_ptr->num_pending_addends = 0;
+	acc_ptr->sign_flag = BIG_NUM_SIGN_POSITIVE;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_Acc_Free
+
+DESCRIPTION    : frees chunks memory of accumulator, and accumulator is set to sum of 0
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           :
+
+Func ID        : 04.44
+
+BUGS           :
+-*------------------------------------------------------------*/
+void Big_Num_Acc_Free(big_num_acc_t *const acc_ptr)
+{
+	free(acc_ptr->chunk_block_ptr);
+	Big_Num_Acc_Init(acc_ptr);
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_Acc_Reserve
+
+DESCRIPTION    : make sure that accumulator has atleast num_int_chunks chunks before '.' char, and num_frac_chunks chunks after it
+
+INPUT          :
+
+OUTPUT         :
+
+NOTE           : sum is preserved. If num_frac_chunks is more than chunks after '.' char, chunks are moved up, so that '.' char
+                 stays at chunk boundary. Chunks memory grows by doubling, and chunks beyond num_chunks are always 0.
+
+Func ID        : 04.45
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Big_Num_Acc_Reserve(big_num_acc_t *const acc_ptr, const size_t num_int_chunks, const size_t num_frac_chunks)
+{
+	big_num_limb_t *block_ptr, *part_ptr;
+	size_t shift_chunks, num_chunks, alloc_chunks, part;
+
+	shift_chunks = (num_frac_chunks > acc_ptr->num_frac_chunks) ? num_frac_chunks - acc_ptr->num_frac_chunks : 0;
+	num_chunks = acc_ptr->num_chunks + shift_chunks;
+	if(acc_ptr->num_frac_chunks + shift_chunks + num_int_chunks > num_chunks)
 	{
-		//result_alloc_size sign char is excluded
-		--add_big_num_datas.result_alloc_size;
+		num_chunks = acc_ptr->num_frac_chunks + shift_chunks + num_int_chunks;
 	}
-	if(add_big_num_datas.proc_str1_ptr == NULL_DATA_PTR || add_big_num_datas.proc_str2_ptr == NULL_DATA_PTR)
+	if(num_chunks > acc_ptr->alloc_chunks)
 	{
-		#ifdef TRACE_ERROR
-		   printf("ERR: sum - memory address is NULL \n");
-		#endif
-	    if(add_big_num_datas.proc_str1_ptr == NULL_DATA_PTR)
+		alloc_chunks = (num_chunks > 2 * acc_ptr->alloc_chunks) ? num_chunks : 2 * acc_ptr->alloc_chunks;
+		if(alloc_chunks > SIZE_MAX / (4 * sizeof(big_num_limb_t)) || (block_ptr = calloc(4 * alloc_chunks, sizeof(big_num_limb_t))) == NULL_DATA_PTR)
 		{
-			free(add_big_num_datas.proc_str1_ptr);
+			#ifdef TRACE_ERROR
+			   Trace_Error("acc - memory alloc failed for %lu chunks \n", (unsigned long)num_chunks);
+			#endif
+			return FAILURE;
 		}
-		if(add_big_num_datas.proc_str2_ptr == NULL_DATA_PTR)
+		// low limbs and carry counts of positive and negative addends are 4 parts of block
+		for(part = 0; part < 4 && acc_ptr->num_chunks != 0; ++part)
 		{
-			free(add_big_num_datas.proc_str2_ptr);
+			memcpy(block_ptr + (part * alloc_chunks) + shift_chunks, acc_ptr->chunk_block_ptr + (part * acc_ptr->alloc_chunks),
+			   acc_ptr->num_chunks * sizeof(big_num_limb_t));
 		}
-		return NULL_DATA_PTR;
+		free(acc_ptr->chunk_block_ptr);
+		acc_ptr->chunk_block_ptr = block_ptr;
+		acc_ptr->alloc_chunks = alloc_chunks;
+		acc_ptr->low_ptr[BIG_NUM_SIGN_POSITIVE] = block_ptr;
+		acc_ptr->carries_ptr[BIG_NUM_SIGN_POSITIVE] = block_ptr + alloc_chunks;
+		acc_ptr->low_ptr[BIG_NUM_SIGN_NEGATIVE] = block_ptr + (2 * alloc_chunks);
+		acc_ptr->carries_ptr[BIG_NUM_SIGN_NEGATIVE] = block_ptr + (3 * alloc_chunks);
 	}
-	if(add_big_num_datas.proc_str1_precision_digits != 0 || add_big_num_datas.proc_str2_precision_digits != 0 )
+	else if(shift_chunks != 0)
 	{
-		min_precision_digits = (add_big_num_datas.proc_str1_precision_digits < add_big_num_datas.proc_str2_precision_digits) ?
-		   add_big_num_datas.proc_str1_precision_digits : add_big_num_datas.proc_str2_precision_digits;
-		add_big_num_datas.result_str_precision_digits = (add_big_num_datas.proc_str1_precision_digits > add_big_num_datas.proc_str2_precision_digits) ?
-		   add_big_num_datas.proc_str1_precision_digits : add_big_num_datas.proc_str2_precision_digits;
-        diff_precision_digits = add_big_num_datas.result_str_precision_digits - min_precision_digits;
-        #ifdef TRACE_DATA
-		   printf("TRA: sum - min_prec_digits = %u, max_prec_digits = %u, diff_prec_digits = %u\n", min_precision_digits, add_big_num_datas.result_str_precision_digits, diff_precision_digits);
-        #endif
-        if(min_precision_digits == add_big_num_datas.proc_str1_precision_digits)
+		for(part = 0; part < 4; ++part)
 		{
-			temp_ptr = add_big_num_datas.proc_str1_ptr;
-			add_big_num_datas.proc_str1_ptr = realloc(add_big_num_datas.proc_str1_ptr, add_big_num_datas.proc_str1_len + 1 + diff_precision_digits);
-			if(add_big_num_datas.proc_str1_ptr == NULL_DATA_PTR)
-			{
-				#ifdef TRACE_ERROR
-				   printf("ERR: sum - memory alloc failed \n");
-				#endif
-				if(temp_ptr)
-				{
-					free(temp_ptr);
-				}
-				if(add_big_num_datas.proc_str2_ptr)
-				{
-					free(add_big_num_datas.proc_str2_ptr);
-				}
-				return NULL_DATA_PTR;
-			}
-			#ifdef TRACE_DATA
-			   printf("TRA: sum - realloc str1 size : %u, ", add_big_num_datas.proc_str1_len);
-			#endif
-			for(i = 0; i < diff_precision_digits; ++i)
-			{
-				add_big_num_datas.proc_str1_ptr[add_big_num_datas.proc_str1_len + i] = 0;
-			}
-			add_big_num_datas.proc_str1_ptr[add_big_num_datas.proc_str1_len + i] = NULL_CHAR;
-			add_big_num_datas.proc_str1_len += diff_precision_digits;
-		}
-        else
-		{
-			temp_ptr = add_big_num_datas.proc_str2_ptr;
-			add_big_num_datas.proc_str2_ptr = realloc(add_big_num_datas.proc_str2_ptr, add_big_num_datas.proc_str2_len + 1 + diff_precision_digits);
-			if(add_big_num_datas.proc_str2_ptr == NULL_DATA_PTR)
-			{
-				#ifdef TRACE_ERROR
-				   printf("ERR: sum - memory alloc failed \n");
-				#endif
-				if(temp_ptr)
-				{
-					free(temp_ptr);
-				}
-				if(add_big_num_datas.proc_str1_ptr)
-				{
-					free(add_big_num_datas.proc_str1_ptr);
-				}
-				return NULL_DATA_PTR;
-			}
-			for(i = 0; i < diff_precision_digits; ++i)
-			{
-				add_big_num_datas.proc_str2_ptr[add_big_num_datas.proc_str2_len + i] = 0;
-			}
-			add_big_num_datas.proc_str2_ptr[add_big_num_datas.proc_str2_len + i] = NULL_CHAR;
-			add_big_num_datas.proc_str2_len += diff_precision_digits;
-			#ifdef TRACE_DATA
-			   printf("TRA: sum - realloc str2 size : %u, ", add_big_num_datas.proc_str2_len);
-			#endif
+			part_ptr = acc_ptr->chunk_block_ptr + (part * acc_ptr->alloc_chunks);
+			memmove(part_ptr + shift_chunks, part_ptr, acc_ptr->num_chunks * sizeof(big_num_limb_t));
+			memset(part_ptr, 0, shift_chunks * sizeof(big_num_limb_t));
 		}
-		min_proc_str_len = (add_big_num_datas.proc_str1_len < add_big_num_datas.proc_str2_len) ? add_big_num_datas.proc_str1_len: add_big_num_datas.proc_str2_len;
-	    max_proc_str_len = (add_big_num_datas.proc_str1_len > add_big_num_datas.proc_str2_len) ? add_big_num_datas.proc_str1_len: add_big_num_datas.proc_str2_len;
-		++add_big_num_datas.result_alloc_size;
 	}
-	#ifdef TRACE_DATA
-	   printf("sum - result alloc size = %u \n", add_big_num_datas.result_alloc_size);
-	#endif
-	add_big_num_datas.result_ptr = calloc(add_big_num_datas.result_alloc_size, sizeof(char));
-	if(add_big_num_datas.result_ptr == NULL_DATA_PTR)
+	acc_ptr->num_chunks = num_chunks;
+	acc_ptr->num_frac_chunks += shift_chunks;
+	return SUCCESS;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_Acc_Add_Chars
+
+DESCRIPTION    : adds big num in num_str_chars chars of num_str, into accumulator
+
+INPUT          : num_str is as of Big_Num_From_Chars(), and need not be null terminated
+
+OUTPUT         :
+
+NOTE           : digits are packed into chunks by Dec_Digits_To_Chunks(), in blocks of BIG_NUM_STACK_LIMBS chunks on stack,
+                 and are added into sum of its sign by Dec_Chunks_Add_Lazy(), so that addend costs one pass over its digits,
+                 without limbs conversion or carry propagation. Integer part is packed from '.' char towards its first digit,
+                 and fraction part from '.' char towards its last digit, whose last chunk is padded with 0 digits. Once
+                 BIG_NUM_ACC_MAX_PENDING addends are added, sum is normalised, before next addend.
+
+Func ID        : 04.46
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Big_Num_Acc_Add_Chars(big_num_acc_t *const acc_ptr, const char *const num_str, const size_t num_str_chars)
+{
+	return Big_Num_Acc_Add_Signed_Chars(acc_ptr, num_str, num_str_chars, STATE_NO);
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_Acc_Add_Signed_Chars
+
+DESCRIPTION    : adds big num in num_str_chars chars of num_str, or its negation if negate_flag is STATE_YES, into accumulator
+
+INPUT          : num_str is as of Big_Num_From_Chars(), and need not be null terminated
+
+OUTPUT         :
+
+NOTE           : as of Big_Num_Acc_Add_Chars(), where negated addend is added into sum of other sign, so that subtract of
+                 --files is also done without limbs conversion.
+
+Func ID        : 04.55
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Big_Num_Acc_Add_Signed_Chars(big_num_acc_t *const acc_ptr, const char *const num_str, const size_t num_str_chars, const uint8_t negate_flag)
+{
+	const char *digits_str;
+	big_num_limb_t *low_ptr, *carries_ptr, chunk_value, stack_chunks[BIG_NUM_STACK_LIMBS];
+	size_t str_pos = 0, num_chars, point_pos, num_int_digits, num_frac_digits, num_whole_chunks, num_block_chunks, chunk_pos, digit_pos;
+	uint8_t sign_flag = BIG_NUM_SIGN_POSITIVE;
+
+	if(acc_ptr == NULL_DATA_PTR || num_str == NULL_DATA_PTR)
 	{
 		#ifdef TRACE_ERROR
-		   printf("ERR: sum - memory alloc failed \n");
+		   Trace_Error("acc or str is null \n");
 		#endif
-		if(add_big_num_datas.proc_str1_ptr)
-		{
-			free(add_big_num_datas.proc_str1_ptr);
-		}
-		if(add_big_num_datas.proc_str2_ptr)
+		return FAILURE;
+	}
+	if(num_str_chars != 0 && (num_str[0] == '-' || num_str[0] == '+'))
+	{
+		if(num_str[0] == '-')
 		{
-			free(add_big_num_datas.proc_str2_ptr);
+			sign_flag = BIG_NUM_SIGN_NEGATIVE;
 		}
-		return NULL_DATA_PTR;
+		str_pos = 1;
+	}
+	if(negate_flag == STATE_YES)
+	{
+		sign_flag = (sign_flag == BIG_NUM_SIGN_NEGATIVE) ? BIG_NUM_SIGN_POSITIVE : BIG_NUM_SIGN_NEGATIVE;
 	}
-	diff_proc_str_len = add_big_num_datas.proc_str1_len - add_big_num_datas.proc_str2_len;
-	if(diff_proc_str_len < 0)
+	digits_str = num_str + str_pos;
+	num_chars = num_str_chars - str_pos;
+	if((str_pos = Dec_Str_Scan(digits_str, num_chars, &point_pos)) != num_chars)
 	{
-		diff_proc_str_len = -diff_proc_str_len;
+		#ifdef TRACE_ERROR
+	       Trace_Error("big num str has invalid char : %c at pos : %lu \n", digits_str[str_pos], (unsigned long)(digits_str - num_str + str_pos));
+	    #endif
+		return FAILURE;
 	}
-	#ifdef TRACE_DATA
-	   printf("TRA: sum - min_str_len = %u, max_str_len = %u, max_min_len_diff = %u \n", min_proc_str_len, max_proc_str_len, diff_proc_str_len);
-	#endif
-
-	/* grade-school method of addition */
-	carry = 0;
-	for(i = min_proc_str_len - 1, result_ptr_pos = max_proc_str_len; i >= 0 ; --i, --result_ptr_pos)
+	num_int_digits = point_pos;
+	num_frac_digits = (point_pos == num_chars) ? 0 : num_chars - point_pos - 1;
+	if(num_int_digits + num_frac_digits == 0)
 	{
-		int16_t sum;
-
-        if(min_proc_str_len == add_big_num_datas.proc_str1_len)
-		{
-			sum = add_big_num_datas.proc_str1_ptr[i] + add_big_num_datas.proc_str2_ptr[i + diff_proc_str_len] + carry;
-			#ifdef TRACE_DATA
-			   printf("TRA: sum - str1[%d] = %u, str2[%d] = %u, carry = %d, ", i, add_big_num_datas.proc_str1_ptr[i], i + diff_proc_str_len,
-			     add_big_num_datas.proc_str2_ptr[i + diff_proc_str_len], carry);
-			#endif
-		}
-        else
-		{
-	        sum = add_big_num_datas.proc_str1_ptr[i + diff_proc_str_len] + add_big_num_datas.proc_str2_ptr[i] + carry;
-			#ifdef TRACE_DATA
-			   printf("TRA: sum - str1[%d] = %u, str2[%d] = %u, carry = %d, ", i + diff_proc_str_len, add_big_num_datas.proc_str1_ptr[i + diff_proc_str_len],
-    			   i, add_big_num_datas.proc_str2_ptr[i], carry);
-			#endif
-		}
-        add_big_num_datas.result_ptr[result_ptr_pos] = (sum % 10);
-		#ifdef TRACE_DATA
-		   printf("result[%d] = %u \n", result_ptr_pos, add_big_num_datas.result_ptr[result_ptr_pos]);
+		#ifdef TRACE_ERROR
+		   Trace_Error("big num str has only non numeric char \n");
 		#endif
-        carry = sum / 10;
+		return FAILURE;
 	}
-	// Add remaining digits
-    for (i= diff_proc_str_len - 1; i >= 0; --i, --result_ptr_pos)
-    {
-        int16_t sum;
-
-		if(min_proc_str_len == add_big_num_datas.proc_str1_len)
-		{
-			sum = ((add_big_num_datas.proc_str2_ptr[i]) + carry);
-			#ifdef TRACE_DATA
-			   printf("TRA: sum - str2[%d] = %u, carry = %d, ", i, add_big_num_datas.proc_str2_ptr[i], carry);
-			#endif
-		}
-		else
-		{
-			sum = ((add_big_num_datas.proc_str1_ptr[i]) + carry);
-			#ifdef TRACE_DATA
-			   printf("TRA: sum - str1[%d] = %u, carry = %d, ", i, add_big_num_datas.proc_str1_ptr[i], carry);
-			#endif
-		}
-        add_big_num_datas.result_ptr[result_ptr_pos] = (sum % 10);
-		#ifdef TRACE_DATA
-		    printf("result[%d] = %u \n", result_ptr_pos, add_big_num_datas.result_ptr[result_ptr_pos]);
-		#endif
-        carry = sum / 10;
-    }
-    // Add remaining carry
-    add_big_num_datas.result_ptr[result_ptr_pos] = carry;
-	#ifdef TRACE_DATA
-		printf("TRA: sum -  At end, result[%d] = %u, carry = %d \n", result_ptr_pos, add_big_num_datas.result_ptr[result_ptr_pos], carry);
-	#endif
-	if(aug_str1[0] == '-' && add_str2[0] == '-')
+	if(acc_ptr->num_pending_addends >= BIG_NUM_ACC_MAX_PENDING && (Big_Num_Acc_Normalize(acc_ptr)) != SUCCESS)
 	{
-	    result_ptr_init_pos = 1;
+		return FAILURE;
 	}
-	else
+	if((Big_Num_Acc_Reserve(acc_ptr, (num_int_digits + BIG_NUM_LIMB_DEC_DIGITS - 1) / BIG_NUM_LIMB_DEC_DIGITS,
+	   (num_frac_digits + BIG_NUM_LIMB_DEC_DIGITS - 1) / BIG_NUM_LIMB_DEC_DIGITS)) != SUCCESS)
 	{
-		result_ptr_init_pos = 0;
+		return FAILURE;
 	}
-	if(result_ptr_init_pos == 1)
+	if(num_frac_digits > acc_ptr->precision_digits)
 	{
-		memmove(add_big_num_datas.result_ptr + 1, add_big_num_datas.result_ptr, max_proc_str_len + 1 + 2);
-		add_big_num_datas.result_ptr[0] = '-';
+		acc_ptr->precision_digits = num_frac_digits;
 	}
-	/* convert result from numeric into ASCII string numeric */
-	for (result_ptr_pos = result_ptr_init_pos; result_ptr_pos < max_proc_str_len + 1 + result_ptr_init_pos; ++result_ptr_pos)
+	// chunk 0 is first chunk before '.' char, and chunk -1 is first chunk after it
+	low_ptr = acc_ptr->low_ptr[sign_flag] + acc_ptr->num_frac_chunks;
+	carries_ptr = acc_ptr->carries_ptr[sign_flag] + acc_ptr->num_frac_chunks;
+	num_whole_chunks = num_int_digits / BIG_NUM_LIMB_DEC_DIGITS;
+	for(chunk_pos = 0; chunk_pos < num_whole_chunks; chunk_pos += num_block_chunks)
 	{
-		add_big_num_datas.result_ptr[result_ptr_pos] += '0';
+		num_block_chunks = (num_whole_chunks - chunk_pos < BIG_NUM_STACK_LIMBS) ? num_whole_chunks - chunk_pos : BIG_NUM_STACK_LIMBS;
+		Dec_Digits_To_Chunks(stack_chunks, digits_str + point_pos - ((chunk_pos + num_block_chunks) * BIG_NUM_LIMB_DEC_DIGITS), num_block_chunks);
+		Dec_Chunks_Add_Lazy(low_ptr + chunk_pos, carries_ptr + chunk_pos, stack_chunks, num_block_chunks);
 	}
-	add_big_num_datas.result_ptr[result_ptr_pos] = NULL_CHAR;
-	#ifdef TRACE_DATA
-	   printf("TRA: sum - result: %s before precision \n", add_big_num_datas.result_ptr);
-	#endif
-	if(add_big_num_datas.result_str_precision_digits != 0)
+	if(num_int_digits % BIG_NUM_LIMB_DEC_DIGITS != 0)
 	{
-		#ifdef TRACE_DATA
-	    	printf("TRA: sum - result num precision width: %u \n", add_big_num_datas.result_str_precision_digits);
-	    #endif
-		memmove(&add_big_num_datas.result_ptr[max_proc_str_len + 1 + result_ptr_init_pos - add_big_num_datas.result_str_precision_digits + 1],
-		  &add_big_num_datas.result_ptr[max_proc_str_len + 1 + result_ptr_init_pos - add_big_num_datas.result_str_precision_digits], add_big_num_datas.result_str_precision_digits);
-	    add_big_num_datas.result_ptr[max_proc_str_len + 1 + result_ptr_init_pos - add_big_num_datas.result_str_precision_digits] = '.';
-		add_big_num_datas.result_ptr[add_big_num_datas.result_alloc_size - 1] = NULL_CHAR;
+		for(chunk_value = 0, digit_pos = 0; digit_pos < num_int_digits % BIG_NUM_LIMB_DEC_DIGITS; ++digit_pos)
+		{
+			chunk_value = (chunk_value * 10) + (big_num_limb_t)(digits_str[digit_pos] - '0');
+		}
+		Dec_Chunks_Add_Lazy(low_ptr + chunk_pos, carries_ptr + chunk_pos, &chunk_value, 1);
 	}
-	#ifdef TRACE_DATA
-	     printf("TRA: sum - result: %s before removing leading 0 \n", add_big_num_datas.result_ptr);
-    #endif
-	while(add_big_num_datas.result_ptr[result_ptr_init_pos] == '0' && add_big_num_datas.result_ptr[result_ptr_init_pos + 1] != '.')
+	digits_str += point_pos + 1;
+	num_whole_chunks = num_frac_digits / BIG_NUM_LIMB_DEC_DIGITS;
+	for(chunk_pos = 0; chunk_pos < num_whole_chunks; chunk_pos += num_block_chunks)
 	{
-	    memmove(&add_big_num_datas.result_ptr[result_ptr_init_pos], &add_big_num_datas.result_ptr[result_ptr_init_pos + 1], add_big_num_datas.result_alloc_size - 1);
+		// first chunk of block is least significant, ie chunk -(chunk_pos + num_block_chunks)
+		num_block_chunks = (num_whole_chunks - chunk_pos < BIG_NUM_STACK_LIMBS) ? num_whole_chunks - chunk_pos : BIG_NUM_STACK_LIMBS;
+		Dec_Digits_To_Chunks(stack_chunks, digits_str + (chunk_pos * BIG_NUM_LIMB_DEC_DIGITS), num_block_chunks);
+		Dec_Chunks_Add_Lazy(low_ptr - (chunk_pos + num_block_chunks), carries_ptr - (chunk_pos + num_block_chunks), stack_chunks, num_block_chunks);
 	}
-	free(add_big_num_datas.proc_str1_ptr);
-	free(add_big_num_datas.proc_str2_ptr);
-	#ifdef TRACE_INFO
-	   printf("TRA: In Big num, %s + %s = %s\n", aug_str1, add_str2, add_big_num_datas.result_ptr);
-	#endif
-	return  add_big_num_datas.result_ptr;
+	if(num_frac_digits % BIG_NUM_LIMB_DEC_DIGITS != 0)
+	{
+		for(chunk_value = 0, digit_pos = chunk_pos * BIG_NUM_LIMB_DEC_DIGITS; digit_pos < num_frac_digits; ++digit_pos)
+		{
+			chunk_value = (chunk_value * 10) + (big_num_limb_t)(digits_str[digit_pos] - '0');
+		}
+		chunk_value *= limb_power_of_10[BIG_NUM_LIMB_DEC_DIGITS - (num_frac_digits % BIG_NUM_LIMB_DEC_DIGITS)];
+		Dec_Chunks_Add_Lazy(low_ptr - (chunk_pos + 1), carries_ptr - (chunk_pos + 1), &chunk_value, 1);
+	}
+	++acc_ptr->num_pending_addends;
+	return SUCCESS;
 }
 
 /*------------------------------------------------------------*
-FUNCTION NAME  : Big_Nums_Subtract
+FUNCTION NAME  : Big_Num_Acc_Add_Str
 
-DESCRIPTION    :  find sum of two large numbers.
+DESCRIPTION    : adds big num in str, into accumulator
 
 INPUT          :
 
 OUTPUT         :
 
-NOTE           : Caller is responsible for freeing result memory.
+NOTE           :
 
-Func ID        : 01.04
+Func ID        : 04.47
 
 BUGS           :
 -*------------------------------------------------------------*/
-char *Big_Nums_Subtract(const char *const min_str1, const char *const subt_str2)
+uint16_t Big_Num_Acc_Add_Str(big_num_acc_t *const acc_ptr, const char *const num_str)
 {
-    big_num_datas_t subtract_big_num_datas;
-	char *result_ptr, *temp_str2_ptr;
-	int16_t proc_str1_ptr_pos = 0, proc_str2_ptr_pos = 0, result_ptr_pos = 0, i, diff_proc_str_len, carry = 0, subtract;
-	uint8_t result_ptr_init_pos, min_proc_str_len = 0, max_proc_str_len, diff_precision_digits = 0, min_precision_digits = 0, zero_subt_str2_carry;
-
-    #ifdef TRACE_FLOW
-	    printf("TRA: In Big num, %s - %s \n", min_str1, subt_str2);
-    #endif
-	subtract_big_num_datas.operand_str1 = min_str1;
-	subtract_big_num_datas.operand_str2 = subt_str2;
-	if((Validate_Big_Num_Data(BIG_NUMS_SUBTRACT_OPER, RESULT_BASED_PRECISION_DIGITS, &subtract_big_num_datas)) != SUCCESS)
-    {
-		return NULL_DATA_PTR;
-	}
-	if(subtract_big_num_datas.result_ptr != NULL_DATA_PTR)
-	{
-		return subtract_big_num_datas.result_ptr;
-	}
-	if(subtract_big_num_datas.proc_str1_ptr == NULL_DATA_PTR || subtract_big_num_datas.proc_str2_ptr == NULL_DATA_PTR)
+	if(num_str == NULL_DATA_PTR)
 	{
 		#ifdef TRACE_ERROR
-			   printf("ERR: diff - memory is NULL \n");
+		   Trace_Error("acc or str is null \n");
 		#endif
-		if(subtract_big_num_datas.proc_str1_ptr)
-		{
-			free(subtract_big_num_datas.proc_str1_ptr);
-		}
-		if(subtract_big_num_datas.proc_str2_ptr)
-		{
-			free(subtract_big_num_datas.proc_str2_ptr);
-		}
-		return NULL_DATA_PTR;
+		return FAILURE;
 	}
-	if((min_str1[0] == '-' && subt_str2[0] != '-') || (min_str1[0] != '-' && subt_str2[0] == '-'))
+	return Big_Num_Acc_Add_Chars(acc_ptr, num_str, strlen(num_str));
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_Acc_Normalize
+
+DESCRIPTION    : propagates carries of sums of accumulator, and subtracts smaller sum from bigger sum
+
+INPUT          :
+
+OUTPUT         : sum of sign_flag of accumulator has chunks of sum, and other sum and all carry counts are 0
+
+NOTE           : normalised sum is also redundant form, so that addends can be added after it.
+
+Func ID        : 04.48
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Big_Num_Acc_Normalize(big_num_acc_t *const acc_ptr)
+{
+	big_num_limb_t *big_ptr, *small_ptr, carry, subt_chunk;
+	size_t chunk_pos;
+	uint8_t sign_flag, borrow;
+
+	for(sign_flag = BIG_NUM_SIGN_POSITIVE; sign_flag <= BIG_NUM_SIGN_NEGATIVE; ++sign_flag)
 	{
-		temp_str2_ptr = calloc(subtract_big_num_datas.proc_str2_len + 2, sizeof(char));
-		if(temp_str2_ptr == NULL_DATA_PTR)
-		{
-			#ifdef TRACE_ERROR
-			   printf("ERR: diff - memory alloc failed \n");
-			#endif
-			if(subtract_big_num_datas.proc_str1_ptr)
-			{
-				free(subtract_big_num_datas.proc_str1_ptr);
-			}
-			if(subtract_big_num_datas.proc_str2_ptr)
-			{
-				free(subtract_big_num_datas.proc_str2_ptr);
-			}
-			return NULL_DATA_PTR;
-		}
-		i = 0;
-		if(subt_str2[0] == '-' || subt_str2[0] == '+')
-		{
-			i = 1;
-		}
-		memcpy(temp_str2_ptr + 1, subt_str2 + i, strlen(subt_str2 + i) + 1);
-		if(min_str1[0] == '-' && subt_str2[0] != '-')
+		if((carry = Dec_Chunks_Normalize(acc_ptr->low_ptr[sign_flag], acc_ptr->carries_ptr[sign_flag], acc_ptr->num_chunks)) == 0)
 		{
-			temp_str2_ptr[0] = '-';
+			continue;
 		}
-		else
+		// carry is less than 10 ^ BIG_NUM_LIMB_DEC_DIGITS, as carry counts are less than BIG_NUM_ACC_MAX_PENDING
+		if((Big_Num_Acc_Reserve(acc_ptr, acc_ptr->num_chunks - acc_ptr->num_frac_chunks + 1, 0)) != SUCCESS)
 		{
-			temp_str2_ptr[0] = '+';
+			return FAILURE;
 		}
-		#ifdef TRACE_DATA
-		   printf("TRA: Sum oper, addand = %s \n", temp_str2_ptr);
-		#endif
-		free(subtract_big_num_datas.proc_str1_ptr);
-	    free(subtract_big_num_datas.proc_str2_ptr);
-		result_ptr = Big_Nums_Sum(min_str1, temp_str2_ptr);
-		free(temp_str2_ptr);
-		return result_ptr;
+		acc_ptr->low_ptr[sign_flag][acc_ptr->num_chunks - 1] = carry;
 	}
-	if(min_str1[0] == '-' && subt_str2[0] == '-')
+	acc_ptr->num_pending_addends = 0;
+	acc_ptr->sign_flag = (Limbs_Cmp(acc_ptr->low_ptr[BIG_NUM_SIGN_POSITIVE], acc_ptr->low_ptr[BIG_NUM_SIGN_NEGATIVE], acc_ptr->num_chunks) >= 0) ?
+	   BIG_NUM_SIGN_POSITIVE : BIG_NUM_SIGN_NEGATIVE;
+	big_ptr = acc_ptr->low_ptr[acc_ptr->sign_flag];
+	small_ptr = acc_ptr->low_ptr[BIG_NUM_SIGN_NEGATIVE - acc_ptr->sign_flag];
+	if(acc_ptr->num_chunks == 0 || Limbs_Normalized_Len(small_ptr, acc_ptr->num_chunks) == 0)
 	{
-		free(subtract_big_num_datas.proc_str1_ptr);
-	    free(subtract_big_num_datas.proc_str2_ptr);
-        result_ptr = Big_Nums_Subtract(subt_str2 + 1, min_str1 + 1);
-        return result_ptr;
+		return SUCCESS;
 	}
-	min_proc_str_len = (subtract_big_num_datas.proc_str1_len < subtract_big_num_datas.proc_str2_len) ? subtract_big_num_datas.proc_str1_len: subtract_big_num_datas.proc_str2_len;
-	max_proc_str_len = (subtract_big_num_datas.proc_str1_len > subtract_big_num_datas.proc_str2_len) ? subtract_big_num_datas.proc_str1_len: subtract_big_num_datas.proc_str2_len;
-	#ifdef TRACE_DATA
-	   printf("TRA: diff - min_str_len : %u, max_str_len = %u \n", min_proc_str_len, max_proc_str_len);
-	#endif
-	diff_precision_digits = min_precision_digits = 0;
-	//result_alloc_size is included for sign char at begin of result_ptr and NULL_CHAR at end of result_ptr
-	subtract_big_num_datas.result_alloc_size = max_proc_str_len + 2;
-	if(subtract_big_num_datas.proc_str1_precision_digits != 0 || subtract_big_num_datas.proc_str2_precision_digits != 0 )
-	{
-		min_precision_digits = (subtract_big_num_datas.proc_str1_precision_digits < subtract_big_num_datas.proc_str2_precision_digits) ?
-		   subtract_big_num_datas.proc_str1_precision_digits : subtract_big_num_datas.proc_str2_precision_digits;
-		subtract_big_num_datas.result_str_precision_digits = (subtract_big_num_datas.proc_str1_precision_digits > subtract_big_num_datas.proc_str2_precision_digits) ?
-		   subtract_big_num_datas.proc_str1_precision_digits : subtract_big_num_datas.proc_str2_precision_digits;
-        diff_precision_digits = subtract_big_num_datas.result_str_precision_digits - min_precision_digits;
-        #ifdef TRACE_DATA
-		   printf("TRA: diff - min_prec_digits = %u, max_prec_digits = %u, diff_prec_digits = %u\n", min_precision_digits, subtract_big_num_datas.result_str_precision_digits, diff_precision_digits);
-        #endif
-        if(min_precision_digits == subtract_big_num_datas.proc_str1_precision_digits)
-		{
-			temp_str2_ptr = subtract_big_num_datas.proc_str1_ptr;
-			subtract_big_num_datas.proc_str1_ptr = realloc(subtract_big_num_datas.proc_str1_ptr, subtract_big_num_datas.proc_str1_len + 1 + diff_precision_digits);
-			if(subtract_big_num_datas.proc_str1_ptr == NULL_DATA_PTR)
-			{
-				#ifdef TRACE_ERROR
-				   printf("ERR: diff - memory allocation failed \n");
-				#endif
-				if(temp_str2_ptr)
-				{
-					free(temp_str2_ptr);
-				}
-				if(subtract_big_num_datas.proc_str2_ptr)
-				{
-					free(subtract_big_num_datas.proc_str2_ptr);
-				}
-				return NULL_DATA_PTR;
-			}
-			#ifdef TRACE_DATA
-			   printf("TRA: diff - realloc str1 size : %u, ", subtract_big_num_datas.proc_str1_len);
-			#endif
-			for(i = 0; i < diff_precision_digits; ++i)
-			{
-				subtract_big_num_datas.proc_str1_ptr[subtract_big_num_datas.proc_str1_len + i] = 0;
-			}
-			subtract_big_num_datas.proc_str1_ptr[subtract_big_num_datas.proc_str1_len + i] = NULL_CHAR;
-			subtract_big_num_datas.proc_str1_len += diff_precision_digits;
-		}
-        else
-		{
-			temp_str2_ptr = subtract_big_num_datas.proc_str2_ptr;
-			subtract_big_num_datas.proc_str2_ptr = realloc(subtract_big_num_datas.proc_str2_ptr, subtract_big_num_datas.proc_str2_len + 1 + diff_precision_digits);
-			if(subtract_big_num_datas.proc_str2_ptr == NULL_DATA_PTR)
-			{
-				#ifdef TRACE_ERROR
-				   printf("ERR: diff - memory allocation failed \n");
-				#endif
-				if(temp_str2_ptr)
-				{
-					free(temp_str2_ptr);
-				}
-				if(subtract_big_num_datas.proc_str1_ptr)
-				{
-					free(subtract_big_num_datas.proc_str1_ptr);
-				}
-				return NULL_DATA_PTR;
-			}
-			for(i = 0; i < diff_precision_digits; ++i)
-			{
-				subtract_big_num_datas.proc_str2_ptr[subtract_big_num_datas.proc_str2_len + i] = 0;
-			}
-			subtract_big_num_datas.proc_str2_ptr[subtract_big_num_datas.proc_str2_len + i] = NULL_CHAR;
-			subtract_big_num_datas.proc_str2_len += diff_precision_digits;
-			#ifdef TRACE_DATA
-			   printf("TRA: diff - realloc str2 size : %u, ", subtract_big_num_datas.proc_str2_len);
-			#endif
-		}
-		min_proc_str_len = (subtract_big_num_datas.proc_str1_len < subtract_big_num_datas.proc_str2_len) ? subtract_big_num_datas.proc_str1_len: subtract_big_num_datas.proc_str2_len;
-	    max_proc_str_len = (subtract_big_num_datas.proc_str1_len > subtract_big_num_datas.proc_str2_len) ? subtract_big_num_datas.proc_str1_len: subtract_big_num_datas.proc_str2_len;
-		//result_alloc_size is included for sign char at begin of result_ptr, '.' char and  NULL_CHAR at end of result_ptr
-		subtract_big_num_datas.result_alloc_size = max_proc_str_len + 3;
+	for(chunk_pos = 0, borrow = 0; chunk_pos < acc_ptr->num_chunks; ++chunk_pos)
+	{
+		subt_chunk = small_ptr[chunk_pos] + borrow;
+		borrow = (big_ptr[chunk_pos] < subt_chunk) ? 1 : 0;
+		big_ptr[chunk_pos] = (borrow == 0) ? big_ptr[chunk_pos] - subt_chunk : BIG_NUM_LIMB_DEC_BASE - (subt_chunk - big_ptr[chunk_pos]);
 	}
-	#ifdef TRACE_DATA
-	   printf("result alloc size = %u \n", subtract_big_num_datas.result_alloc_size);
-	#endif
-	subtract_big_num_datas.result_ptr = calloc(subtract_big_num_datas.result_alloc_size, sizeof(char));
-    if(subtract_big_num_datas.result_ptr == NULL_DATA_PTR)
+	memset(small_ptr, 0, acc_ptr->num_chunks * sizeof(big_num_limb_t));
+	return SUCCESS;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_Acc_Dec_Chunks
+
+DESCRIPTION    : normalises accumulator, and finds chunks of magnitude of its sum, with precision_digits digits after '.' char
+
+INPUT          :
+
+OUTPUT         : chunk_ptr_ptr has acc_ptr->num_chunks chunks from least significant chunk. If it is not low limbs of sum,
+                 caller is responsible for freeing it by Scratch_Free().
+
+NOTE           : as '.' char of sum is at chunk boundary, padding 0 digits after precision_digits digits are dropped by
+                 Dec_Chunks_Shift_Right() into scratch.
+
+Func ID        : 04.49
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Big_Num_Acc_Dec_Chunks(big_num_acc_t *const acc_ptr, big_num_limb_t **const chunk_ptr_ptr)
+{
+	size_t shift_digits;
+
+	if((Big_Num_Acc_Normalize(acc_ptr)) != SUCCESS)
+	{
+		return FAILURE;
+	}
+	*chunk_ptr_ptr = acc_ptr->low_ptr[acc_ptr->sign_flag];
+	shift_digits = (acc_ptr->num_frac_chunks * BIG_NUM_LIMB_DEC_DIGITS) - acc_ptr->precision_digits;
+	if(shift_digits == 0)
+	{
+		return SUCCESS;
+	}
+	if((*chunk_ptr_ptr = Scratch_Alloc(acc_ptr->num_chunks)) == NULL_DATA_PTR)
 	{
 		#ifdef TRACE_ERROR
-			   printf("ERR: diff - memory alloc failed \n");
+		   Trace_Error("acc - memory alloc failed \n");
 		#endif
-		if(subtract_big_num_datas.proc_str1_ptr)
-		{
-			free(subtract_big_num_datas.proc_str1_ptr);
-		}
-		if(subtract_big_num_datas.proc_str2_ptr)
-		{
-			free(subtract_big_num_datas.proc_str2_ptr);
-		}
-		return NULL_DATA_PTR;
+		return FAILURE;
 	}
-	diff_proc_str_len = subtract_big_num_datas.proc_str1_len - subtract_big_num_datas.proc_str2_len;
-	if(diff_proc_str_len < 0)
+	Dec_Chunks_Shift_Right(*chunk_ptr_ptr, acc_ptr->low_ptr[acc_ptr->sign_flag], acc_ptr->num_chunks, shift_digits);
+	return SUCCESS;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_Acc_Value
+
+DESCRIPTION    : converts sum of accumulator, into limbs based big num
+
+INPUT          :
+
+OUTPUT         : precision digits of num is max precision digits of addends, as of adding them by Big_Num_Add()
+
+NOTE           : chunks of sum are converted once by Limbs_From_Dec_Chunks(). Accumulator is normalised, and can be added further.
+
+Func ID        : 04.50
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Big_Num_Acc_Value(big_num_acc_t *const acc_ptr, big_num_t *const num_ptr)
+{
+	big_num_limb_t *chunk_ptr;
+	uint16_t ret_status;
+
+	if(acc_ptr == NULL_DATA_PTR || num_ptr == NULL_DATA_PTR)
 	{
-		diff_proc_str_len = -diff_proc_str_len;
+		#ifdef TRACE_ERROR
+		   Trace_Error("acc or big num is null \n");
+		#endif
+		return FAILURE;
 	}
-	#ifdef TRACE_DATA
-	   printf("TRA: diff - min_str_len = %u, max_str_len = %u, max_min_len_diff = %u \n", min_proc_str_len, max_proc_str_len, diff_proc_str_len);
-	#endif
-	if(subtract_big_num_datas.proc_str1_len < subtract_big_num_datas.proc_str2_len)
+	if((Big_Num_Acc_Dec_Chunks(acc_ptr, &chunk_ptr)) != SUCCESS)
 	{
-		temp_str2_ptr = subtract_big_num_datas.proc_str1_ptr;
-		subtract_big_num_datas.proc_str1_ptr = realloc(subtract_big_num_datas.proc_str1_ptr, subtract_big_num_datas.proc_str2_len + 1);
-		if(subtract_big_num_datas.proc_str1_ptr == NULL_DATA_PTR)
-		{
-			#ifdef TRACE_ERROR
-			   printf("ERR: diff - memory allocation failed \n");
-			#endif
-			if(temp_str2_ptr)
-			{
-				free(temp_str2_ptr);
-			}
-			if(subtract_big_num_datas.proc_str2_ptr)
-			{
-				free(subtract_big_num_datas.proc_str1_ptr);
-			}
-			if(subtract_big_num_datas.result_ptr)
-			{
-				free(subtract_big_num_datas.result_ptr);
-			}
-			return NULL_DATA_PTR;
-		}
-		memmove(subtract_big_num_datas.proc_str1_ptr + diff_proc_str_len, subtract_big_num_datas.proc_str1_ptr, subtract_big_num_datas.proc_str1_len + 1);
-		for(i = 0; i < diff_proc_str_len; ++i)
-		{
-			subtract_big_num_datas.proc_str1_ptr[i] = 0;
-		}
-		subtract_big_num_datas.proc_str1_len = subtract_big_num_datas.proc_str2_len;
+		return FAILURE;
 	}
-	else if(subtract_big_num_datas.proc_str1_len > subtract_big_num_datas.proc_str2_len)
+	if((ret_status = Big_Num_Reserve(num_ptr, acc_ptr->num_chunks)) == SUCCESS)
 	{
-		temp_str2_ptr = subtract_big_num_datas.proc_str2_ptr;
-		subtract_big_num_datas.proc_str2_ptr = realloc(subtract_big_num_datas.proc_str2_ptr, subtract_big_num_datas.proc_str1_len + 1);
-		if(subtract_big_num_datas.proc_str2_ptr == NULL_DATA_PTR)
-		{
-			#ifdef TRACE_ERROR
-			   printf("ERR: diff - memory allocation failed \n");
-			#endif
-			if(temp_str2_ptr)
-			{
-				free(temp_str2_ptr);
-			}
-			if(subtract_big_num_datas.proc_str1_ptr)
-			{
-				free(subtract_big_num_datas.proc_str1_ptr);
-			}
-			if(subtract_big_num_datas.result_ptr)
-			{
-				free(subtract_big_num_datas.result_ptr);
-			}
-			return NULL_DATA_PTR;
-		}
-		memmove(subtract_big_num_datas.proc_str2_ptr + diff_proc_str_len, subtract_big_num_datas.proc_str2_ptr, subtract_big_num_datas.proc_str2_len + 1);
-		for(i = 0; i < diff_proc_str_len; ++i)
-		{
-			subtract_big_num_datas.proc_str2_ptr[i] = 0;
-		}
-		subtract_big_num_datas.proc_str2_len = subtract_big_num_datas.proc_str1_len;
+		ret_status = Limbs_From_Dec_Chunks(num_ptr->limb_ptr, &num_ptr->num_limbs, chunk_ptr, acc_ptr->num_chunks);
 	}
-	/* 10's complement */
-	carry = 1;
-    for(i = subtract_big_num_datas.proc_str2_len - 1; i >= 0; --i)
+	if(chunk_ptr != acc_ptr->low_ptr[acc_ptr->sign_flag])
 	{
-		subtract = (9 - subtract_big_num_datas.proc_str2_ptr[i]) + carry;
-		subtract_big_num_datas.proc_str2_ptr[i] = (subtract % 10);
-		carry = (subtract / 10);
+		Scratch_Free(chunk_ptr);
 	}
-	zero_subt_str2_carry = carry;
-	/* 10's complement subtraction */
-	carry = 0;
-	for(i = subtract_big_num_datas.proc_str2_len - 1; i >= 0 ; --i)
+	if(ret_status != SUCCESS)
 	{
-		subtract = subtract_big_num_datas.proc_str1_ptr[i] + subtract_big_num_datas.proc_str2_ptr[i] + carry;
-		#ifdef TRACE_DATA
-			   printf("TRA: diff - str1[%d] = %u, str2[%d] = %u, carry = %d, ", i, subtract_big_num_datas.proc_str1_ptr[i], i,
-			     subtract_big_num_datas.proc_str2_ptr[i], carry);
-		#endif
-		subtract_big_num_datas.result_ptr[i] = (subtract % 10);
-		carry = (subtract / 10);
-		#ifdef TRACE_DATA
-		   printf("result[%d] = %u \n", i, subtract_big_num_datas.result_ptr[i]);
-		#endif
+		return FAILURE;
 	}
-	if(zero_subt_str2_carry == 0 && carry == 0)
+	num_ptr->precision_digits = acc_ptr->precision_digits;
+	num_ptr->sign_flag = acc_ptr->sign_flag;
+	Big_Num_Normalize(num_ptr);
+	return SUCCESS;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_Acc_Format
+
+DESCRIPTION    : converts sum of accumulator, into big num in str, which is result_buf_ptr or allocated str
+
+INPUT          : if result_buf_ptr is NULL, str is allocated for exact num of chars
+
+OUTPUT         : returns str as of Big_Num_Format(), for sum as of Big_Num_Acc_Value()
+
+NOTE           : chunks of sum are written by Dec_Chunks_Format(), without limbs conversion.
+
+Func ID        : 04.51
+
+BUGS           :
+-*------------------------------------------------------------*/
+char *Big_Num_Acc_Format(big_num_acc_t *const acc_ptr, char *const result_buf_ptr, const size_t result_buf_size, size_t *const result_len_ptr)
+{
+	big_num_limb_t *chunk_ptr;
+	char *result_ptr;
+
+	if(acc_ptr == NULL_DATA_PTR || result_len_ptr == NULL_DATA_PTR)
 	{
-		carry = 1;
-		for(i = subtract_big_num_datas.proc_str2_len - 1; i >= 0; --i)
-		{
-			subtract = (9 - subtract_big_num_datas.result_ptr[i]) + carry;
-		    subtract_big_num_datas.result_ptr[i] = (subtract % 10);
-		    carry = (subtract / 10);
-		}
-		memmove(subtract_big_num_datas.result_ptr + 1, subtract_big_num_datas.result_ptr, subtract_big_num_datas.proc_str2_len + 1);
-		subtract_big_num_datas.result_ptr[0] = '-';
-		result_ptr_init_pos = 1;
+		return NULL_DATA_PTR;
 	}
-	else
+	if((Big_Num_Acc_Dec_Chunks(acc_ptr, &chunk_ptr)) != SUCCESS)
 	{
-		result_ptr_init_pos = 0;
+		return NULL_DATA_PTR;
 	}
-	/* convert result from numeric into ASCII string numeric */
-	for (result_ptr_pos = result_ptr_init_pos; result_ptr_pos < max_proc_str_len + result_ptr_init_pos; ++result_ptr_pos)
+	result_ptr = Dec_Chunks_Format(chunk_ptr, acc_ptr->num_chunks, acc_ptr->precision_digits, acc_ptr->sign_flag, result_buf_ptr, result_buf_size, result_len_ptr);
+	if(chunk_ptr != acc_ptr->low_ptr[acc_ptr->sign_flag])
 	{
-		subtract_big_num_datas.result_ptr[result_ptr_pos] += '0';
+		Scratch_Free(chunk_ptr);
 	}
-	#ifdef TRACE_DATA
-	   printf("TRA: diff - carry : %u, result: %s before precision \n", carry, subtract_big_num_datas.result_ptr);
-	#endif
-	if(subtract_big_num_datas.result_str_precision_digits != 0)
+	return result_ptr;
+}
+
+/*------------------------------------------------------------*
+FUNCTION NAME  : Big_Num_Acc_Write
+
+DESCRIPTION    : writes sum of accumulator in str, as of Big_Num_Acc_Format(), into out file
+
+INPUT          :
+
+OUTPUT         : returns FAILURE, if write failed
+
+NOTE           : chunks of sum are written by Dec_Chunks_Write(), without limbs conversion. No newline is written.
+
+Func ID        : 04.54
+
+BUGS           :
+-*------------------------------------------------------------*/
+uint16_t Big_Num_Acc_Write(big_num_acc_t *const acc_ptr, FILE *const out_file_ptr)
+{
+	big_num_limb_t *chunk_ptr;
+	uint16_t ret_status;
+
+	if(acc_ptr == NULL_DATA_PTR || out_file_ptr == NULL_DATA_PTR)
 	{
-		#ifdef TRACE_DATA
-	    	printf("TRA: diff - result num precision width: %u \n", subtract_big_num_datas.result_str_precision_digits);
-	    #endif
-		memmove(&subtract_big_num_datas.result_ptr[max_proc_str_len + result_ptr_init_pos - subtract_big_num_datas.result_str_precision_digits + 1],
-		  &subtract_big_num_datas.result_ptr[max_proc_str_len + result_ptr_init_pos - subtract_big_num_datas.result_str_precision_digits], subtract_big_num_datas.result_str_precision_digits);
-	    subtract_big_num_datas.result_ptr[max_proc_str_len + result_ptr_init_pos - subtract_big_num_datas.result_str_precision_digits] = '.';
-		subtract_big_num_datas.result_ptr[subtract_big_num_datas.result_alloc_size - 1] = NULL_CHAR;
+		#ifdef TRACE_ERROR
+		   Trace_Error("write - acc or out file is null \n");
+		#endif
+		return FAILURE;
 	}
-	#ifdef TRACE_DATA
-	    printf("TRA: diff - result: %s before removing leading 0 \n", subtract_big_num_datas.result_ptr);
-    #endif
-	while(subtract_big_num_datas.result_ptr[result_ptr_init_pos] == '0' && subtract_big_num_datas.result_ptr[result_ptr_init_pos + 1] != '.')
+	if((Big_Num_Acc_Dec_Chunks(acc_ptr, &chunk_ptr)) != SUCCESS)
 	{
-	    memmove(&subtract_big_num_datas.result_ptr[result_ptr_init_pos], &subtract_big_num_datas.result_ptr[result_ptr_init_pos + 1], subtract_big_num_datas.result_alloc_size - 1);
+		return FAILURE;
 	}
-    free(subtract_big_num_datas.proc_str1_ptr);
-	free(subtract_big_num_datas.proc_str2_ptr);
-	#ifdef TRACE_INFO
-	   printf("TRA: In Big num, %s - %s = %s\n", min_str1, subt_str2, subtract_big_num_datas.result_ptr);
-	#endif
-	return  subtract_big_num_datas.result_ptr;
+	ret_status = Dec_Chunks_Write(chunk_ptr, acc_ptr->num_chunks, acc_ptr->precision_digits, acc_ptr->sign_flag, out_file_ptr);
+	if(chunk_ptr != acc_ptr->low_ptr[acc_ptr->sign_flag])
+	{
+		Scratch_Free(chunk_ptr);
+	}
+	return ret_status;
 }